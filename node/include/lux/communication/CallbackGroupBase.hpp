@@ -1,4 +1,6 @@
 #pragma once
+#include <atomic>
+#include <deque>
 #include <memory>
 #include <mutex>
 #include <lux/cxx/container/SparseSet.hpp>
@@ -59,10 +61,7 @@ namespace lux::communication
             return id_in_node_;
         }
 
-        void setExecutor(ExecutorBase* executor)
-        {
-            executor_ = executor;
-        }
+        void setExecutor(ExecutorBase* executor);
 
         ExecutorBase* executor()
         {
@@ -74,6 +73,46 @@ namespace lux::communication
             return executor_;
         }
 
+        /// Ready-queue priority shared by all subscribers of the group under
+        /// ReadyPolicy::Priority.  A subscriber runs at the higher of its own
+        /// priority and its group's.
+        void setPriority(int32_t priority)
+        {
+            priority_.store(priority, std::memory_order_relaxed);
+        }
+
+        int32_t priority() const
+        {
+            return priority_.load(std::memory_order_relaxed);
+        }
+
+        // ── Exclusive ownership (MutuallyExclusive groups) ──
+        // A multi-threaded executor runs a MutuallyExclusive group on one
+        // worker at a time: the worker that acquires the group drains it,
+        // and a ready subscriber arriving meanwhile is deferred to that owner.
+
+        /// Try to become the group's exclusive owner.
+        bool tryAcquireExclusive()
+        {
+            return !exclusive_owned_.exchange(true, std::memory_order_seq_cst);
+        }
+
+        void releaseExclusive()
+        {
+            exclusive_owned_.store(false, std::memory_order_seq_cst);
+        }
+
+        /// Hand a ready subscriber to the current owner.
+        void deferReady(SubscriberBase* sub);
+
+        /// Next deferred subscriber, or nullptr.  Owner only.
+        SubscriberBase* takeDeferred();
+
+        bool hasDeferred() const
+        {
+            return deferred_count_.load(std::memory_order_seq_cst) != 0;
+        }
+
     private:
         void setIdInNode(size_t id)
         {
@@ -91,5 +130,11 @@ namespace lux::communication
         mutable std::mutex    mutex_;
         
         CallbackGroupList     subscribers_;
+        std::atomic<int32_t>  priority_{0};
+
+        std::atomic<bool>            exclusive_owned_{false};
+        std::atomic<size_t>          deferred_count_{0};
+        std::mutex                   deferred_mutex_;
+        std::deque<SubscriberBase*>  deferred_;
     };
 } // namespace lux::communication::intraprocess
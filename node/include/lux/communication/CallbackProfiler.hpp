@@ -0,0 +1,195 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include <lux/communication/platform/PlatformDefs.hpp>
+#include <lux/communication/visibility.h>
+
+namespace lux::communication
+{
+	class SubscriberBase;
+
+	/// Power-of-two histogram of durations: bucket i counts samples in
+	/// [2^i, 2^(i+1)) ns, bucket 0 also holds 0 ns.
+	struct DurationHistogram
+	{
+		static constexpr size_t kBuckets = 40; // last bucket: >= ~9 min
+
+		std::array<uint64_t, kBuckets> buckets{};
+		uint64_t					   count{0};
+		uint64_t					   sum_ns{0};
+		uint64_t					   max_ns{0};
+
+		void record(uint64_t ns)
+		{
+			const size_t b = ns == 0 ? 0 : static_cast<size_t>(std::bit_width(ns)) - 1;
+			++buckets[b < kBuckets ? b : kBuckets - 1];
+			++count;
+			sum_ns += ns;
+			if (ns > max_ns)
+				max_ns = ns;
+		}
+
+		void merge(const DurationHistogram& other)
+		{
+			for (size_t i = 0; i < kBuckets; ++i)
+				buckets[i] += other.buckets[i];
+			count  += other.count;
+			sum_ns += other.sum_ns;
+			if (other.max_ns > max_ns)
+				max_ns = other.max_ns;
+		}
+
+		double meanNs() const
+		{
+			return count ? static_cast<double>(sum_ns) / static_cast<double>(count) : 0.0;
+		}
+
+		/// Upper edge of the bucket holding the `q` quantile (0..1), capped
+		/// at the largest sample: an over-estimate by at most 2x.
+		LUX_COMMUNICATION_PUBLIC uint64_t quantileNs(double q) const;
+	};
+
+	/// Timings of one subscriber's (or timer's) callbacks.
+	struct CallbackStats
+	{
+		const SubscriberBase* subscriber{nullptr};
+		/// Message timestamp (enqueue / receive, publish stamp on the network
+		/// path) to callback start.  Timers: due time to callback start.
+		/// Not sampled under the Seq/TimeOrdered executors, whose queued
+		/// entries do not keep the stamp.
+		DurationHistogram	  queue_wait;
+		/// Callback execution time, one sample per invocation (a batch
+		/// callback counts once per span).
+		DurationHistogram	  exec;
+		/// Invocations whose execution time exceeded the budget.
+		uint64_t			  over_budget{0};
+	};
+
+	/// Per-subscriber callback timings, recorded by the executor threads.
+	///
+	/// Enabled with ExecutorBase::enableProfiling().  Each thread that runs
+	/// callbacks writes to its own shard (own lock, own cache lines), so
+	/// recording never contends across threads; snapshot() merges the
+	/// shards.  Overhead per callback is two steadyNowNs() calls and an
+	/// uncontended lock.
+	class LUX_COMMUNICATION_PUBLIC CallbackProfiler
+	{
+	public:
+		/// Called on the executor thread after a callback overran the budget.
+		using SlowCallbackHandler = std::function<void(const SubscriberBase*, uint64_t exec_ns)>;
+
+		/// Times one callback; does nothing for a null profiler.
+		class Scope
+		{
+		public:
+			/// @param enqueue_ns  Message timestamp (steady ns); 0 = unknown.
+			Scope(CallbackProfiler* profiler, const SubscriberBase* sub, uint64_t enqueue_ns)
+				: profiler_(profiler), sub_(sub), enqueue_ns_(enqueue_ns),
+				  start_ns_(profiler ? platform::steadyNowNs() : 0)
+			{
+			}
+
+			/// Back-to-back callbacks: start at `clock_ns` (the end of the
+			/// previous one; 0 = read the clock) and leave the end time
+			/// there, saving one clock read per callback.
+			Scope(CallbackProfiler* profiler, const SubscriberBase* sub, uint64_t enqueue_ns,
+				  uint64_t& clock_ns)
+				: profiler_(profiler), sub_(sub), enqueue_ns_(enqueue_ns),
+				  start_ns_(!profiler ? 0 : clock_ns ? clock_ns : platform::steadyNowNs()),
+				  clock_ns_(&clock_ns)
+			{
+			}
+
+			~Scope()
+			{
+				if (!profiler_)
+					return;
+				const uint64_t end_ns = platform::steadyNowNs();
+				profiler_->record(sub_, enqueue_ns_, start_ns_, end_ns);
+				if (clock_ns_)
+					*clock_ns_ = end_ns;
+			}
+
+			Scope(const Scope&)			   = delete;
+			Scope& operator=(const Scope&) = delete;
+
+		private:
+			CallbackProfiler*	  profiler_;
+			const SubscriberBase* sub_;
+			uint64_t			  enqueue_ns_;
+			uint64_t			  start_ns_;
+			uint64_t*			  clock_ns_{nullptr};
+		};
+
+		explicit CallbackProfiler(uint64_t budget_ns = 0);
+		~CallbackProfiler();
+
+		CallbackProfiler(const CallbackProfiler&)			 = delete;
+		CallbackProfiler& operator=(const CallbackProfiler&) = delete;
+
+		/// Execution time above which a callback counts as over budget
+		/// (0 = no budget).
+		void setBudgetNs(uint64_t budget_ns)
+		{
+			budget_ns_.store(budget_ns, std::memory_order_relaxed);
+		}
+
+		uint64_t budgetNs() const
+		{
+			return budget_ns_.load(std::memory_order_relaxed);
+		}
+
+		/// Install before spin(); runs on the thread that ran the callback.
+		void setSlowCallbackHandler(SlowCallbackHandler handler)
+		{
+			slow_handler_ = std::move(handler);
+		}
+
+		/// Record one callback.  Times are steady ns; `enqueue_ns` 0 or later
+		/// than `start_ns` skips the queue-wait sample.
+		void record(const SubscriberBase* sub, uint64_t enqueue_ns, uint64_t start_ns, uint64_t end_ns);
+
+		/// Merged timings of every subscriber seen since the last reset().
+		std::vector<CallbackStats> snapshot() const;
+
+		/// Merged timings of `sub` (zeroed if it has not run).
+		CallbackStats stats(const SubscriberBase* sub) const;
+
+		/// Threads that have recorded into this profiler.
+		size_t threadCount() const;
+
+		void reset();
+
+		/// Drop the entries of a destroyed subscriber, so a later one at the
+		/// same address starts clean.
+		void forget(const SubscriberBase* sub);
+
+	private:
+		struct alignas(64) Shard
+		{
+			std::thread::id											 owner;
+			mutable std::mutex										 mutex;
+			std::unordered_map<const SubscriberBase*, CallbackStats> stats;
+			CallbackStats*											 last{nullptr};	// stats[last->subscriber]
+		};
+
+		Shard& localShard();
+
+		const uint64_t						id_;	// tells thread-local caches apart
+		std::atomic<uint64_t>				budget_ns_;
+		SlowCallbackHandler					slow_handler_;
+		mutable std::mutex					shards_mutex_;
+		std::vector<std::unique_ptr<Shard>> shards_;
+	};
+
+} // namespace lux::communication
@@ -7,10 +7,12 @@ namespace lux::communication {
 ///   Intra — same-process shared_ptr zero-copy
 ///   Shm   — same-machine shared-memory ring
 ///   Net   — cross-machine UDP / TCP
+///   Uds   — same-machine Unix domain socket (when SHM is unavailable)
 enum class ChannelKind : uint8_t {
     Intra = 0,
     Shm   = 1,
     Net   = 2,
+    Uds   = 3,
 };
 
 } // namespace lux::communication
@@ -65,29 +65,9 @@ namespace lux::communication
             return default_domain_instance;
         }
 
-        /**
-         * @brief Allocate a range of consecutive sequence numbers for ordered message delivery.
-         * @param n Number of sequence numbers to allocate
-         * @return The base sequence number (first of the allocated range)
-         */
-        uint64_t allocateSeqRange(size_t n)
-        {
-            if (n == 0) return 0;
-            return global_seq_.fetch_add(static_cast<uint64_t>(n), std::memory_order_relaxed);
-        }
-
-        /// Read the current global sequence number (without advancing it).
-        uint64_t currentSeq() const
-        {
-            return global_seq_.load(std::memory_order_relaxed);
-        }
-
     private:
         size_t id_;
 
-        // Global sequence counter for ordered message delivery
-        std::atomic<uint64_t> global_seq_{ 1 };
-
         // Store all Topics
         lux::cxx::AutoSparseSet<std::weak_ptr<TopicBase>> topics_;
 
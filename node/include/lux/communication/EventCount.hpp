@@ -0,0 +1,112 @@
+#pragma once
+
+#include <atomic>
+#include <climits>
+#include <cstdint>
+#include <lux/communication/platform/PlatformDefs.hpp>
+
+namespace lux::communication
+{
+	/// Futex-backed event count: lets a consumer sleep on "some lock-free
+	/// condition became true" without a lost wake-up, while producers pay
+	/// only a fence and one load when nobody sleeps.
+	///
+	/// Consumer:
+	/// @code
+	/// if (!tryTake()) {
+	///     auto key = ec.prepareWait();
+	///     if (tryTake()) ec.cancelWait();   // re-check after announcing
+	///     else           ec.commitWait(key);
+	/// }
+	/// @endcode
+	/// Producer: publish the work, then notifyOne() / notifyAll().
+	///
+	/// A notify that races with prepareWait() either is seen by the
+	/// re-check or bumps the epoch so commitWait() returns at once.
+	/// notifyOne() wakes exactly one sleeping thread; threads between
+	/// prepareWait() and commitWait() may return as well and simply
+	/// re-check.
+	class EventCount
+	{
+	public:
+		using Key = uint32_t;
+
+		EventCount() = default;
+		EventCount(const EventCount&)			 = delete;
+		EventCount& operator=(const EventCount&) = delete;
+
+		/// Count the caller as a waiter.  Re-check the condition afterwards,
+		/// then call commitWait() or cancelWait().
+		Key prepareWait() noexcept
+		{
+			waiters_.fetch_add(1, std::memory_order_seq_cst);
+			std::atomic_thread_fence(std::memory_order_seq_cst);
+			return epoch_.load(std::memory_order_acquire);
+		}
+
+		/// The re-check succeeded: leave without sleeping.
+		void cancelWait() noexcept
+		{
+			waiters_.fetch_sub(1, std::memory_order_relaxed);
+		}
+
+		/// Sleep until a notify issued after prepareWait() returned `key`, or
+		/// until `deadline_ns` (steady ns; UINT64_MAX = none).  Returns false
+		/// on timeout.
+		bool commitWait(Key key, uint64_t deadline_ns = UINT64_MAX) noexcept
+		{
+			bool notified = true;
+			while (epoch_.load(std::memory_order_acquire) == key)
+			{
+				uint64_t timeout_ns = UINT64_MAX;
+				if (deadline_ns != UINT64_MAX)
+				{
+					const uint64_t now = platform::steadyNowNs();
+					if (now >= deadline_ns)
+					{
+						notified = false;
+						break;
+					}
+					timeout_ns = deadline_ns - now;
+				}
+				platform::futexWait(epoch_, key, timeout_ns);
+			}
+			waiters_.fetch_sub(1, std::memory_order_relaxed);
+			return notified;
+		}
+
+		/// Wake one sleeping waiter, if any.
+		void notifyOne() noexcept
+		{
+			notify(1);
+		}
+
+		/// Wake every waiter.
+		void notifyAll() noexcept
+		{
+			notify(INT_MAX);
+		}
+
+		/// Threads between prepareWait() and their return (approximate).
+		uint32_t waiters() const noexcept
+		{
+			return waiters_.load(std::memory_order_relaxed);
+		}
+
+	private:
+		void notify(uint32_t count) noexcept
+		{
+			// Pairs with the fence in prepareWait(): either the waiter sees
+			// the published work, or we see the waiter.
+			std::atomic_thread_fence(std::memory_order_seq_cst);
+			if (waiters_.load(std::memory_order_relaxed) == 0) [[likely]]
+				return;
+			epoch_.fetch_add(1, std::memory_order_release);
+			platform::futexWake(epoch_, count);
+		}
+
+		alignas(64) std::atomic<uint32_t> epoch_{0};	// futex word
+		std::atomic<uint32_t>			  waiters_{0};
+	};
+
+} // namespace lux::communication
@@ -1,43 +1,145 @@
 #pragma once
 
+#include <cstddef>
 #include <cstdint>
 #include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include <lux/communication/MessageTraits.hpp>
 
 namespace lux::communication {
 
     /**
-     * @brief Execution entry for reorder buffer.
-     *        Uses function pointer trampoline instead of std::function for O(1) performance.
+     * @brief Execution entry for reorder buffers.
+     *
+     * Holds the subscriber (type-erased), the message and a static vtable of
+     * function pointers instead of std::function.  The message lives in an
+     * inline buffer sized for SmallValueMsg, so neither a by-value message
+     * nor a shared_ptr<T> needs a heap allocation to become an entry.
+     * Payloads that do not fit (over-aligned types) are boxed on the heap.
      */
     struct ExecEntry {
+        static constexpr size_t kInlineSize  = LUX_SMALL_VALUE_MSG_THRESHOLD;
+        static constexpr size_t kInlineAlign = alignof(std::max_align_t);
+
+        struct VTable {
+            void (*invoke)(void* obj, void* payload);         // payload stays owned by the entry
+            void (*relocate)(void* dst, void* src) noexcept;  // move-construct dst, destroy src
+            void (*destroy)(void* payload) noexcept;
+        };
+
+        template<typename P>
+        static constexpr bool fitsInline =
+            sizeof(P) <= kInlineSize && alignof(P) <= kInlineAlign &&
+            std::is_nothrow_move_constructible_v<P>;
+
         uint64_t seq;
-        void* obj;  // Subscriber pointer (type-erased)
-        void (*invoke)(void* obj, std::shared_ptr<void> msg);  // Takes by value for move semantics
-        std::shared_ptr<void> msg;
+        void*    obj;  // Subscriber pointer (type-erased)
+        /// OrderKey::origin of a message from another process; `seq` then
+        /// holds its stamp instead of an executor sequence number.  0 for
+        /// everything else.
+        uint64_t origin;
 
         ExecEntry() noexcept
-            : seq(0), obj(nullptr), invoke(nullptr), msg(nullptr) {}
+            : seq(0), obj(nullptr), origin(0), vtable_(nullptr) {}
 
-        ExecEntry(uint64_t s, void* o,
-                  void (*inv)(void*, std::shared_ptr<void>),
-                  std::shared_ptr<void> m) noexcept
-            : seq(s), obj(o), invoke(inv), msg(std::move(m)) {}
+        ~ExecEntry() { reset(); }
 
         // Move only
-        ExecEntry(ExecEntry&&) noexcept = default;
-        ExecEntry& operator=(ExecEntry&&) noexcept = default;
+        ExecEntry(ExecEntry&& other) noexcept
+            : seq(other.seq), obj(other.obj), origin(other.origin), vtable_(other.vtable_)
+        {
+            if (vtable_) {
+                vtable_->relocate(storage_, other.storage_);
+                other.vtable_ = nullptr;
+            }
+        }
+
+        ExecEntry& operator=(ExecEntry&& other) noexcept {
+            if (this != &other) {
+                reset();
+                seq     = other.seq;
+                obj     = other.obj;
+                origin  = other.origin;
+                vtable_ = other.vtable_;
+                if (vtable_) {
+                    vtable_->relocate(storage_, other.storage_);
+                    other.vtable_ = nullptr;
+                }
+            }
+            return *this;
+        }
+
         ExecEntry(const ExecEntry&) = delete;
         ExecEntry& operator=(const ExecEntry&) = delete;
 
-        void execute() noexcept {
-            if (invoke) {
-                invoke(obj, std::move(msg));  // Move msg to avoid refcount bump
+        /**
+         * @brief Store a message and the callback that consumes it.
+         * @tparam Invoke  `void(void* obj, P& payload)`; may move from payload.
+         */
+        template<typename P, void (*Invoke)(void*, P&)>
+        void emplace(uint64_t s, void* o, P&& payload) {
+            static_assert(!std::is_reference_v<P>, "ExecEntry::emplace takes an rvalue payload");
+            reset();
+            seq = s;
+            obj = o;
+            if constexpr (fitsInline<P>) {
+                ::new (static_cast<void*>(storage_)) P(std::move(payload));
+                vtable_ = &InlineOps<P, Invoke>::vtable;
+            } else {
+                using Box = std::unique_ptr<P>;
+                ::new (static_cast<void*>(storage_)) Box(std::make_unique<P>(std::move(payload)));
+                vtable_ = &BoxedOps<P, Invoke>::vtable;
+            }
+        }
+
+        void execute() {
+            if (vtable_) {
+                vtable_->invoke(obj, storage_);
+                reset();
+            }
+        }
+
+        void reset() noexcept {
+            if (vtable_) {
+                vtable_->destroy(storage_);
+                vtable_ = nullptr;
             }
         }
 
         explicit operator bool() const noexcept {
-            return invoke != nullptr;
+            return vtable_ != nullptr;
         }
+
+    private:
+        template<typename P>
+        static P& as(void* p) noexcept {
+            return *std::launder(static_cast<P*>(p));
+        }
+
+        template<typename P, void (*Invoke)(void*, P&)>
+        struct InlineOps {
+            static void invoke(void* o, void* p) { Invoke(o, as<P>(p)); }
+            static void relocate(void* dst, void* src) noexcept {
+                ::new (dst) P(std::move(as<P>(src)));
+                as<P>(src).~P();
+            }
+            static void destroy(void* p) noexcept { as<P>(p).~P(); }
+            static constexpr VTable vtable{&invoke, &relocate, &destroy};
+        };
+
+        template<typename P, void (*Invoke)(void*, P&)>
+        struct BoxedOps {
+            using Box = std::unique_ptr<P>;
+            static void invoke(void* o, void* p) { Invoke(o, *as<Box>(p)); }
+            static constexpr VTable vtable{&invoke, &InlineOps<Box, nullptr>::relocate,
+                                           &InlineOps<Box, nullptr>::destroy};
+        };
+
+        const VTable* vtable_;
+        alignas(kInlineAlign) unsigned char storage_[kInlineSize];
     };
 
-} // namespace lux::communication
\ No newline at end of file
+} // namespace lux::communication
@@ -3,13 +3,20 @@
 #include <vector>
 #include <mutex>
 #include <condition_variable>
-#include <semaphore>
 #include <climits>
 #include <atomic>
 #include <memory>
+#include <cstdint>
+#include <chrono>
+#include <algorithm>
 
 #include <lux/communication/CallbackGroupBase.hpp>
+#include <lux/communication/CallbackProfiler.hpp>
+#include <lux/communication/EventCount.hpp>
 #include <lux/communication/Queue.hpp>
+#include <lux/communication/ThreadOptions.hpp>
+#include <lux/communication/TimerWheel.hpp>
+#include <lux/communication/platform/PlatformDefs.hpp>
 #include <lux/communication/visibility.h>
 #include <lux/cxx/container/SparseSet.hpp>
 
@@ -33,6 +40,39 @@ namespace detail {
 	class NodeBase;
 	class CallbackGroupBase;
 	class SubscriberBase;
+	class Timer;
+
+	/// Order in which an executor runs ready subscribers.
+	///
+	/// Producers always publish readiness into the lock-free ready queue.
+	/// Under a non-FIFO policy the consuming side moves those entries into a
+	/// heap and pops the most urgent one, and subscribers run in bounded
+	/// batches (takeSome) so a flooded low-priority topic yields back to the
+	/// heap instead of draining its whole backlog first.
+	///
+	/// SeqOrderedExecutor and TimeOrderedExecutor re-sort messages by
+	/// sequence / timestamp after draining; the policy only affects the order
+	/// in which they drain subscribers.
+	enum class ReadyPolicy : uint8_t
+	{
+		Fifo			 = 0, ///< Readiness order (default; lock-free fast path).
+		Priority		 = 1, ///< Highest SubscribeOptions::priority / group priority first.
+		EarliestDeadline = 2, ///< Earliest (ready time + latency_budget or deadline) first;
+							  ///< subscribers without either follow, by priority.
+	};
+
+	/// What an executor thread does while no subscriber is ready.
+	///
+	/// Parking (blocking in the kernel) costs no CPU but adds a futex wake-up
+	/// to the latency of the next message; spinning in user space catches it
+	/// immediately and lets publishers skip the wake-up syscall, at the price
+	/// of a busy core.
+	enum class WaitPolicy : uint8_t
+	{
+		SpinThenPark = 0, ///< Spin for an adaptive window, then park (default).
+		BusySpin	 = 1, ///< Never park: lowest latency, one core per waiting thread.
+		ParkOnly	 = 2, ///< Park at once: least CPU, wake-up latency on every message.
+	};
 
 	class LUX_COMMUNICATION_PUBLIC ExecutorBase
 	{
@@ -51,78 +91,139 @@ namespace detail {
 			if (!spinning_) {
 				spinning_ = true;
 			}
+			in_spin_.store(true, std::memory_order_release);
+			applyThreadOptions(0, 1);
 
 			while (spinning_)
 			{
 				auto sub = waitOneReady();
 				if (!spinning_)
+				{
+					requeueReady(sub);
 					break;
+				}
 				if (sub)
 				{
 					handleSubscriber(sub);
 				}
 			}
+			in_spin_.store(false, std::memory_order_release);
 		}
 		
 		virtual void stop()
 		{
 			if (spinning_.exchange(false))
 			{
-				ready_sem_.release();
+				ready_ec_.notifyAll();
 				notifyCondition();
 			}
 		}
 
+		/// Make one waitOneReady() return (nullptr) even if nothing is ready.
 		void wakeup()
 		{
-			ready_sem_.release();
+			ready_queue_.enqueue(nullptr);
+			ready_ec_.notifyOne();
 		}
 
-		SubscriberBase* waitOneReady()
+		/// Select how ready subscribers are ordered.  Call before spin().
+		/// @param batch  Callbacks run per subscriber before it is re-queued
+		///               (non-FIFO policies only).
+		void setReadyPolicy(ReadyPolicy policy, size_t batch = kDefaultReadyBatch)
 		{
-			// Phase 1: user-space spin — avoids kernel semaphore syscalls.
-			spinning_in_userspace_.store(true, std::memory_order_seq_cst);
-			for (uint32_t i = 0; i < kSpinIterations; ++i) {
-				SubscriberBase* sub = nullptr;
-				if (ready_queue_.try_dequeue(sub)) {
-					spinning_in_userspace_.store(false, std::memory_order_seq_cst);
-					return sub;
-				}
-				detail::cpu_pause();
-			}
-			spinning_in_userspace_.store(false, std::memory_order_seq_cst);
+			ready_batch_ = batch ? batch : 1;
+			ready_policy_.store(policy, std::memory_order_release);
+		}
 
-			// Final drain: catch items enqueued while clearing the flag.
-			{
-				SubscriberBase* sub = nullptr;
-				if (ready_queue_.try_dequeue(sub)) return sub;
-			}
+		ReadyPolicy readyPolicy() const
+		{
+			return ready_policy_.load(std::memory_order_acquire);
+		}
 
-			// Phase 2: kernel block.
-			ready_sem_.acquire();
-			SubscriberBase* sub = nullptr;
-			ready_queue_.try_dequeue(sub);
-			return sub;
+		/// Select how idle executor threads wait for work.  Takes effect at the
+		/// next wait.
+		void setWaitPolicy(WaitPolicy policy)
+		{
+			wait_policy_.store(policy, std::memory_order_relaxed);
 		}
 
-		SubscriberBase* waitOneReadyTimeout(std::chrono::milliseconds timeout)
+		WaitPolicy waitPolicy() const
 		{
-			if (ready_sem_.try_acquire_for(timeout)) {
-				SubscriberBase* sub = nullptr;
-				ready_queue_.try_dequeue(sub);
-				return sub;
-			}
-			return nullptr;
+			return wait_policy_.load(std::memory_order_relaxed);
+		}
+
+		/// How long (ns) an idle thread currently spins before parking:
+		/// UINT64_MAX under BusySpin, 0 under ParkOnly.
+		///
+		/// Under SpinThenPark the window follows the observed wait between
+		/// arrivals (twice its moving average, so a steady stream is caught
+		/// in user space) and collapses to kMinSpinNs when arrivals are too
+		/// far apart for spinning to pay off.  It is capped at kMaxSpinNs, or
+		/// at kTightSpinNs while an attached subscriber has a latency budget
+		/// below kParkLatencyNs, which a park / wake-up cycle would exceed.
+		uint64_t spinWindowNs() const;
+
+		/// Smallest QoSProfile::latency_budget (ns) among the subscribers
+		/// attached to this executor; 0 if none sets one.
+		uint64_t minLatencyBudgetNs() const
+		{
+			const uint64_t budget = min_latency_budget_ns_.load(std::memory_order_relaxed);
+			return budget == UINT64_MAX ? 0 : budget;
+		}
+
+		/// CPU set, scheduling policy and name for the threads that run
+		/// spin() (the calling thread and any workers).  Call before spin().
+		void setThreadOptions(const ThreadOptions& opts)
+		{
+			thread_opts_ = opts;
 		}
 
-		void enqueueReady(SubscriberBase* sub)
+		const ThreadOptions& threadOptions() const
 		{
+			return thread_opts_;
+		}
+
+		/// Threads on which a ThreadOptions setting could not be applied.
+		uint32_t threadOptionErrors() const
+		{
+			return thread_option_errors_.load(std::memory_order_relaxed);
+		}
+
+		/// Record queue-wait and execution-time histograms per subscriber
+		/// from now on (see CallbackProfiler).  Callbacks running longer than
+		/// `budget` (0 = none) are counted as over budget.  Calling it again
+		/// keeps the data and only changes the budget.
+		void enableProfiling(std::chrono::nanoseconds budget = std::chrono::nanoseconds(0));
+
+		/// The callback profiler; nullptr until enableProfiling().
+		CallbackProfiler* profiler() const
+		{
+			return profiler_.load(std::memory_order_acquire);
+		}
+
+		/// Arm `timer` at now + period on this executor's timing wheel (moves
+		/// it if already armed).  Called by Timer; wakes a blocked spin() if
+		/// the timer is now the earliest deadline.
+		void addTimer(Timer* timer);
+
+		/// Disarm `timer`.  Called by Timer.
+		void removeTimer(Timer* timer);
+
+		/// Number of armed timers.
+		size_t timerCount() const;
+
+		/// Next ready subscriber, waiting for one according to the
+		/// WaitPolicy.  May return nullptr (stop(), timer-only wake-up).
+		SubscriberBase* waitOneReady();
+
+		SubscriberBase* waitOneReadyTimeout(std::chrono::nanoseconds timeout);
+
+		virtual void enqueueReady(SubscriberBase* sub)
+		{
+			stampReady(sub);
 			ready_queue_.enqueue(sub);
-			// If executor is spin-polling in user-space, skip the kernel semaphore call.
-			// seq_cst ordering guarantees correct visibility (see waitOneReady).
-			if (!spinning_in_userspace_.load(std::memory_order_seq_cst)) {
-				ready_sem_.release();
-			}
+			// One load unless a consumer is parked (see waitOneReady()).
+			ready_ec_.notifyOne();
 		}
 
 		/// Allocate a per-executor sequence number for ordered delivery.
@@ -134,6 +235,25 @@ namespace detail {
 			return exec_seq_.fetch_add(1, std::memory_order_relaxed);
 		}
 
+		/// Allocate `n` consecutive sequence numbers; returns the first.
+		uint64_t allocateSeqRange(size_t n)
+		{
+			return exec_seq_.fetch_add(static_cast<uint64_t>(n), std::memory_order_relaxed);
+		}
+
+		/// A sequence number from allocateSeq() will never be delivered
+		/// (content filter, KeepLast overflow, lifespan).  Called from any
+		/// thread; SeqOrderedExecutor skips it instead of waiting for it.
+		virtual void seqConsumed(uint64_t /*seq*/) {}
+
+		/// True if subscribers must stamp every intra-process message with its
+		/// publish time (TimeOrderedExecutor merges on it; the profiler
+		/// measures queue wait from it).
+		bool needsTimestamps() const
+		{
+			return needs_timestamps_ || profiler() != nullptr;
+		}
+
 	protected:
 		using NodeList	 = lux::cxx::AutoSparseSet<NodeBase*>;
 		using ReadyQueue = moodycamel::ConcurrentQueue<SubscriberBase*>;
@@ -141,27 +261,185 @@ namespace detail {
 		NodeList							nodes_;
 		std::mutex							nodes_mutex_;
 		ReadyQueue							ready_queue_;
-		std::counting_semaphore<INT_MAX>	ready_sem_{ 0 };
+		/// Parked consumers of ready_queue_.  Producers notify after every
+		/// enqueue; the call is a fence and a load while nobody sleeps.
+		EventCount							ready_ec_;
+
+		/// Bounds of the SpinThenPark window (see spinWindowNs()).
+		static constexpr uint64_t kMinSpinNs   = 1'000;
+		static constexpr uint64_t kMaxSpinNs   = 100'000;
+		static constexpr uint64_t kTightSpinNs = 1'000'000;
 
-		/// True while waitOneReady() is in its user-space spin loop.
-		/// enqueueReady() reads this to decide whether to skip sem.release().
-		std::atomic<bool>					spinning_in_userspace_{ false };
+		/// Latency budgets below this cannot absorb parking: a futex wake-up
+		/// plus the reschedule of the woken thread.
+		static constexpr uint64_t kParkLatencyNs = 100'000;
 
-		/// Number of spin iterations before falling back to kernel semaphore.
-		/// ~4096 × _mm_pause (~40ns each on Skylake+) ≈ 160μs max spin time.
-		static constexpr uint32_t kSpinIterations = 4096;
+		/// waitUntil() wakes this long before the next timer expiry and
+		/// leaves the rest to the user-space spin.
+		static constexpr uint64_t kTimerLeadNs = 50'000;
 
 	protected:
+		/// Next ready subscriber according to the ReadyPolicy.
+		bool tryDequeueReady(SubscriberBase*& out)
+		{
+			if (ready_policy_.load(std::memory_order_relaxed) == ReadyPolicy::Fifo) [[likely]]
+				return ready_queue_.try_dequeue(out);
+			return tryDequeuePrioritized(out);
+		}
+
+		/// True if the ready queue or the priority heap holds an entry.
+		bool hasReady() const
+		{
+			return ready_queue_.size_approx() > 0 ||
+				   ready_heap_size_.load(std::memory_order_relaxed) > 0;
+		}
+
+		/// Put back a subscriber dequeued just as spin() stops; its ready flag
+		/// stays set, so dropping it would silence it for good.
+		void requeueReady(SubscriberBase* sub)
+		{
+			if (sub)
+				ready_queue_.enqueue(sub);
+		}
+
+		/// Run a ready subscriber: everything under Fifo, one batch otherwise.
+		void takeReady(SubscriberBase* sub);
+
+		/// Record when a subscriber became ready (EarliestDeadline only).
+		void stampReady(SubscriberBase* sub);
+
+		/// Fire every due timer.  Cheap when no timer is armed; executors call
+		/// it wherever they look for ready work.
+		void pollTimers()
+		{
+			if (next_timer_ns_.load(std::memory_order_acquire) != UINT64_MAX) [[unlikely]]
+				expireTimers();
+		}
+
+		/// Steady time (ns) of the next timer expiry; UINT64_MAX if none.
+		uint64_t nextTimerNs() const
+		{
+			return next_timer_ns_.load(std::memory_order_acquire);
+		}
+
+		/// Commit a wait prepared on `ec` with `key`: sleep until notified,
+		/// until `deadline_ns` (steady ns; UINT64_MAX = none) or until the
+		/// next timer expiry, whichever comes first.  Returns true if notified.
+		bool waitUntil(EventCount& ec, EventCount::Key key, uint64_t deadline_ns);
+
+		/// Wake a thread blocked in waitUntil() so it re-reads the next
+		/// timer expiry.  Executors that park on their own event count override.
+		virtual void wakeForTimers()
+		{
+			ready_ec_.notifyOne();
+		}
+
+		/// Spin while `poll()` finds no work, for at most the spin window
+		/// starting at `start_ns` and never past `deadline_ns`; fires due
+		/// timers on the way.  Returns true once `poll()` succeeds, false
+		/// when the thread should park (or attend to its deadline).  The wait
+		/// is recorded for the adaptive window on success.
+		template<typename Poll>
+		bool spinWait(Poll&& poll, uint64_t start_ns, uint64_t deadline_ns = UINT64_MAX)
+		{
+			const uint64_t window = spinWindowNs();
+			if (window == 0)
+				return false;
+			const uint64_t until = std::min(deadline_ns, window == UINT64_MAX ? UINT64_MAX : start_ns + window);
+
+			for (uint32_t i = 1;; ++i)
+			{
+				if (poll())
+				{
+					recordWait(platform::steadyNowNs() - start_ns);
+					return true;
+				}
+				detail::cpu_pause();
+				if ((i & 63) == 0)
+				{
+					pollTimers();
+					if (!spinning_.load(std::memory_order_relaxed) ||
+						platform::steadyNowNs() >= until)
+						return false;
+				}
+			}
+		}
+
+		/// Feed the time a thread waited for work into the adaptive window.
+		void recordWait(uint64_t waited_ns)
+		{
+			// Moving average with weight 1/8; a lost update between threads
+			// of a pool only delays convergence.
+			const uint64_t avg = wait_avg_ns_.load(std::memory_order_relaxed);
+			wait_avg_ns_.store(avg - avg / 8 + waited_ns / 8, std::memory_order_relaxed);
+		}
+
+		/// Apply the ThreadOptions to the calling thread, worker `index` of
+		/// `count`.  Failures are reported on stderr and counted, never fatal.
+		bool applyThreadOptions(size_t index, size_t count);
+
 		void			waitCondition();
 		void			notifyCondition();
 		virtual bool	checkRunnable();
 
 		std::atomic<bool>						spinning_{ false };
+		/// True while a thread is inside spin(); destructors wait for it to
+		/// leave before freeing what it may still touch after stop().
+		std::atomic<bool>						in_spin_{ false };
 		std::mutex								cv_mutex_;
 		std::condition_variable					cv_;
 
 		/// Per-executor sequence counter (used by SeqOrderedExecutor).
 		std::atomic<uint64_t>					exec_seq_{ 1 };
+
+		/// See needsTimestamps().  Set once by the derived constructor.
+		bool									needs_timestamps_{ false };
+
+		static constexpr size_t kDefaultReadyBatch = 32;
+
+	private:
+		friend class SubscriberBase;
+		friend class CallbackGroupBase;
+
+		struct ReadyEntry
+		{
+			uint64_t		deadline; // absolute ns; UINT64_MAX = none / unused
+			int64_t			rank;	  // negated priority
+			uint64_t		order;	  // FIFO tie-break
+			SubscriberBase* sub;
+		};
+
+		bool tryDequeuePrioritized(SubscriberBase*& out);
+		void expireTimers();
+		void advanceTimers(uint64_t now_ns);	// timer_mutex_ held
+
+		/// A subscriber with this latency budget (ns; 0 = none) is attached.
+		void noteLatencyBudget(uint64_t budget_ns);
+		/// Recompute the smallest budget over the attached nodes.
+		void refreshLatencyBudget();	// nodes_mutex_ held
+
+		ThreadOptions				thread_opts_;
+		std::atomic<uint32_t>		thread_option_errors_{ 0 };
+
+		std::atomic<ReadyPolicy>	ready_policy_{ ReadyPolicy::Fifo };
+		size_t						ready_batch_{ kDefaultReadyBatch };
+		std::mutex					ready_heap_mutex_;
+		std::vector<ReadyEntry>		ready_heap_;
+		uint64_t					ready_order_{ 0 };
+		std::atomic<size_t>			ready_heap_size_{ 0 };
+
+		mutable std::mutex					timer_mutex_;
+		TimerWheel							timer_wheel_;
+		std::vector<TimerWheel::Entry*>		expired_timers_;
+		std::atomic<uint64_t>				next_timer_ns_{ UINT64_MAX };
+
+		std::atomic<WaitPolicy>		wait_policy_{ WaitPolicy::SpinThenPark };
+		std::atomic<uint64_t>		wait_avg_ns_{ kMaxSpinNs / 2 };	// starts at a full window
+		std::atomic<uint64_t>		min_latency_budget_ns_{ UINT64_MAX };
+
+		std::mutex							profiler_mutex_;
+		std::unique_ptr<CallbackProfiler>	profiler_owner_;
+		std::atomic<CallbackProfiler*>		profiler_{ nullptr };
 	};
 
 } // namespace lux::communication
@@ -0,0 +1,332 @@
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+#include <lux/communication/visibility.h>
+
+namespace lux::communication
+{
+	enum class CompareOp : uint8_t
+	{
+		Eq,
+		Ne,
+		Lt,
+		Le,
+		Gt,
+		Ge,
+	};
+
+	/// In-memory type of a field compared at a byte offset.
+	enum class FieldType : uint8_t
+	{
+		I8,
+		U8,
+		I16,
+		U16,
+		I32,
+		U32,
+		I64,
+		U64,
+		F32,
+		F64,
+	};
+
+	/// Named fields of message type T, read through an accessor.  Lets a
+	/// FieldFilter test types that are not trivially copyable (protobuf,
+	/// user serializers).  Register the same names in the publishing and
+	/// the subscribing process; a publisher that does not know a name lets
+	/// the message through and the subscriber filters it.
+	template<typename T>
+	class FilterFields
+	{
+	public:
+		using Getter = double (*)(const T&);
+
+		static void add(std::string name, Getter getter)
+		{
+			std::lock_guard<std::mutex> lock(mutex());
+			map()[std::move(name)] = getter;
+		}
+
+		static Getter find(const std::string& name)
+		{
+			std::lock_guard<std::mutex> lock(mutex());
+			auto it = map().find(name);
+			return it != map().end() ? it->second : nullptr;
+		}
+
+	private:
+		static std::mutex& mutex()
+		{
+			static std::mutex m;
+			return m;
+		}
+
+		static std::unordered_map<std::string, Getter>& map()
+		{
+			static std::unordered_map<std::string, Getter> m;
+			return m;
+		}
+	};
+
+	/// Declarative content filter that a subscriber pushes down to its
+	/// publishers.
+	///
+	/// A conjunction of field comparisons plus an optional sampling
+	/// interval.  Unlike the ContentFilter callback it is plain data: the
+	/// subscriber announces encode() through discovery and every SHM /
+	/// network publisher evaluates it before serializing or sending to that
+	/// peer, so rejected messages never cross the process boundary.  The
+	/// subscriber applies it again on receipt (and on the intra path).
+	///
+	/// Fields are either members of a trivially copyable, standard-layout
+	/// message, compared at their byte offset, or names registered with
+	/// FilterFields<T>.  Sampling passes a message only if at least
+	/// `interval` has elapsed (by publish timestamp) since the last message
+	/// that passed, like DDS TIME_BASED_FILTER.
+	class LUX_COMMUNICATION_PUBLIC FieldFilter
+	{
+	public:
+		/// Longest encoding discovery carries; a longer filter is applied by
+		/// the subscriber only.
+		static constexpr size_t kMaxEncodedSize = 31;
+
+		struct Predicate
+		{
+			std::string name;		   // registered field; empty = at `offset`
+			uint32_t	offset{0};
+			FieldType	type{FieldType::F64};
+			CompareOp	op{CompareOp::Eq};
+			int64_t		int_value{0};  // I8..I64
+			uint64_t	uint_value{0}; // U8..U64
+			double		real_value{0}; // F32, F64, named fields
+			void (*getter)(){nullptr}; // FilterFields<T>::Getter once resolved
+		};
+
+		/// Compare a member of a trivially copyable message:
+		/// `where(&Pose::x, CompareOp::Gt, 1.0)`.
+		template<typename T, typename M>
+			requires std::is_trivially_copyable_v<T> && std::is_standard_layout_v<T> &&
+					 (std::is_arithmetic_v<M> || std::is_enum_v<M>)
+		FieldFilter& where(M T::* member, CompareOp op, std::type_identity_t<M> value)
+		{
+			Predicate p;
+			p.offset = offsetOf(member);
+			p.op	 = op;
+			if constexpr (std::is_enum_v<M>)
+				setValue(p, static_cast<std::underlying_type_t<M>>(value));
+			else
+				setValue(p, value);
+			predicates_.push_back(std::move(p));
+			return *this;
+		}
+
+		/// Compare a field registered with FilterFields<T>.  Names are
+		/// [A-Za-z0-9_.]; others make the filter subscriber-only.
+		FieldFilter& where(std::string name, CompareOp op, double value);
+
+		/// Pass at most one message per `interval`.
+		FieldFilter& minInterval(std::chrono::nanoseconds interval)
+		{
+			interval_ns_ = interval.count() > 0 ? static_cast<uint64_t>(interval.count()) : 0;
+			return *this;
+		}
+
+		bool empty() const
+		{
+			return predicates_.empty() && interval_ns_ == 0;
+		}
+
+		const std::vector<Predicate>& predicates() const
+		{
+			return predicates_;
+		}
+
+		uint64_t minIntervalNs() const
+		{
+			return interval_ns_;
+		}
+
+		/// Look up the named fields in FilterFields<T>; call once before
+		/// matches<T>().  Names not registered (yet) pass.
+		template<typename T>
+		void resolve()
+		{
+			for (auto& p : predicates_)
+			{
+				if (!p.name.empty())
+					p.getter = reinterpret_cast<void (*)()>(FilterFields<T>::find(p.name));
+			}
+		}
+
+		/// Field predicates only; sampling is up to the caller (sampled()).
+		/// A predicate that cannot be evaluated for T passes.
+		template<typename T>
+		bool matches(const T& msg) const
+		{
+			for (const auto& p : predicates_)
+			{
+				if (!p.name.empty())
+				{
+					if (!p.getter)
+						continue;
+					const auto getter = reinterpret_cast<typename FilterFields<T>::Getter>(p.getter);
+					if (!compare(getter(msg), p.op, p.real_value))
+						return false;
+				}
+				else if constexpr (std::is_trivially_copyable_v<T>)
+				{
+					if (p.offset + sizeOf(p.type) > sizeof(T))
+						continue;
+					if (!testRaw(reinterpret_cast<const char*>(&msg) + p.offset, p))
+						return false;
+				}
+			}
+			return true;
+		}
+
+		/// Sampling step for one evaluator: true (and `last_pass_ns` updated)
+		/// if `ts_ns` is at least the interval past the last pass.
+		bool sampled(uint64_t ts_ns, uint64_t& last_pass_ns) const
+		{
+			if (interval_ns_ == 0)
+				return true;
+			if (last_pass_ns != 0 && ts_ns < last_pass_ns + interval_ns_)
+				return false;
+			last_pass_ns = ts_ns;
+			return true;
+		}
+
+		/// Compact text form for discovery, e.g. "@8d>2.5,~100000000".
+		/// Empty for an empty filter, and for one that is longer than
+		/// kMaxEncodedSize or has an invalid name.
+		std::string encode() const;
+
+		/// Parse encode() output.  False (and `out` untouched) on malformed
+		/// input.
+		static bool decode(std::string_view text, FieldFilter& out);
+
+	private:
+		template<typename T, typename M>
+		static uint32_t offsetOf(M T::* member)
+		{
+			union Probe
+			{
+				char c;
+				T	 t;
+				Probe() : c(0) {}
+			} probe;
+			return static_cast<uint32_t>(reinterpret_cast<const char*>(&(probe.t.*member)) -
+										 reinterpret_cast<const char*>(&probe.t));
+		}
+
+		template<typename M>
+		static void setValue(Predicate& p, M value)
+		{
+			if constexpr (std::is_floating_point_v<M>)
+			{
+				p.type		 = sizeof(M) == 4 ? FieldType::F32 : FieldType::F64;
+				p.real_value = static_cast<double>(value);
+			}
+			else if constexpr (std::is_signed_v<M>)
+			{
+				p.type = sizeof(M) == 1 ? FieldType::I8 : sizeof(M) == 2 ? FieldType::I16 : sizeof(M) == 4 ? FieldType::I32 : FieldType::I64;
+				p.int_value = static_cast<int64_t>(value);
+			}
+			else
+			{
+				p.type = sizeof(M) == 1 ? FieldType::U8 : sizeof(M) == 2 ? FieldType::U16 : sizeof(M) == 4 ? FieldType::U32 : FieldType::U64;
+				p.uint_value = static_cast<uint64_t>(value);
+			}
+		}
+
+		static size_t sizeOf(FieldType type)
+		{
+			switch (type)
+			{
+			case FieldType::I8:
+			case FieldType::U8:
+				return 1;
+			case FieldType::I16:
+			case FieldType::U16:
+				return 2;
+			case FieldType::I32:
+			case FieldType::U32:
+			case FieldType::F32:
+				return 4;
+			default:
+				return 8;
+			}
+		}
+
+		template<typename V>
+		static bool compare(V lhs, CompareOp op, V rhs)
+		{
+			switch (op)
+			{
+			case CompareOp::Eq:
+				return lhs == rhs;
+			case CompareOp::Ne:
+				return lhs != rhs;
+			case CompareOp::Lt:
+				return lhs < rhs;
+			case CompareOp::Le:
+				return lhs <= rhs;
+			case CompareOp::Gt:
+				return lhs > rhs;
+			case CompareOp::Ge:
+				return lhs >= rhs;
+			}
+			return true;
+		}
+
+		template<typename V>
+		static V load(const char* field)
+		{
+			V v;
+			std::memcpy(&v, field, sizeof(V));
+			return v;
+		}
+
+		static bool testRaw(const char* field, const Predicate& p)
+		{
+			switch (p.type)
+			{
+			case FieldType::I8:
+				return compare<int64_t>(load<int8_t>(field), p.op, p.int_value);
+			case FieldType::U8:
+				return compare<uint64_t>(load<uint8_t>(field), p.op, p.uint_value);
+			case FieldType::I16:
+				return compare<int64_t>(load<int16_t>(field), p.op, p.int_value);
+			case FieldType::U16:
+				return compare<uint64_t>(load<uint16_t>(field), p.op, p.uint_value);
+			case FieldType::I32:
+				return compare<int64_t>(load<int32_t>(field), p.op, p.int_value);
+			case FieldType::U32:
+				return compare<uint64_t>(load<uint32_t>(field), p.op, p.uint_value);
+			case FieldType::I64:
+				return compare<int64_t>(load<int64_t>(field), p.op, p.int_value);
+			case FieldType::U64:
+				return compare<uint64_t>(load<uint64_t>(field), p.op, p.uint_value);
+			case FieldType::F32:
+				return compare<float>(load<float>(field), p.op, static_cast<float>(p.real_value));
+			case FieldType::F64:
+				return compare<double>(load<double>(field), p.op, p.real_value);
+			}
+			return true;
+		}
+
+		std::vector<Predicate> predicates_;
+		uint64_t			   interval_ns_{0};
+	};
+
+} // namespace lux::communication
@@ -0,0 +1,74 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <compare>
+#include <cstdint>
+#include <string_view>
+
+#include <lux/communication/Hash.hpp>
+
+namespace lux::communication
+{
+	/// Hybrid logical clock of one publisher.
+	///
+	/// Stamps follow the steady clock but never repeat or go backwards: when
+	/// the clock has not moved past the last stamp, the logical part (the
+	/// low end of the same 64 bits) counts on from it.  Each publisher owns
+	/// one, so stamping never shares a cache line between topics.
+	///
+	/// Stamps order one publisher's messages.  Across publishers they are
+	/// comparable on one host (same steady clock) and may be equal; OrderKey
+	/// breaks the ties.
+	class HybridClock
+	{
+	public:
+		/// Reserve `n` consecutive stamps at or after `now_ns`; returns the
+		/// first.
+		uint64_t tick(uint64_t now_ns, uint64_t n = 1)
+		{
+			uint64_t last = last_.load(std::memory_order_relaxed);
+			for (;;)
+			{
+				const uint64_t first = std::max(now_ns, last + 1);
+				if (last_.compare_exchange_weak(last, first + n - 1, std::memory_order_relaxed))
+					return first;
+			}
+		}
+
+		/// Last stamp handed out (0 = none yet).
+		uint64_t last() const
+		{
+			return last_.load(std::memory_order_relaxed);
+		}
+
+	private:
+		std::atomic<uint64_t> last_{0};
+	};
+
+	/// Order of a message among the publishers of all processes: the hybrid
+	/// stamp, then the publisher id, then the sending process (host / pid
+	/// tag) for equal ids in different processes.  Across hosts the key is
+	/// still a total order, but stamps follow each host's own clock.
+	struct OrderKey
+	{
+		uint64_t stamp{0};
+		uint64_t origin{0}; // publisher id << 32 | process tag; 0 = none
+
+		static uint64_t makeOrigin(uint32_t publisher_id, uint32_t process_tag)
+		{
+			return static_cast<uint64_t>(publisher_id) << 32 | process_tag;
+		}
+
+		auto operator<=>(const OrderKey&) const = default;
+	};
+
+	/// Tag of a sending process for OrderKey::origin; never 0.
+	inline uint32_t processTag(std::string_view host, uint32_t pid)
+	{
+		const uint64_t h   = fnv1a_64(host) ^ (pid * 0x9E3779B97F4A7C15ull);
+		const uint32_t tag = static_cast<uint32_t>(h ^ (h >> 32));
+		return tag ? tag : 1;
+	}
+
+} // namespace lux::communication
@@ -47,6 +47,10 @@ public:
 
     bool isRunning() const { return running_.load(std::memory_order_relaxed); }
 
+    /// True once the IO thread has tried NodeOptions::io_thread and some
+    /// setting could not be applied (details on stderr).
+    bool threadOptionsFailed() const { return thread_opts_failed_.load(std::memory_order_relaxed); }
+
 private:
     void ioLoop();
 
@@ -64,6 +68,7 @@ private:
 
     std::thread       io_thread_;
     std::atomic<bool> running_{false};
+    std::atomic<bool> thread_opts_failed_{false};
 };
 
 } // namespace lux::communication
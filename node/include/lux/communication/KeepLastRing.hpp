@@ -0,0 +1,176 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <thread>
+#include <type_traits>
+
+namespace lux::communication
+{
+	/// Bounded overwrite-oldest queue backing History::KeepLast.
+	///
+	/// A slot-sequenced ring (Vyukov's bounded MPMC queue) of exactly
+	/// `depth` slots.  Producers, whether intra-process publishers or the
+	/// IoThread delivering SHM / network frames, never block: a push that
+	/// finds the ring full pops the oldest entry itself and retries, so the
+	/// ring never holds more than `depth` entries and every eviction is
+	/// counted once.  The consumer is the executor thread taking the
+	/// subscriber.
+	///
+	/// Slot stamps advance by two per use (2*pos free for the push of
+	/// `pos`, 2*pos+1 filled), so a full slot never looks free to the next
+	/// lap even when depth is 1.
+	template<typename T>
+		requires std::is_default_constructible_v<T> && std::is_nothrow_move_assignable_v<T>
+	class KeepLastRing
+	{
+	public:
+		explicit KeepLastRing(size_t depth)
+			: capacity_(depth ? depth : 1),
+			  mask_((capacity_ & (capacity_ - 1)) == 0 ? capacity_ - 1 : SIZE_MAX),
+			  cells_(std::make_unique<Cell[]>(capacity_))
+		{
+			for (size_t i = 0; i < capacity_; ++i)
+				cells_[i].seq.store(2 * i, std::memory_order_relaxed);
+		}
+
+		KeepLastRing(const KeepLastRing&)			 = delete;
+		KeepLastRing& operator=(const KeepLastRing&) = delete;
+
+		/// Append `value`, first evicting the oldest entries while the ring
+		/// is full; each evicted entry is passed to `on_evict(T&&)`.  Usually
+		/// one, more if other producers keep refilling the freed slot.
+		/// @return number of entries evicted.
+		template<typename OnEvict>
+		size_t push(T value, OnEvict&& on_evict)
+		{
+			size_t evicted = 0;
+			T	   victim{};
+			for (unsigned spins = 0; !tryPush(value); ++spins)
+			{
+				// Evict only when the ring is logically full; otherwise a
+				// pop is just finishing with its slot.
+				const size_t head = head_.load(std::memory_order_acquire);
+				const size_t tail = tail_.load(std::memory_order_acquire);
+				if (tail - head >= capacity_ && tryPop(victim))
+				{
+					++evicted;
+					dropped_.fetch_add(1, std::memory_order_relaxed);
+					on_evict(std::move(victim));
+					continue;
+				}
+				if ((spins & 63) == 63)
+					std::this_thread::yield(); // a preempted thread owns a slot
+			}
+			return evicted;
+		}
+
+		/// Pop the oldest entry.
+		bool tryPop(T& out)
+		{
+			size_t pos = head_.load(std::memory_order_relaxed);
+			for (;;)
+			{
+				Cell&		 cell = cells_[index(pos)];
+				const size_t seq  = cell.seq.load(std::memory_order_acquire);
+				const auto	 dif  = static_cast<intptr_t>(seq) - static_cast<intptr_t>(2 * pos + 1);
+				if (dif == 0)
+				{
+					if (head_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+					{
+						out = std::move(cell.value);
+						cell.seq.store(2 * (pos + capacity_), std::memory_order_release);
+						return true;
+					}
+				}
+				else if (dif < 0)
+				{
+					return false; // empty (or the head is still being written)
+				}
+				else
+				{
+					pos = head_.load(std::memory_order_relaxed);
+				}
+			}
+		}
+
+		/// Pop up to `max_count` entries into `out`.
+		size_t tryPopBulk(T* out, size_t max_count)
+		{
+			size_t n = 0;
+			while (n < max_count && tryPop(out[n]))
+				++n;
+			return n;
+		}
+
+		/// Entries queued; exact while no push or pop is in flight.
+		size_t sizeApprox() const
+		{
+			const size_t head = head_.load(std::memory_order_acquire);
+			const size_t tail = tail_.load(std::memory_order_acquire);
+			const size_t n	  = tail > head ? tail - head : 0;
+			return n < capacity_ ? n : capacity_;
+		}
+
+		size_t capacity() const
+		{
+			return capacity_;
+		}
+
+		/// Entries evicted by a push into a full ring.
+		uint64_t dropped() const
+		{
+			return dropped_.load(std::memory_order_relaxed);
+		}
+
+	private:
+		struct Cell
+		{
+			std::atomic<size_t> seq{0};
+			T					value{};
+		};
+
+		size_t index(size_t pos) const
+		{
+			return mask_ != SIZE_MAX ? (pos & mask_) : pos % capacity_;
+		}
+
+		bool tryPush(T& value)
+		{
+			size_t pos = tail_.load(std::memory_order_relaxed);
+			for (;;)
+			{
+				Cell&		 cell = cells_[index(pos)];
+				const size_t seq  = cell.seq.load(std::memory_order_acquire);
+				const auto	 dif  = static_cast<intptr_t>(seq) - static_cast<intptr_t>(2 * pos);
+				if (dif == 0)
+				{
+					if (tail_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+					{
+						cell.value = std::move(value);
+						cell.seq.store(2 * pos + 1, std::memory_order_release);
+						return true;
+					}
+				}
+				else if (dif < 0)
+				{
+					return false; // full (or a pop is still releasing the slot)
+				}
+				else
+				{
+					pos = tail_.load(std::memory_order_relaxed);
+				}
+			}
+		}
+
+		const size_t			 capacity_;
+		const size_t			 mask_; // capacity_ - 1 for powers of two, else SIZE_MAX
+		std::unique_ptr<Cell[]>	 cells_;
+		alignas(64) std::atomic<size_t> head_{0};
+		alignas(64) std::atomic<size_t> tail_{0};
+		alignas(64) std::atomic<uint64_t> dropped_{0};
+	};
+
+} // namespace lux::communication
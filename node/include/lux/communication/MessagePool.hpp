@@ -0,0 +1,160 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <vector>
+
+namespace lux::communication
+{
+	/// Recycling pool of received messages.
+	///
+	/// acquire() hands out a shared_ptr<T> whose deleter puts the object
+	/// back instead of destroying it, so the next deserialize into it finds
+	/// the vectors, strings and protobuf fields of the previous message
+	/// with their capacity intact.  The shared_ptr control blocks are
+	/// recycled as well: once the pool holds as many idle objects as are
+	/// in flight, receiving a message of stable size allocates nothing.
+	///
+	/// A returned object keeps its old contents; the deserializer must
+	/// overwrite it (protobuf ParseFromArray clears first, lux_deserialize
+	/// should assign rather than append).  Objects and blocks beyond
+	/// `max_idle` are freed.  Outstanding messages keep the pool alive, so
+	/// the owner may go away first.
+	template<typename T>
+	class MessagePool : public std::enable_shared_from_this<MessagePool<T>>
+	{
+	public:
+		static std::shared_ptr<MessagePool> create(size_t max_idle)
+		{
+			return std::shared_ptr<MessagePool>(new MessagePool(max_idle));
+		}
+
+		~MessagePool()
+		{
+			for (T* obj : idle_)
+				delete obj;
+			for (void* block : blocks_)
+				::operator delete(block);
+		}
+
+		MessagePool(const MessagePool&)			   = delete;
+		MessagePool& operator=(const MessagePool&) = delete;
+
+		/// A recycled object if one is idle, else a default-constructed one.
+		std::shared_ptr<T> acquire()
+		{
+			T* obj = nullptr;
+			{
+				std::lock_guard<std::mutex> lock(mutex_);
+				if (!idle_.empty())
+				{
+					obj = idle_.back();
+					idle_.pop_back();
+				}
+			}
+			if (!obj)
+				obj = new T();
+			return std::shared_ptr<T>(obj, Recycler{this}, BlockAllocator<T>(this->shared_from_this()));
+		}
+
+		/// Objects waiting to be reused.
+		size_t idleCount() const
+		{
+			std::lock_guard<std::mutex> lock(mutex_);
+			return idle_.size();
+		}
+
+		size_t maxIdle() const
+		{
+			return max_idle_;
+		}
+
+	private:
+		explicit MessagePool(size_t max_idle) : max_idle_(max_idle)
+		{
+			idle_.reserve(max_idle);
+			blocks_.reserve(max_idle);
+		}
+
+		/// shared_ptr deleter: return the object to the pool.
+		struct Recycler
+		{
+			MessagePool* pool; // kept alive by the control block's allocator
+
+			void operator()(T* obj) const
+			{
+				{
+					std::lock_guard<std::mutex> lock(pool->mutex_);
+					if (pool->idle_.size() < pool->max_idle_)
+					{
+						pool->idle_.push_back(obj);
+						return;
+					}
+				}
+				delete obj;
+			}
+		};
+
+		/// Control-block allocator.  Every block of one pool has the same
+		/// type, hence the same size; freed blocks are kept for reuse.  The
+		/// allocator owns the pool, so the copy that frees the control block
+		/// (after the deleter has run) still has it.
+		template<typename U>
+		struct BlockAllocator
+		{
+			using value_type = U;
+
+			std::shared_ptr<MessagePool> pool;
+
+			explicit BlockAllocator(std::shared_ptr<MessagePool> p) : pool(std::move(p)) {}
+			template<typename V>
+			BlockAllocator(const BlockAllocator<V>& other) : pool(other.pool) {}
+
+			U* allocate(size_t n)
+			{
+				if (n == 1)
+				{
+					std::lock_guard<std::mutex> lock(pool->mutex_);
+					if (!pool->blocks_.empty() && pool->block_size_ == sizeof(U))
+					{
+						void* block = pool->blocks_.back();
+						pool->blocks_.pop_back();
+						return static_cast<U*>(block);
+					}
+				}
+				return static_cast<U*>(::operator new(n * sizeof(U)));
+			}
+
+			void deallocate(U* p, size_t n)
+			{
+				if (n == 1)
+				{
+					std::lock_guard<std::mutex> lock(pool->mutex_);
+					if (pool->block_size_ == 0)
+						pool->block_size_ = sizeof(U);
+					if (pool->block_size_ == sizeof(U) && pool->blocks_.size() < pool->max_idle_)
+					{
+						pool->blocks_.push_back(p);
+						return;
+					}
+				}
+				::operator delete(p);
+			}
+
+			template<typename V>
+			bool operator==(const BlockAllocator<V>& other) const
+			{
+				return pool == other.pool;
+			}
+		};
+
+		const size_t	   max_idle_;
+		mutable std::mutex mutex_;
+		std::vector<T*>	   idle_;
+		std::vector<void*> blocks_;
+		size_t			   block_size_{0}; // size of the recycled control blocks
+	};
+
+} // namespace lux::communication
@@ -1,5 +1,7 @@
 #pragma once
 #include <cstdint>
+#include <string>
+#include <lux/communication/ThreadOptions.hpp>
 
 namespace lux::communication {
 
@@ -9,10 +11,16 @@ struct NodeOptions {
     bool enable_shm          = true;   ///< Allow SHM transport.
     bool enable_net          = true;   ///< Allow Network transport.
     bool enable_intra        = true;   ///< Allow same-process transport.
+    bool enable_uds          = true;   ///< Allow Unix domain sockets between same-host processes without SHM.
+
+    /// Directory for publisher Unix domain sockets.  Containers that must
+    /// talk over UDS need to share it (e.g. a common volume mount).
+    std::string uds_socket_dir = "/tmp";
 
     // ── IO thread tuning ──
     uint32_t shm_poll_interval_us = 100;   ///< SHM reader poll interval (microseconds).
     uint32_t reactor_timeout_ms   = 10;    ///< IoReactor pollOnce timeout (milliseconds).
+    ThreadOptions io_thread{};             ///< CPU set / scheduling / name of the IO thread.
 
     // ── Discovery heartbeat (multicast, cross-machine) ──
     uint32_t discovery_heartbeat_interval_ms = 2000;  ///< Send interval (ms).  0 = disabled.
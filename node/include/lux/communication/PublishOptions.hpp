@@ -2,6 +2,7 @@
 #include <cstdint>
 #include <chrono>
 #include <lux/communication/QoSProfile.hpp>
+#include <lux/communication/transport/FragmentPacer.hpp>
 
 namespace lux::communication {
 
@@ -13,6 +14,12 @@ enum class PublishTransportHint : uint8_t {
     NetOnly   = 3,   ///< Only remote subscribers via network.
 };
 
+/// How the network path picks UDP vs. TCP for BestEffort messages.
+enum class NetPathMode : uint8_t {
+    Static   = 0,   ///< UDP below net_large_threshold, TCP above.
+    Adaptive = 1,   ///< Per-peer threshold from measured fragment loss and RTT.
+};
+
 /// Options when creating a unified Publisher.
 struct PublishOptions {
     // ── SHM ring options ──
@@ -26,6 +33,26 @@ struct PublishOptions {
     uint16_t net_tcp_port        = 0;   // 0 = auto-bind
     uint32_t net_large_threshold = 64 * 1024; // > 64 KB → prefer TCP
 
+    /// Adaptive mode uses net_large_threshold only until the first loss
+    /// estimate arrives (or when feedback goes stale).
+    NetPathMode net_path_mode    = NetPathMode::Static;
+    uint32_t net_adaptive_max_threshold = 8 * 1024 * 1024; // loss-free link ceiling
+
+    /// UDP fragment pacing applied to every net peer (rate 0 = back-to-back).
+    /// Override per peer with Publisher::setPeerPacing().
+    transport::PacingConfig net_pacing{};
+
+    /// Send small unfragmented UDP frames with a compact header (varint seq
+    /// delta, topic id, optional timestamp) once the subscriber advertises
+    /// support.  Fragmented and TCP frames always carry the full FrameHeader.
+    /// Off by default: compact frames carry no magic or CRC and rely on a
+    /// 4-bit binding epoch, and enabling this starts the link-report poller.
+    bool net_compact_header = false;
+
+    // ── Unix domain socket options ──
+    /// Payloads above this are passed as a memfd instead of inline.
+    uint32_t uds_memfd_threshold = 64 * 1024;
+
     // ── Transport hint ──
     PublishTransportHint transport_hint = PublishTransportHint::Auto;
 
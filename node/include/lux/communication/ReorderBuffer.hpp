@@ -1,6 +1,6 @@
 #pragma once
 
-#include <cassert>
+#include <bit>
 #include <cstddef>
 #include <vector>
 #include <lux/communication/ExecEntry.hpp>
@@ -13,7 +13,10 @@ namespace lux::communication {
     struct ReorderBufferStats {
         uint64_t ring_put_ok = 0;           // Successful ring insertions
         uint64_t max_window = 0;            // Max observed (seq - next_seq)
-        uint64_t discarded_old = 0;         // Entries discarded (seq < next_seq)
+        uint64_t discarded_old = 0;         // Markers / duplicates behind next_seq, or beyond the ring
+        uint64_t consumed = 0;              // Sequence numbers released by a "consumed" marker
+        uint64_t gaps_skipped = 0;          // Missing sequence numbers given up on (timeout / ring full)
+        uint64_t late = 0;                  // Entries that arrived after their gap was skipped
     };
 
     /**
@@ -22,7 +25,7 @@ namespace lux::communication {
      */
     class ReorderRing {
     public:
-        explicit ReorderRing(size_t cap_pow2 = 1 << 16)  // 65536 default
+        explicit ReorderRing(size_t cap_pow2 = 1 << 12)
             : cap_(cap_pow2), mask_(cap_pow2 - 1), slots_(cap_pow2), pending_count_(0)
         {
             // cap_pow2 must be power of 2
@@ -31,41 +34,27 @@ namespace lux::communication {
         /**
          * @brief Try to put an entry into the ring buffer.
          *        Combined can_accept + put for better cache locality.
-         * @param e The entry to insert (will be moved if successful)
+         * @param e The entry to insert (moved from only if inserted)
          * @param next_seq The current expected next sequence number
-         * @return true if successfully inserted or discarded (too old), 
-         *         false if needs fallback (too far ahead or collision)
+         * @return true if inserted, false if `e.seq` lies outside
+         *         [next_seq, next_seq + capacity)
          */
-        bool try_put(ExecEntry&& e, uint64_t next_seq) {
+        bool try_put(ExecEntry& e, uint64_t next_seq) {
             const uint64_t seq = e.seq;
-
-            // Too old: discard silently (shouldn't happen normally)
-            if (seq < next_seq) {
-                return true;
-            }
-
-            // Too far ahead: exceeds window, ring can't hold it
-            if (seq - next_seq >= cap_) {
+            if (seq < next_seq || seq - next_seq >= cap_) {
                 return false;
             }
 
+            // Every occupied slot holds a seq within the window, so two
+            // different seqs never share a slot.
             auto& slot = slots_[static_cast<size_t>(seq) & mask_];
             if (!slot.occupied) {
                 slot.occupied = true;
                 slot.seq = seq;
-                slot.entry = std::move(e);
                 ++pending_count_;
-                return true;
             }
-
-            // Same seq (duplicate) - overwrite
-            if (slot.seq == seq) {
-                slot.entry = std::move(e);
-                return true;
-            }
-
-            // Collision: cap not enough or out-of-order span too large
-            return false;
+            slot.entry = std::move(e);  // Same seq (duplicate) - overwrite
+            return true;
         }
 
         /**
@@ -87,7 +76,7 @@ namespace lux::communication {
             auto& slot = slots_[static_cast<size_t>(seq) & mask_];
             if (slot.occupied && slot.seq == seq) {
                 slot.occupied = false;
-                slot.entry = ExecEntry{};  // Release resources
+                slot.entry.reset();  // Release resources
                 --pending_count_;
             }
         }
@@ -110,43 +99,78 @@ namespace lux::communication {
 
     /**
      * @brief Ring-only reorder buffer.
-     *        Adaptive drain throttling in SeqOrderedExecutor guarantees the
-     *        out-of-order window stays within ring capacity, so no fallback
-     *        hashmap is needed.  O(1) insert and pop.
+     *
+     *        Entries are released strictly in sequence order.  An empty
+     *        ExecEntry is a "consumed" marker: its sequence number will never
+     *        be delivered (filtered, dropped), so it advances the head
+     *        without running anything.  A head that is simply missing can
+     *        be given up on with skip_gap(); anything that arrives for it
+     *        afterwards is reported as Late.
      */
     class ReorderBuffer {
     public:
-        explicit ReorderBuffer(size_t ring_cap_pow2 = 1 << 16)  // 65536
-            : ring_(ring_cap_pow2), next_seq_(1)
+        static constexpr size_t kDefaultRingCapacity = 1 << 12;  // 4096 slots
+
+        enum class PutResult {
+            Buffered,   // Stored (or an irrelevant marker ignored)
+            Late,       // seq < next_seq: caller decides (entry not moved from)
+            Full,       // Beyond the ring window: advance the head first
+        };
+
+        /// @param ring_capacity  Rounded up to a power of two.
+        explicit ReorderBuffer(size_t ring_capacity = kDefaultRingCapacity)
+            : ring_(std::bit_ceil(ring_capacity < 2 ? size_t{2} : ring_capacity)), next_seq_(1)
         {
         }
 
         /**
          * @brief Insert an entry into the reorder buffer.
-         *        Must fit within ring window (guaranteed by adaptive throttle).
+         * @param e  Moved from only when the result is Buffered.
          */
-        void put(ExecEntry&& e) {
-            uint64_t seq = e.seq;
+        PutResult put(ExecEntry& e) {
+            const uint64_t seq = e.seq;
+            const bool marker = !e;
 
             if (seq < next_seq_) {
-                ++stats_.discarded_old;
-                return;
+                if (marker) {
+                    ++stats_.discarded_old;
+                    return PutResult::Buffered;
+                }
+                ++stats_.late;
+                return PutResult::Late;
+            }
+
+            if (seq - next_seq_ >= ring_.capacity()) {
+                // A marker this far ahead cannot be one of our gaps.
+                if (marker) {
+                    ++stats_.discarded_old;
+                    return PutResult::Buffered;
+                }
+                // Nothing buffered: every seq up to this one is missing.
+                if (ring_.pending_count() == 0) {
+                    stats_.gaps_skipped += seq - next_seq_;
+                    next_seq_ = seq;
+                } else {
+                    return PutResult::Full;
+                }
             }
 
             // Track max window for diagnostics
-            uint64_t window = seq - next_seq_;
+            const uint64_t window = seq - next_seq_;
             if (window > stats_.max_window)
                 stats_.max_window = window;
 
-            bool ok = ring_.try_put(std::move(e), next_seq_);
-            assert(ok && "ReorderBuffer: entry outside ring window — throttle bug?");
-            (void)ok;  // suppress unused-variable warning in release
-            ++stats_.ring_put_ok;
+            ring_.try_put(e, next_seq_);
+            if (marker)
+                ++stats_.consumed;
+            else
+                ++stats_.ring_put_ok;
+            return PutResult::Buffered;
         }
 
         /**
          * @brief Try to pop the next expected entry.
-         * @param out Output entry
+         * @param out Output entry (empty for a consumed marker)
          * @return true if found and popped, false if next_seq not available
          */
         bool try_pop_next(ExecEntry& out) {
@@ -159,6 +183,29 @@ namespace lux::communication {
             return false;
         }
 
+        /**
+         * @brief True if entries are buffered but the head is missing.
+         */
+        bool blocked() {
+            return ring_.pending_count() > 0 && !ring_.get(next_seq_);
+        }
+
+        /**
+         * @brief Give up on the missing head: advance to the next buffered entry.
+         * @return Number of sequence numbers skipped
+         */
+        uint64_t skip_gap() {
+            if (ring_.pending_count() == 0)
+                return 0;
+            uint64_t skipped = 0;
+            while (!ring_.get(next_seq_)) {  // bounded by the ring window
+                ++next_seq_;
+                ++skipped;
+            }
+            stats_.gaps_skipped += skipped;
+            return skipped;
+        }
+
         /**
          * @brief Get the next expected sequence number.
          */
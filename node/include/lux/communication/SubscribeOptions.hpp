@@ -1,6 +1,9 @@
 #pragma once
+#include <chrono>
+#include <cstddef>
 #include <cstdint>
 #include <functional>
+#include <lux/communication/FieldFilter.hpp>
 #include <lux/communication/QoSProfile.hpp>
 
 namespace lux::communication {
@@ -21,6 +24,42 @@ struct SubscribeOptions {
     // ── QoS (Phase 6) ──
     QoSProfile qos{};
 
+    // ── Executor scheduling ──
+    /// Ready-queue priority under ReadyPolicy::Priority (higher runs first).
+    /// Under ReadyPolicy::EarliestDeadline the relative deadline is taken
+    /// from qos.latency_budget, falling back to qos.deadline.
+    int32_t priority = 0;
+
+    // ── Batch callback (ignored for per-message callbacks) ──
+    /// Largest span handed to the callback; 0 = everything one take drains.
+    size_t max_batch_size = 0;
+
+    /// How long a batch smaller than max_batch_size may wait for more
+    /// messages before it is delivered anyway; 0 = deliver immediately.
+    std::chrono::nanoseconds max_batch_wait{0};
+
+    // ── Receive path ──
+    /// Messages received over SHM / network that are recycled once the
+    /// callback has released them, keeping their buffers for the next
+    /// deserialize.  Should cover the messages in flight (queued + being
+    /// handled); 0 = allocate every message.  Ignored for SmallValueMsg types.
+    size_t message_pool_size = 16;
+
+    /// Queue SHM / network messages as raw bytes and deserialize them on
+    /// the executor thread that takes them, instead of on the IoThread.
+    /// Decoding then runs in parallel across executor threads and is
+    /// skipped for messages dropped by KeepLast or lifespan; the content
+    /// filter runs after decoding.  Ignored for SmallValueMsg types.
+    bool deserialize_on_executor = false;
+
+    // ── Content filter pushdown ──
+    /// Declarative filter advertised to SHM / network publishers, which
+    /// drop non-matching messages before serializing them for this
+    /// process.  Also applied locally on every path: field predicates
+    /// before the ContentFilter callback, sampling after it.  Not pushed
+    /// to UDS publishers or applied to loaned messages by the publisher.
+    FieldFilter field_filter;
+
     /// Called when qos.deadline > 0 and no message arrives within the deadline.
     std::function<void()> on_deadline_missed;
 };
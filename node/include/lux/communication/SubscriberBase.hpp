@@ -1,7 +1,9 @@
 #pragma once
+#include <atomic>
 #include <cstddef>
 #include <memory>
 #include <limits>
+#include <cstdint>
 
 #include <lux/communication/TimeExecEntry.hpp>
 #include <lux/communication/ExecEntry.hpp>
@@ -12,6 +14,8 @@ namespace lux::communication
     class NodeBase;
 	class TopicBase;
 	class CallbackGroupBase;
+	class ExecutorBase;
+	class CallbackProfiler;
 
     using TopicSptr = std::shared_ptr<TopicBase>;
 
@@ -21,11 +25,24 @@ namespace lux::communication
         friend class NodeBase;
         friend class TopicBase;
         friend class CallbackGroupBase;
+        friend class ExecutorBase;
     public:
         virtual ~SubscriberBase();
 
         virtual void takeAll() = 0;
 
+        /**
+         * @brief Bounded takeAll(): run at most max_count callbacks, then
+         *        re-notify if messages remain.  Used by executors under a
+         *        non-FIFO ReadyPolicy so a flooded subscriber yields the
+         *        worker back to the ready queue between batches.
+         */
+        virtual void takeSome(size_t max_count)
+        {
+            (void)max_count;
+            takeAll();
+        }
+
         virtual void drainAll(std::vector<TimeExecEntry>& out) = 0;
 
         // High-performance drain using function pointer trampoline (no std::function)
@@ -62,24 +79,66 @@ namespace lux::communication
             return static_cast<T&>(*topic_);
         }
 
+        /// nullptr once the group was destroyed before the subscriber.
         CallbackGroupBase* callbackGroup()
         {
-            return callback_group_;
+            return callback_group_.load(std::memory_order_acquire);
         }
 
         const CallbackGroupBase* callbackGroup() const
         {
-            return callback_group_;
+            return callback_group_.load(std::memory_order_acquire);
+        }
+
+        /// Executor of the callback group; nullptr when the group is not
+        /// attached to one or is gone.
+        ExecutorBase* executor() const;
+
+        /// Ready-queue priority under ReadyPolicy::Priority (higher first).
+        int32_t priority() const
+        {
+            return priority_;
+        }
+
+        /// Relative deadline (ns) under ReadyPolicy::EarliestDeadline; 0 = none.
+        uint64_t relativeDeadlineNs() const
+        {
+            return relative_deadline_ns_;
+        }
+
+        /// QoSProfile::latency_budget (ns); 0 = none.  Executors spin longer
+        /// before parking while a subscriber with a tight budget is attached.
+        uint64_t latencyBudgetNs() const
+        {
+            return latency_budget_ns_;
         }
 
     protected:
         SubscriberBase(TopicSptr topic, NodeBase* node, CallbackGroupBase* cgb);
 
+        /// Set once by the derived constructor; reports the latency budget
+        /// to the executor the subscriber is already attached to.
+        void setSchedulingHints(int32_t priority, uint64_t relative_deadline_ns,
+                                uint64_t latency_budget_ns);
+
+        /// Profiler of the executor running this subscriber; nullptr if
+        /// profiling is off.  Fetch once per take, time callbacks with
+        /// CallbackProfiler::Scope.
+        CallbackProfiler* profiler() const;
+
+        /// Queue the subscriber on its group's executor.  A no-op once the
+        /// group is gone: nothing would ever run it.
+        void notifyReady();
+
         void clearReady()
         {
             ready_flag_.clear(std::memory_order_release);
         }
 
+        /// The callback group moved to another executor (either may be null).
+        /// Called by CallbackGroupBase::setExecutor().
+        virtual void executorChanged(ExecutorBase* /*old_executor*/, ExecutorBase* /*new_executor*/) {}
+
     private:
 
         void setIdInNode(size_t id)
@@ -103,6 +162,14 @@ namespace lux::communication
         alignas(64) std::atomic_flag    ready_flag_ = ATOMIC_FLAG_INIT;
         std::shared_ptr<TopicBase>      topic_;
         NodeBase*                       node_;
-        CallbackGroupBase*              callback_group_;
+        std::atomic<CallbackGroupBase*> callback_group_;
+
+        // Scheduling hints (see ReadyPolicy).
+        int32_t                         priority_{0};
+        uint64_t                        relative_deadline_ns_{0};
+        uint64_t                        latency_budget_ns_{0};
+        /// Time the subscriber last became ready; stamped by the executor
+        /// under ReadyPolicy::EarliestDeadline only.
+        uint64_t                        ready_since_ns_{0};
     };
 }
@@ -0,0 +1,99 @@
+#pragma once
+#include <coroutine>
+#include <utility>
+
+#include <lux/communication/visibility.h>
+
+namespace lux::communication
+{
+    class CoroutineExecutor;
+
+    /// Fire-and-forget coroutine run by a CoroutineExecutor.
+    ///
+    /// A Task does nothing until it is handed to CoroutineExecutor::spawn(),
+    /// which starts it on the executor thread and owns its frame from then
+    /// on: the frame is destroyed when the coroutine returns, or with the
+    /// executor if it is still suspended then.  An exception escaping the
+    /// coroutine is reported on stderr and ends the task.
+    ///
+    /// @code
+    /// comm::Task pair(comm::Subscriber<Imu>& imu, comm::Subscriber<Gps>& gps)
+    /// {
+    ///     for (;;)
+    ///     {
+    ///         auto a = co_await imu.next();
+    ///         auto b = co_await gps.next();
+    ///         fuse(*a, *b);
+    ///     }
+    /// }
+    /// exec.spawn(pair(*imu_sub, *gps_sub));
+    /// @endcode
+    class LUX_COMMUNICATION_PUBLIC Task
+    {
+        struct FinalAwaiter;
+    public:
+        struct promise_type
+        {
+            CoroutineExecutor* executor{nullptr};
+
+            Task get_return_object() noexcept
+            {
+                return Task(std::coroutine_handle<promise_type>::from_promise(*this));
+            }
+
+            std::suspend_always initial_suspend() noexcept { return {}; }
+            FinalAwaiter        final_suspend() noexcept { return {}; }
+            void                return_void() noexcept {}
+            void                unhandled_exception() noexcept { reportException(); }
+        };
+
+        using handle_type = std::coroutine_handle<promise_type>;
+
+        Task(Task&& other) noexcept : handle_(std::exchange(other.handle_, {})) {}
+
+        Task& operator=(Task&& other) noexcept
+        {
+            if (this != &other)
+            {
+                if (handle_)
+                    handle_.destroy();
+                handle_ = std::exchange(other.handle_, {});
+            }
+            return *this;
+        }
+
+        Task(const Task&)            = delete;
+        Task& operator=(const Task&) = delete;
+
+        /// Destroys a task that was never spawned.
+        ~Task()
+        {
+            if (handle_)
+                handle_.destroy();
+        }
+
+        /// False once spawned (or moved from).
+        bool valid() const { return static_cast<bool>(handle_); }
+
+    private:
+        friend class CoroutineExecutor;
+
+        struct FinalAwaiter
+        {
+            bool await_ready() noexcept { return false; }
+            void await_suspend(handle_type handle) noexcept { finish(handle); }
+            void await_resume() noexcept {}
+        };
+
+        explicit Task(handle_type handle) : handle_(handle) {}
+
+        /// Hand a finished frame back to its executor for destruction.
+        static void finish(handle_type handle) noexcept;
+        static void reportException() noexcept;
+
+        handle_type release() { return std::exchange(handle_, {}); }
+
+        handle_type handle_;
+    };
+
+} // namespace lux::communication
@@ -0,0 +1,41 @@
+#pragma once
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace lux::communication {
+
+/// Scheduling policy for executor and IO threads.
+enum class SchedPolicy : uint8_t {
+    Inherit    = 0,   ///< Keep the policy the thread was started with.
+    Other      = 1,   ///< SCHED_OTHER (normal time-sharing).
+    Fifo       = 2,   ///< SCHED_FIFO real-time.
+    RoundRobin = 3,   ///< SCHED_RR real-time.
+};
+
+/// CPU placement, scheduling and name of an executor or IO thread.
+///
+/// Applied by each thread when it starts; an executor's spin() applies it
+/// to the calling thread, which keeps the settings after spin() returns.
+/// A setting that cannot be applied (e.g. SCHED_FIFO without
+/// CAP_SYS_NICE) is reported on stderr and the thread runs without it.
+struct ThreadOptions {
+    /// CPUs the thread may run on.  Empty = inherit the process mask.
+    std::vector<uint32_t> cpus;
+
+    /// Pin worker i of a pool to cpus[i % cpus.size()] instead of giving
+    /// every worker the whole set.
+    bool pin_per_worker = false;
+
+    SchedPolicy sched_policy   = SchedPolicy::Inherit;
+    int         sched_priority = 0;   ///< 1–99 for Fifo / RoundRobin; ignored otherwise.
+
+    /// Thread name.  Pool workers get "-<index>" appended; Linux keeps 15 chars.
+    std::string name;
+
+    bool empty() const {
+        return cpus.empty() && sched_policy == SchedPolicy::Inherit && name.empty();
+    }
+};
+
+} // namespace lux::communication
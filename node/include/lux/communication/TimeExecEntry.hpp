@@ -1,14 +1,14 @@
 #pragma once
-#include <functional>
 #include <cstdint>
+#include <lux/communication/ExecEntry.hpp>
 
 namespace lux::communication
 {
 	struct TimeExecEntry
 	{
-		uint64_t timestamp_ns;
-		std::function<void()> invoker;
+		uint64_t  timestamp_ns{0};
+		ExecEntry exec;	// callback + inline message (exec.seq == timestamp_ns)
 
 		bool operator<(const TimeExecEntry& rhs) const;
 	};
-}
\ No newline at end of file
+}
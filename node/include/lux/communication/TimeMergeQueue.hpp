@@ -0,0 +1,97 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <vector>
+#include <lux/communication/TimeExecEntry.hpp>
+#include <lux/communication/visibility.h>
+
+namespace lux::communication
+{
+	class SubscriberBase;
+
+	/// K-way timestamp merge over per-subscriber runs (not thread-safe).
+	///
+	/// Every subscriber is a *source* whose queue is already in timestamp
+	/// order.  Drained entries are appended to a per-source run, and release()
+	/// runs the oldest head as long as no other source could still deliver
+	/// something older: each source's watermark is its head timestamp while
+	/// it has entries, and the newest timestamp it delivered while it is
+	/// empty.
+	///
+	/// Entries carrying an ExecEntry::origin form a source per (subscriber,
+	/// origin), since each sender is in order only by itself; equal
+	/// timestamps then run in origin order (see OrderKey).
+	///
+	/// A source that stays empty for longer than the idle timeout stops
+	/// holding the merge back.  If it later delivers a message older than one
+	/// already released, that message runs immediately and is counted in
+	/// lateCount().  An idle timeout of 0 never waits for empty sources.
+	class LUX_COMMUNICATION_PUBLIC TimeMergeQueue
+	{
+	public:
+		explicit TimeMergeQueue(std::chrono::nanoseconds idle_timeout = std::chrono::nanoseconds{0});
+
+		void setIdleTimeout(std::chrono::nanoseconds timeout) { idle_timeout_ = timeout; }
+		std::chrono::nanoseconds idleTimeout() const { return idle_timeout_; }
+
+		/// True if `sub` is the only known source and nothing is buffered:
+		/// its queue is already in order, so it may run without merging.
+		/// A source becomes known on its first append(), so a second
+		/// subscriber turns the merge on.
+		bool canBypass(const SubscriberBase* sub) const
+		{
+			return pending_ == 0 && sources_.size() == 1 && sources_.front()->sub == sub;
+		}
+
+		/// Move entries drained from `sub` (in timestamp order per origin)
+		/// into their runs.
+		void append(SubscriberBase* sub, std::vector<TimeExecEntry>& entries);
+
+		/// Run every entry the watermarks allow.
+		/// @return Earliest steady time at which a waiting source turns idle,
+		///         or 0 if nothing is held back.
+		uint64_t release();
+
+		/// Entries released after a newer entry had already run.
+		uint64_t lateCount() const { return late_count_; }
+
+		/// Entries appended but not yet released.
+		size_t pendingSize() const { return pending_; }
+
+	private:
+		struct Source
+		{
+			SubscriberBase*			   sub;
+			uint64_t				   origin{0};
+			std::vector<TimeExecEntry> run;	   // timestamp order, consumed from head
+			size_t					   head{0};
+			uint64_t				   last_ts{0};		   // newest timestamp drained
+			uint64_t				   last_arrival_ns{0}; // steady time of the last non-empty drain
+
+			bool	 empty() const { return head == run.size(); }
+			uint64_t headTs() const { return run[head].timestamp_ns; }
+		};
+
+		Source& sourceFor(SubscriberBase* sub, uint64_t origin);
+
+		/// sourceFor() with its consumed prefix reclaimed, ready to append.
+		Source& runFor(SubscriberBase* sub, uint64_t origin);
+
+		/// Drop sources that have been empty for kSourceExpiryNs (checked when a
+		/// new source registers).
+		void pruneSources(uint64_t now);
+
+		/// Sources silent this long are forgotten (subscriber likely gone).
+		static constexpr uint64_t kSourceExpiryNs = 10'000'000'000ull;
+
+		std::vector<std::unique_ptr<Source>> sources_;
+		std::vector<Source*>				 merge_heap_;
+		std::chrono::nanoseconds			 idle_timeout_;
+		uint64_t							 last_released_ts_{0};
+		uint64_t							 late_count_{0};
+		size_t								 pending_{0};
+		uint64_t							 last_prune_ns_{0};
+	};
+} // namespace lux::communication
@@ -0,0 +1,79 @@
+#pragma once
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+
+#include <lux/communication/SubscriberBase.hpp>
+#include <lux/communication/TimerWheel.hpp>
+#include <lux/communication/visibility.h>
+
+namespace lux::communication
+{
+    class ExecutorBase;
+
+    /// Periodic timer driven by the executor of its callback group.
+    ///
+    /// A timer is scheduled like a subscriber: when it expires, the
+    /// executor's timing wheel marks it ready in its callback group, so the
+    /// callback obeys the group's exclusivity and the executor's
+    /// ReadyPolicy.  Expiries that pass while the timer is still waiting to
+    /// run are coalesced into one callback and counted in overruns().
+    ///
+    /// Ordered executors (SeqOrdered, TimeOrdered) run the callback as soon
+    /// as they drain the timer; ticks do not take part in message ordering.
+    class LUX_COMMUNICATION_PUBLIC Timer : public SubscriberBase
+    {
+        friend class ExecutorBase;
+    public:
+        using Callback = std::function<void()>;
+
+        Timer(NodeBase* node, std::chrono::nanoseconds period, Callback callback,
+              CallbackGroupBase* cbg);
+        ~Timer() override;
+
+        Timer(const Timer&)            = delete;
+        Timer& operator=(const Timer&) = delete;
+
+        /// Stop firing until reset().
+        void cancel();
+
+        /// Restart the period from now (also undoes cancel()).
+        void reset();
+
+        bool isCanceled() const { return canceled_.load(std::memory_order_relaxed); }
+
+        std::chrono::nanoseconds period() const { return period_; }
+
+        /// Expiries that did not get their own callback (coalesced, or
+        /// skipped because the executor fell more than a period behind).
+        uint64_t overruns() const { return overruns_.load(std::memory_order_relaxed); }
+
+        /// Steady time (ns) the running callback was scheduled for.
+        uint64_t scheduledNs() const { return scheduled_ns_.load(std::memory_order_relaxed); }
+
+        // ── SubscriberBase interface ──
+        void takeAll() override;
+        void drainAll(std::vector<TimeExecEntry>& out) override;
+        void drainAllExec(std::vector<ExecEntry>& out) override;
+        size_t drainExecSome(std::vector<ExecEntry>& out, size_t max_count) override;
+
+    protected:
+        void executorChanged(ExecutorBase* old_executor, ExecutorBase* new_executor) override;
+
+    private:
+        /// Called by the executor's wheel with its timer lock held.
+        void expire(uint64_t expiry_ns, uint64_t now_ns);
+
+        const std::chrono::nanoseconds period_;
+        Callback                       callback_;
+
+        TimerWheel::Entry              wheel_entry_;   // guarded by the executor's timer lock
+        std::atomic<uint64_t>          pending_{0};     // expiries not yet run
+        std::atomic<uint64_t>          due_ns_{0};      // latest expiry
+        std::atomic<uint64_t>          scheduled_ns_{0};
+        std::atomic<uint64_t>          overruns_{0};
+        std::atomic<bool>              canceled_{false};
+    };
+
+} // namespace lux::communication
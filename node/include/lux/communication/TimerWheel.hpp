@@ -0,0 +1,80 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include <lux/communication/visibility.h>
+
+namespace lux::communication
+{
+	/// Hierarchical timing wheel (not thread-safe).
+	///
+	/// kLevels wheels of kSlots slots each; a slot of level L spans
+	/// kSlots^L ticks of kTickNs.  An entry is linked into the level that
+	/// covers its distance from the current tick, and falls one level down
+	/// every time the lower wheel wraps, so insert and remove are O(1) and
+	/// advance() only visits occupied slots and wheel boundaries.
+	///
+	/// Entries keep their exact expiry: advance() fires an entry only once
+	/// its expiry has passed, so the tick size bounds bookkeeping, not
+	/// precision.
+	class LUX_COMMUNICATION_PUBLIC TimerWheel
+	{
+	public:
+		/// Intrusive link, embedded in the timer.
+		struct Entry
+		{
+			uint64_t expiry_ns{0};
+			void*	 owner{nullptr};
+
+			bool linked() const { return level_ != kUnlinked; }
+
+		private:
+			friend class TimerWheel;
+			Entry*	 prev_{nullptr};
+			Entry*	 next_{nullptr};
+			uint8_t	 level_{kUnlinked};
+			uint8_t	 slot_{0};
+		};
+
+		static constexpr uint32_t kTickShift = 14;					// 16.384 us per tick
+		static constexpr uint32_t kSlotBits  = 6;
+		static constexpr uint32_t kSlots	 = 1u << kSlotBits;		// 64 slots per level
+		static constexpr uint32_t kLevels	 = 4;					// ~275 s before clamping
+
+		/// @param now_ns  Steady time the wheel starts at.
+		explicit TimerWheel(uint64_t now_ns = 0);
+
+		/// Link `e` at e.expiry_ns (already linked entries are moved).
+		void insert(Entry& e);
+
+		/// Unlink `e` if linked.
+		void remove(Entry& e);
+
+		/// Move the wheel to `now_ns` and unlink every entry that expired,
+		/// appending it to `expired` in no particular order.
+		void advance(uint64_t now_ns, std::vector<Entry*>& expired);
+
+		/// Earliest time advance() has work to do: the exact expiry of the
+		/// next entry on the lowest wheel, or the moment a higher slot
+		/// cascades down.  UINT64_MAX if empty.
+		uint64_t nextExpiry() const;
+
+		size_t size() const { return size_; }
+		bool   empty() const { return size_ == 0; }
+
+	private:
+		static constexpr uint8_t kUnlinked = 0xff;
+
+		void link(Entry& e, uint8_t level, uint8_t slot);
+		void unlink(Entry& e);
+		void place(Entry& e);
+		void cascade(uint32_t level, uint32_t slot);
+
+		Entry*	 slots_[kLevels][kSlots]{};
+		uint64_t occupied_[kLevels]{};	// bit per non-empty slot
+		uint64_t current_tick_;
+		size_t	 size_{0};
+	};
+
+} // namespace lux::communication
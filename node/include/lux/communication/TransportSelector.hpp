@@ -7,14 +7,37 @@
 #include <lux/communication/discovery/DiscoveryService.hpp>
 #include <lux/communication/platform/PlatformDefs.hpp>
 
+#include <string>
+#include <string_view>
+
 namespace lux::communication {
 
+/// Unix domain socket endpoints are announced through the discovery
+/// endpoint string as "uds:<path>" (no separate discovery field).
+inline constexpr std::string_view kUdsEndpointScheme = "uds:";
+
+inline bool isUdsEndpoint(const std::string& endpoint)
+{
+    return endpoint.compare(0, kUdsEndpointScheme.size(), kUdsEndpointScheme) == 0;
+}
+
+inline std::string makeUdsEndpoint(const std::string& path)
+{
+    return std::string(kUdsEndpointScheme) + path;
+}
+
+inline std::string udsPathOf(const std::string& endpoint)
+{
+    return endpoint.substr(kUdsEndpointScheme.size());
+}
+
 /// Select the best transport for communicating with a remote endpoint.
 ///
 /// Decision order:
 ///   1. Same PID + same hostname → Intra  (shared_ptr zero-copy)
 ///   2. Same hostname            → Shm    (shared-memory ring)
-///   3. Different hostname       → Net    (UDP / TCP)
+///   3. Same hostname, no SHM    → Uds    (Unix domain socket, if announced)
+///   4. Different hostname       → Net    (UDP / TCP)
 inline ChannelKind selectTransport(
     const discovery::TopicEndpoint& remote,
     const NodeOptions& opts)
@@ -37,9 +60,18 @@ inline ChannelKind selectTransport(
         return ChannelKind::Shm;
     }
 
-    // 3. Cross-machine
+    // 3. Same machine without SHM — skip the IP stack.
+    if (opts.enable_uds &&
+        remote.hostname == my_host &&
+        isUdsEndpoint(remote.net_endpoint))
+    {
+        return ChannelKind::Uds;
+    }
+
+    // 4. Cross-machine
     if (opts.enable_net &&
-        !remote.net_endpoint.empty())
+        !remote.net_endpoint.empty() &&
+        !isUdsEndpoint(remote.net_endpoint))
     {
         return ChannelKind::Net;
     }
@@ -18,6 +18,10 @@ namespace lux::communication::discovery
         uint64_t type_hash = 0;
         uint64_t domain_id = 0;
         uint32_t pid = 0;
+        /// The announcing process's handle for this endpoint: with `pid` it
+        /// tells apart several publishers / subscribers of one process
+        /// (0 from peers that do not send it).
+        uint32_t endpoint_id = 0;
         std::string hostname;
 
         enum class Role : uint8_t
@@ -30,6 +34,10 @@ namespace lux::communication::discovery
         /// Transport hints (populated by Phase 2+).
         std::string shm_segment_name;
         std::string net_endpoint;
+
+        /// Subscribers: encoded FieldFilter the publisher should apply
+        /// before sending to this endpoint ("" = everything).
+        std::string content_filter;
     };
 
     enum class DiscoveryEventType
@@ -67,12 +75,14 @@ namespace lux::communication::discovery
                                    const std::string &shm_name = "",
                                    const std::string &net_endpoint = "");
 
-        /// Register a subscriber endpoint.
+        /// Register a subscriber endpoint.  `content_filter` (an encoded
+        /// FieldFilter) longer than 31 bytes is not advertised.
         uint64_t announceSubscriber(const std::string &topic_name,
                                     const std::string &type_name,
                                     uint64_t type_hash,
                                     const std::string &shm_name = "",
-                                    const std::string &net_endpoint = "");
+                                    const std::string &net_endpoint = "",
+                                    const std::string &content_filter = "");
 
         /// Withdraw a previously announced endpoint.
         void withdraw(uint64_t handle);
@@ -0,0 +1,66 @@
+#pragma once
+
+#include <coroutine>
+#include <mutex>
+#include <unordered_set>
+#include <lux/communication/ExecutorBase.hpp>
+#include <lux/communication/Task.hpp>
+
+namespace lux::communication
+{
+	/// Single-threaded executor that also runs coroutines.
+	///
+	/// Subscribers and timers are handled as in SingleThreadedExecutor.  On
+	/// top of that, spawn() starts a Task on the spinning thread, and a task
+	/// that awaits Subscriber::next() on a node of this executor is resumed
+	/// inline by the take that pops its message: no extra queue hop and no
+	/// std::function between the message and the coroutine.
+	///
+	/// Subscriber::next() itself works under any executor; this one adds
+	/// owning and starting tasks, and schedule() to re-queue a coroutine.
+	class LUX_COMMUNICATION_PUBLIC CoroutineExecutor : public ExecutorBase
+	{
+	public:
+		/// Awaiter returned by schedule().
+		struct ScheduleAwaiter
+		{
+			CoroutineExecutor* executor;
+
+			bool await_ready() const noexcept { return false; }
+			void await_suspend(std::coroutine_handle<> handle) { executor->post(handle); }
+			void await_resume() const noexcept {}
+		};
+
+		CoroutineExecutor() = default;
+		~CoroutineExecutor() override;
+
+		void spin() override;
+		void spinSome() override;
+		void handleSubscriber(SubscriberBase *sub) override;
+
+		/// Start `task` on the executor thread.  The executor owns its frame
+		/// until the coroutine returns.
+		void spawn(Task task);
+
+		/// `co_await exec.schedule()` resumes the coroutine on the executor
+		/// thread after the work already queued there (moves a coroutine
+		/// onto the executor, or yields to ready subscribers).
+		ScheduleAwaiter schedule() { return {this}; }
+
+		/// Tasks spawned and not yet finished.
+		size_t taskCount() const;
+
+	private:
+		friend class Task;
+
+		using PostQueue = moodycamel::ConcurrentQueue<std::coroutine_handle<>>;
+
+		void post(std::coroutine_handle<> handle);
+		void runPosted();
+		void finishTask(std::coroutine_handle<> handle);
+
+		PostQueue						posted_;
+		mutable std::mutex				tasks_mutex_;
+		std::unordered_set<void*>		tasks_;	// frame addresses
+	};
+} // namespace lux::communication
@@ -1,22 +1,71 @@
 #pragma once
 
+#include <thread>
+#include <vector>
+#include <memory>
+
 #include <lux/communication/ExecutorBase.hpp>
-#include <lux/cxx/concurrent/ThreadPool.hpp>
+#include <lux/communication/executor/WorkStealingDeque.hpp>
 
 namespace lux::communication
 {
+	/// Work-stealing multi-threaded executor.
+	///
+	/// spin() runs `threadNum` workers (the calling thread is worker 0).  Each
+	/// worker owns a deque: subscribers made ready by a callback on that worker
+	/// are pushed locally and run there (cache-hot pipelines); readiness from
+	/// other threads goes through the shared ready queue.  Idle workers steal
+	/// from the top of other workers' deques.
+	///
+	/// MutuallyExclusive groups are scheduled by ownership rather than by
+	/// thread: the worker that acquires a group drains it, and subscribers of
+	/// that group that become ready meanwhile are deferred to the owner.
+	/// Different groups therefore run concurrently while each group's
+	/// callbacks never overlap.  Reentrant subscribers run wherever they land.
+	///
+	/// Under a non-FIFO ReadyPolicy local deques are bypassed: all readiness
+	/// goes through the shared priority heap so every worker picks the most
+	/// urgent subscriber.
 	class LUX_COMMUNICATION_PUBLIC MultiThreadedExecutor : public ExecutorBase
 	{
 	public:
 		explicit MultiThreadedExecutor(size_t threadNum = 2);
 		~MultiThreadedExecutor() override;
 
+		void spin() override;
 		void spinSome() override;
 		void stop() override;
 		void handleSubscriber(SubscriberBase *sub) override;
+		void enqueueReady(SubscriberBase *sub) override;
+
+		size_t threadCount() const { return workers_.size(); }
+
+	protected:
+		void wakeForTimers() override;
 
 	private:
-		lux::cxx::ThreadPool thread_pool_;
+		struct alignas(64) Worker
+		{
+			explicit Worker(size_t idx) : index(idx), rng(0x9E3779B97F4A7C15ull * (idx + 1)) {}
+
+			WorkStealingDeque<SubscriberBase*> deque{kDequeCapacity};
+			std::thread						   thread;
+			size_t							   index;
+			uint64_t						   rng; // victim selection
+		};
+
+		void			workerLoop(Worker& self);
+		SubscriberBase* findWork(Worker& self);
+		void			runReady(SubscriberBase* sub);
+		void			runExclusive(CallbackGroupBase* group, SubscriberBase* sub);
+		void			notifyIdle();
+
+		static constexpr size_t	  kDequeCapacity = 1024;
+
+		std::vector<std::unique_ptr<Worker>> workers_;
+
+		/// Parked workers; notifyIdle() wakes exactly one.
+		EventCount						idle_ec_;
 	};
 
 } // namespace lux::communication
@@ -0,0 +1,107 @@
+#pragma once
+
+#include <thread>
+#include <vector>
+#include <memory>
+#include <shared_mutex>
+#include <unordered_map>
+
+#include <lux/communication/ExecutorBase.hpp>
+#include <lux/communication/TimeMergeQueue.hpp>
+
+namespace lux::communication
+{
+	/// Time-ordered executor that keeps the order per ordering domain and runs
+	/// different domains on a thread pool.
+	///
+	/// By default every callback group is its own ordering domain, so the
+	/// subscribers of one group (e.g. the sensor topics feeding one fusion
+	/// node) are merged by publish timestamp exactly as TimeOrderedExecutor
+	/// would, while unrelated groups make progress on other workers.
+	/// setOrderingDomain() maps several groups onto one shared domain.
+	///
+	/// A domain is drained and merged by one worker at a time: callbacks of
+	/// one domain never overlap, whatever the group type.  Readiness raised
+	/// while another worker owns the domain is handed to that owner.  Idle
+	/// timeout and late counting behave as in TimeOrderedExecutor, per
+	/// domain.
+	class LUX_COMMUNICATION_PUBLIC ParallelTimeOrderedExecutor : public ExecutorBase
+	{
+	public:
+		explicit ParallelTimeOrderedExecutor(size_t threadNum = 2,
+											 std::chrono::nanoseconds idle_timeout = std::chrono::nanoseconds{0});
+		~ParallelTimeOrderedExecutor() override;
+
+		void spin() override;
+		void spinSome() override;
+		void stop() override;
+		void handleSubscriber(SubscriberBase *sub) override;
+		void enqueueReady(SubscriberBase *sub) override;
+
+		/// Order `group` together with every other group mapped to `domain`.
+		/// Call before its subscribers receive data.
+		void setOrderingDomain(CallbackGroupBase* group, uint32_t domain);
+
+		/// Applies to every domain, including ones created later.
+		void setIdleTimeout(std::chrono::nanoseconds timeout);
+		std::chrono::nanoseconds idleTimeout() const;
+
+		/// Entries released late, summed over all domains.
+		uint64_t lateCount() const;
+
+		size_t threadCount() const { return thread_count_; }
+		size_t domainCount() const;
+
+	protected:
+		bool checkRunnable() override;
+		void wakeForTimers() override;
+
+	private:
+		struct alignas(64) Lane // one ordering domain
+		{
+			explicit Lane(std::chrono::nanoseconds idle) : merge(idle) {}
+
+			std::mutex					 inbox_mutex;
+			std::vector<SubscriberBase*> inbox;		// ready, not yet drained
+			std::atomic<bool>			 owned{false};
+
+			// Owner only.
+			TimeMergeQueue				 merge;
+			std::vector<SubscriberBase*> batch;
+			std::vector<TimeExecEntry>	 drain_buffer;
+
+			std::atomic<uint64_t>		 wake_at{0};	 // 0 = nothing held back
+			std::atomic<uint64_t>		 late{0};		 // merge.lateCount() snapshot
+			std::atomic<size_t>			 pending{0};	 // merge.pendingSize() snapshot
+		};
+
+		Lane&  laneFor(CallbackGroupBase* group);
+		Lane*  newLane();			// caller holds lanes_mutex_ exclusively
+		size_t collectReady(SubscriberBase** batch, size_t n);
+		void   dispatch(SubscriberBase* const* subs, size_t n);
+		void   runLane(Lane& lane);
+		void   runDueLanes();
+		void   noteWake(uint64_t wake_at);
+		void   workerLoop(size_t index);
+		void   notifyIdle();
+
+		/// Ready subscribers posted per round before their domains merge.
+		static constexpr size_t	  kMaxReadyBatch = 64;
+
+		size_t									   thread_count_;
+		std::vector<std::thread>				   threads_;
+
+		mutable std::shared_mutex				   lanes_mutex_;
+		std::vector<std::unique_ptr<Lane>>		   lanes_;
+		std::unordered_map<CallbackGroupBase*, Lane*> group_lanes_;
+		std::unordered_map<uint32_t, Lane*>		   domain_lanes_;
+		std::atomic<int64_t>					   idle_timeout_ns_;
+
+		/// Earliest Lane::wake_at over all lanes (0 = none).
+		std::atomic<uint64_t>					   next_wake_ns_{ 0 };
+
+		/// Parked workers; notifyIdle() wakes exactly one.
+		EventCount						   idle_ec_;
+	};
+
+} // namespace lux::communication
@@ -1,10 +1,35 @@
 #pragma once
 
+#include <atomic>
+#include <chrono>
 #include <lux/communication/ExecutorBase.hpp>
 #include <lux/communication/ReorderBuffer.hpp>
+#include <lux/communication/TimeMergeQueue.hpp>
 
 namespace lux::communication
 {
+	/**
+	 * @brief Tuning for SeqOrderedExecutor's reorder buffer.
+	 */
+	struct SeqOrderedOptions
+	{
+		/// Reorder ring slots (rounded up to a power of two).  An entry
+		/// further ahead than this forces the head past its gap.
+		size_t ring_capacity = ReorderBuffer::kDefaultRingCapacity;
+
+		/// A subscriber this far ahead of the head is throttled to one entry
+		/// per round so the gap-filling subscriber catches up.
+		uint64_t max_window = 128;
+
+		/// How long a missing sequence number may hold back the entries
+		/// behind it before it is skipped.  0 = wait until the ring is full.
+		std::chrono::nanoseconds gap_timeout = std::chrono::milliseconds(100);
+
+		/// How long a silent sender in another process may hold back the
+		/// messages of the other senders (TimeMergeQueue idle timeout).
+		std::chrono::nanoseconds remote_idle_timeout = std::chrono::milliseconds(1);
+	};
+
 	/**
 	 * @brief Executor that processes callbacks strictly by global sequence number.
 	 *        Ensures that callbacks are executed in the exact order messages were published,
@@ -15,16 +40,31 @@ namespace lux::communication
 	 *        2. Bounded drain (drainExecSome) - only drain a small batch per subscriber
 	 *        3. "Execute first, drain on gap" strategy - prioritize execution over draining
 	 *        4. Round-robin subscriber scheduling via re-notify
+	 *
+	 *        Sequence numbers that will never arrive (content filter,
+	 *        KeepLast overflow, lifespan expiry) are reported through
+	 *        seqConsumed() and skipped in order.  Any other hole blocks the
+	 *        head for at most gap_timeout, or until the ring is full; an entry
+	 *        that shows up after its gap was skipped runs immediately and is
+	 *        counted in stats().late.
+	 *
+	 *        Messages from other processes carry no executor seq: they merge
+	 *        by OrderKey (hybrid stamp, publisher id, process) in a
+	 *        TimeMergeQueue with one source per sender, alongside the
+	 *        in-process sequence.
 	 */
 	class LUX_COMMUNICATION_PUBLIC SeqOrderedExecutor : public ExecutorBase
 	{
 	public:
-		SeqOrderedExecutor() = default;
+		explicit SeqOrderedExecutor(const SeqOrderedOptions& opts = {});
 		~SeqOrderedExecutor() override;
 
 		void spinSome() override;
 		void spin() override;
 		void stop() override;
+		void seqConsumed(uint64_t seq) override;
+
+		const SeqOrderedOptions &options() const { return opts_; }
 
 		/**
 		 * @brief Get diagnostic statistics for performance monitoring.
@@ -41,6 +81,16 @@ namespace lux::communication
 		 */
 		size_t pending_size() const { return buffer_.pending_size(); }
 
+		/**
+		 * @brief Messages from other processes waiting in the merge.
+		 */
+		size_t remote_pending_size() const { return remote_.pendingSize(); }
+
+		/**
+		 * @brief Messages from other processes that ran after a newer one.
+		 */
+		uint64_t remote_late_count() const { return remote_.lateCount(); }
+
 	protected:
 		bool checkRunnable() override;
 		void handleSubscriber(SubscriberBase *sub) override;
@@ -52,6 +102,31 @@ namespace lux::communication
 		 */
 		size_t executeConsecutive();
 
+		/**
+		 * @brief Insert a drained entry; forces the head forward if the ring
+		 *        is full and runs entries whose gap was already skipped.
+		 */
+		void bufferEntry(ExecEntry &e);
+
+		/**
+		 * @brief Route drain_buffer_: in-process entries to the reorder
+		 *        buffer, entries from other processes to the remote merge.
+		 * @return Highest in-process seq drained (0 = none)
+		 */
+		uint64_t bufferDrained(SubscriberBase *sub);
+
+		/**
+		 * @brief Move seqConsumed() notifications into the buffer as markers.
+		 */
+		void absorbConsumed();
+
+		/**
+		 * @brief Skip the head if it has been missing for gap_timeout.
+		 * @return Nanoseconds until it would be skipped (0 = not blocked, or
+		 *         no timeout)
+		 */
+		uint64_t checkGapTimeout();
+
 		/**
 		 * @brief Drain one subscriber with bounded count.
 		 * @return true if any entries were drained
@@ -77,20 +152,36 @@ namespace lux::communication
 		// Default items to drain per subscriber per round.
 		static constexpr size_t kMaxDrainPerSubscriber = 32;
 
-		// Adaptive throttle: when a subscriber's max drained seq exceeds
-		// next_seq by this much, throttle its drain to 1 item so the
-		// gap-filling subscriber catches up.  Keeps the reorder window
-		// bounded at roughly kMaxWindow + one batch span.
-		static constexpr uint64_t kMaxWindow = 128;
-
 		// Max unique subscribers to collect per drain phase.
 		static constexpr size_t kMaxReadyBatch = 64;
 
-		ReorderBuffer buffer_; // Ring buffer with O(1) reordering + fallback
+		// Adaptive throttle (opts_.max_window): when a subscriber's max
+		// drained seq exceeds next_seq by this much, throttle its drain to
+		// 1 item so the gap-filling subscriber catches up.  Keeps the reorder
+		// window bounded at roughly max_window + one batch span.
+		SeqOrderedOptions opts_;
+
+		ReorderBuffer buffer_; // Ring buffer with O(1) reordering
+
+		// Sequence numbers reported by seqConsumed() (any thread).
+		moodycamel::ConcurrentQueue<uint64_t> consumed_;
+		// Set by the first seqConsumed() since the last absorbConsumed();
+		// later drops skip the wakeup.
+		std::atomic<bool> consumed_pending_{false};
+
+		// Head seq that is missing, and since when (steady ns; 0 = none).
+		uint64_t gap_seq_{0};
+		uint64_t gap_since_ns_{0};
 
 		// Reusable buffer for drainOneSubscriber (avoid allocation per call)
 		std::vector<ExecEntry> drain_buffer_;
 
+		// Messages from other processes, merged by OrderKey.
+		TimeMergeQueue			   remote_;
+		std::vector<TimeExecEntry> remote_buffer_;
+		// Steady ns at which held remote entries may run (0 = none held).
+		uint64_t				   remote_wake_ns_{0};
+
 		// Batch buffer: collect unique ready subscribers before draining
 		SubscriberBase* ready_batch_[kMaxReadyBatch]{};
 	};
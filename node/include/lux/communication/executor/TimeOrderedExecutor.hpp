@@ -1,36 +1,69 @@
 #pragma once
 
-#include <queue>
+#include <chrono>
 #include <vector>
 #include <lux/communication/ExecutorBase.hpp>
-#include <lux/communication/TimeExecEntry.hpp>
+#include <lux/communication/TimeMergeQueue.hpp>
 
 namespace lux::communication
 {
+	/// Tuning for TimeOrderedExecutor's merge.
+	struct TimeOrderedOptions
+	{
+		/// How long an empty source may hold the merge back before it is
+		/// treated as idle.  0 = never wait for empty sources.
+		std::chrono::nanoseconds idle_timeout{0};
+	};
+
+	/// Executes callbacks in publish-timestamp order across subscribers.
+	///
+	/// Drained entries go through a TimeMergeQueue: each subscriber is a
+	/// source, and an entry runs once no active source could still deliver
+	/// something older.  Latency is therefore bounded by the slowest *active*
+	/// source; one that stays empty for longer than the idle timeout stops
+	/// holding the merge back, and anything it delivers later that is older
+	/// than what already ran is counted in lateCount().  An idle timeout of 0
+	/// never waits for empty sources, so only entries drained together are
+	/// ordered.
+	///
+	/// Timestamps are the publish time (steady clock): intra-process messages
+	/// are stamped on enqueue, SHM / network messages carry the publisher's
+	/// frame timestamp.
+	///
+	/// All callbacks run on the spinning thread.  ParallelTimeOrderedExecutor
+	/// keeps the order per callback group instead and runs groups in parallel.
 	class LUX_COMMUNICATION_PUBLIC TimeOrderedExecutor : public ExecutorBase
 	{
 	public:
-		explicit TimeOrderedExecutor(std::chrono::nanoseconds time_offset = std::chrono::nanoseconds{0});
+		explicit TimeOrderedExecutor(const TimeOrderedOptions& opts = {});
 		~TimeOrderedExecutor() override;
 
+		/// The fixed time offset is gone: the merge waits on the sources'
+		/// watermarks instead.  Deleted so that old callers do not compile
+		/// with the offset silently reinterpreted; pass TimeOrderedOptions.
+		explicit TimeOrderedExecutor(std::chrono::nanoseconds time_offset) = delete;
+		void setTimeOffset(std::chrono::nanoseconds offset) = delete;
+		std::chrono::nanoseconds getTimeOffset() const = delete;
+
 		void spinSome() override;
 		void spin() override;
 		void stop() override;
 
-		void setTimeOffset(std::chrono::nanoseconds offset);
-		std::chrono::nanoseconds getTimeOffset() const;
+		void setIdleTimeout(std::chrono::nanoseconds timeout);
+		std::chrono::nanoseconds idleTimeout() const;
+
+		/// Entries released after a newer entry had already run.
+		uint64_t lateCount() const { return merge_.lateCount(); }
+
+		/// Entries drained but not yet released.
+		size_t pendingSize() const { return merge_.pendingSize(); }
 
 	protected:
 		bool checkRunnable() override;
 		void handleSubscriber(SubscriberBase *sub) override;
 
 	private:
-		void processReadyEntries();
-
-	private:
-		std::priority_queue<TimeExecEntry> 	buffer_;
-		std::vector<TimeExecEntry>			drain_buffer_;
-		std::chrono::nanoseconds 			time_offset_;
-		uint64_t 							max_timestamp_seen_{0};
+		TimeMergeQueue			   merge_;
+		std::vector<TimeExecEntry> drain_buffer_;
 	};
 } // namespace lux::communication
@@ -0,0 +1,105 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+
+namespace lux::communication
+{
+	/// Bounded Chase–Lev work-stealing deque (Lê et al., "Correct and
+	/// Efficient Work-Stealing for Weak Memory Models", PPoPP'13).
+	///
+	/// The owning worker pushes and pops at the bottom (LIFO, cache-hot);
+	/// any other thread steals from the top (FIFO).  The buffer does not
+	/// grow: push() returns false when full and the caller falls back to a
+	/// shared queue.
+	template<typename T>
+		requires std::is_pointer_v<T>
+	class WorkStealingDeque
+	{
+	public:
+		/// @param capacity  Rounded up to a power of two.
+		explicit WorkStealingDeque(size_t capacity = 1024)
+		{
+			size_t cap = 1;
+			while (cap < capacity)
+				cap <<= 1;
+			mask_	= static_cast<int64_t>(cap - 1);
+			buffer_ = std::make_unique<std::atomic<T>[]>(cap);
+		}
+
+		WorkStealingDeque(const WorkStealingDeque&) = delete;
+		WorkStealingDeque& operator=(const WorkStealingDeque&) = delete;
+
+		/// Owner only.
+		bool push(T item)
+		{
+			const int64_t b = bottom_.load(std::memory_order_relaxed);
+			const int64_t t = top_.load(std::memory_order_acquire);
+			if (b - t > mask_)
+				return false;
+			buffer_[b & mask_].store(item, std::memory_order_relaxed);
+			std::atomic_thread_fence(std::memory_order_release);
+			bottom_.store(b + 1, std::memory_order_relaxed);
+			return true;
+		}
+
+		/// Owner only.
+		bool pop(T& out)
+		{
+			const int64_t b = bottom_.load(std::memory_order_relaxed) - 1;
+			bottom_.store(b, std::memory_order_relaxed);
+			std::atomic_thread_fence(std::memory_order_seq_cst);
+			int64_t t = top_.load(std::memory_order_relaxed);
+
+			if (t > b)
+			{
+				bottom_.store(b + 1, std::memory_order_relaxed); // empty
+				return false;
+			}
+
+			out = buffer_[b & mask_].load(std::memory_order_relaxed);
+			if (t == b)
+			{
+				// Last element: race against thieves for it.
+				const bool won = top_.compare_exchange_strong(
+					t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed);
+				bottom_.store(b + 1, std::memory_order_relaxed);
+				return won;
+			}
+			return true;
+		}
+
+		/// Any thread.
+		bool steal(T& out)
+		{
+			int64_t t = top_.load(std::memory_order_acquire);
+			std::atomic_thread_fence(std::memory_order_seq_cst);
+			const int64_t b = bottom_.load(std::memory_order_acquire);
+			if (t >= b)
+				return false;
+
+			T item = buffer_[t & mask_].load(std::memory_order_relaxed);
+			if (!top_.compare_exchange_strong(
+					t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+				return false; // lost to the owner or another thief
+			out = item;
+			return true;
+		}
+
+		bool emptyApprox() const
+		{
+			return bottom_.load(std::memory_order_relaxed) <=
+				   top_.load(std::memory_order_relaxed);
+		}
+
+	private:
+		alignas(64) std::atomic<int64_t> top_{0};
+		alignas(64) std::atomic<int64_t> bottom_{0};
+		int64_t							 mask_;
+		std::unique_ptr<std::atomic<T>[]> buffer_;
+	};
+
+} // namespace lux::communication
@@ -39,7 +39,7 @@ namespace lux::communication::intraprocess
             for (size_t i = 0; i < n; ++i)
             {
                 auto sub = static_cast<Subscriber<T> *>((*snapshot)[i]);
-                auto *exec = sub->callbackGroup()->executor();
+                auto *exec = sub->executor();
                 const uint64_t seq = exec ? exec->allocateSeq() : 0;
                 if (i + 1 < n)
                     sub->enqueue(seq, msg);           // copy for non-last
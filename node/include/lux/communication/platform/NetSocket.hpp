@@ -81,11 +81,28 @@ namespace lux::communication::platform
         int sendToV(const IoVec *iov, int iovcnt,
                     const std::string &dest_addr, uint16_t dest_port);
 
+        /// Scatter-gather send with a kernel departure time (steady-clock ns).
+        /// Requires enableTxTime(); otherwise behaves like sendToV().
+        int sendToVAt(const IoVec *iov, int iovcnt,
+                      const std::string &dest_addr, uint16_t dest_port,
+                      uint64_t txtime_ns);
+
+        /// Enable per-datagram departure times (Linux SO_TXTIME on the
+        /// monotonic clock).  Returns false where unsupported.
+        bool enableTxTime();
+        bool txTimeEnabled() const { return txtime_enabled_; }
+
         /// Receive a datagram.
         /// Returns bytes received, 0 = would-block (non-blocking), -1 = error.
         int recvFrom(void *buf, size_t max_len,
                      std::string &src_addr, uint16_t &src_port);
 
+        /// Receive a datagram without blocking, even if the socket itself is in
+        /// blocking mode (used by send-side sockets to pick up feedback).
+        /// Returns bytes received, 0 = nothing pending, -1 = error.
+        int tryRecvFrom(void *buf, size_t max_len,
+                        std::string &src_addr, uint16_t &src_port);
+
         // ── accessors ──
 
         socket_t nativeFd() const { return sock_; }
@@ -95,6 +112,7 @@ namespace lux::communication::platform
 
     private:
         socket_t sock_ = kInvalidSocket;
+        bool txtime_enabled_ = false;
 
         /// Create the underlying OS socket (AF_INET, SOCK_DGRAM).
         bool ensureSocket();
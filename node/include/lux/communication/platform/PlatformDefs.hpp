@@ -1,6 +1,9 @@
 #pragma once
+#include <atomic>
 #include <string>
+#include <cstddef>
 #include <cstdint>
+#include <lux/communication/ThreadOptions.hpp>
 #include <lux/communication/visibility.h>
 
 namespace lux::communication::platform
@@ -26,4 +29,31 @@ namespace lux::communication::platform
     /// Get a monotonic (steady) clock timestamp in nanoseconds.
     LUX_COMMUNICATION_PUBLIC uint64_t steadyNowNs();
 
+    /// Block while `word` holds `expected`, for at most `timeout_ns`
+    /// (UINT64_MAX = no limit).  May return early; the caller re-checks.
+    /// @return false if the timeout expired.
+    LUX_COMMUNICATION_PUBLIC bool futexWait(std::atomic<uint32_t> &word, uint32_t expected,
+                                            uint64_t timeout_ns);
+
+    /// Wake up to `count` threads blocked in futexWait() on `word`.
+    LUX_COMMUNICATION_PUBLIC void futexWake(std::atomic<uint32_t> &word, uint32_t count);
+
+    /// Apply `opts` to the calling thread, worker `index` of a pool of `count`.
+    /// Every requested setting is attempted; the ones that fail are described
+    /// in `error` (if given) and leave the thread as it was.
+    /// @return true if every requested setting took effect.
+    LUX_COMMUNICATION_PUBLIC bool applyThreadOptions(const ThreadOptions &opts, size_t index,
+                                                     size_t count, std::string *error = nullptr);
+
+    /// Name of thread `index` of `count` for `base`, shortened to `max_len`
+    /// characters without dropping the worker index.
+    inline std::string workerThreadName(const std::string &base, size_t index, size_t count,
+                                        size_t max_len)
+    {
+        const std::string suffix = count > 1 ? "-" + std::to_string(index) : std::string();
+        if (suffix.size() >= max_len)
+            return suffix.substr(suffix.size() - max_len);
+        return base.substr(0, max_len - suffix.size()) + suffix;
+    }
+
 } // namespace lux::communication::platform
@@ -0,0 +1,136 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+#include <lux/communication/platform/NetSocket.hpp>
+#include <lux/communication/visibility.h>
+
+namespace lux::communication::platform
+{
+    /// Whether Unix domain sockets with descriptor passing are available
+    /// (POSIX: yes; Windows: no — every call below fails gracefully).
+    LUX_COMMUNICATION_PUBLIC bool unixSocketsSupported();
+
+    // ── UnixSocket ────────────────────────────────────────────────────────────────
+
+    /// Connected AF_UNIX SOCK_SEQPACKET socket.
+    ///
+    /// Message boundaries are preserved, so one send() is one frame, and a
+    /// file descriptor may ride along with a message (SCM_RIGHTS).
+    class LUX_COMMUNICATION_PUBLIC UnixSocket
+    {
+    public:
+        UnixSocket() = default;
+        explicit UnixSocket(int fd) : fd_(fd) {}
+        ~UnixSocket();
+
+        UnixSocket(UnixSocket &&o) noexcept;
+        UnixSocket &operator=(UnixSocket &&o) noexcept;
+
+        UnixSocket(const UnixSocket &) = delete;
+        UnixSocket &operator=(const UnixSocket &) = delete;
+
+        /// Connect to a listening socket at @p path (blocking).
+        bool connect(const std::string &path);
+
+        bool setNonBlocking(bool on);
+        bool setSendBufferSize(int bytes);
+        bool setRecvBufferSize(int bytes);
+
+        /// Send one message, optionally passing @p pass_fd (-1 = none).
+        /// Returns bytes sent, 0 = would-block (non-blocking), -1 = error.
+        int sendV(const IoVec *iov, int iovcnt, int pass_fd = -1);
+
+        /// Blocking send of one message.
+        bool sendAll(const void *data, size_t len);
+
+        /// Receive one message.  A passed descriptor is returned in
+        /// @p received_fd (-1 if none; the caller owns it).
+        /// Returns bytes received, 0 = peer closed, -1 = error / would-block.
+        int recv(void *buf, size_t max_len, int &received_fd);
+
+        /// Blocking receive of exactly one @p len byte message.
+        bool recvExact(void *buf, size_t len);
+
+        socket_t nativeFd() const { return static_cast<socket_t>(fd_); }
+        bool isValid() const { return fd_ >= 0; }
+        void close();
+
+    private:
+        int fd_ = -1;
+    };
+
+    // ── UnixListener ──────────────────────────────────────────────────────────────
+
+    /// Listening AF_UNIX SOCK_SEQPACKET socket bound to a filesystem path.
+    /// close() unlinks the path.
+    class LUX_COMMUNICATION_PUBLIC UnixListener
+    {
+    public:
+        UnixListener() = default;
+        ~UnixListener();
+
+        UnixListener(UnixListener &&o) noexcept;
+        UnixListener &operator=(UnixListener &&o) noexcept;
+
+        UnixListener(const UnixListener &) = delete;
+        UnixListener &operator=(const UnixListener &) = delete;
+
+        /// Bind to @p path (a stale socket file is replaced) and listen.
+        bool listen(const std::string &path, int backlog = 64);
+
+        /// Accept one pending connection (invalid socket if none / error).
+        UnixSocket accept();
+
+        socket_t nativeFd() const { return static_cast<socket_t>(fd_); }
+        const std::string &path() const { return path_; }
+        bool isValid() const { return fd_ >= 0; }
+        void close();
+
+    private:
+        int fd_ = -1;
+        std::string path_;
+    };
+
+    // ── MemFdRegion ───────────────────────────────────────────────────────────────
+
+    /// An anonymous shared-memory file (memfd on Linux) mapped into this
+    /// process.  Large payloads are written into one and the descriptor is
+    /// passed over a UnixSocket instead of the bytes.
+    class LUX_COMMUNICATION_PUBLIC MemFdRegion
+    {
+    public:
+        MemFdRegion() = default;
+        ~MemFdRegion();
+
+        MemFdRegion(MemFdRegion &&o) noexcept;
+        MemFdRegion &operator=(MemFdRegion &&o) noexcept;
+
+        MemFdRegion(const MemFdRegion &) = delete;
+        MemFdRegion &operator=(const MemFdRegion &) = delete;
+
+        /// Create a writable region of @p size bytes (invalid on failure).
+        static MemFdRegion create(size_t size);
+
+        /// Map a received descriptor read-only; takes ownership of @p fd.
+        static MemFdRegion mapReadOnly(int fd, size_t size);
+
+        uint8_t *data() const { return data_; }
+        size_t size() const { return size_; }
+        int fd() const { return fd_; }
+        bool isValid() const { return data_ != nullptr; }
+
+        /// Unmap and close the descriptor.
+        void reset();
+
+    private:
+        int fd_ = -1;
+        uint8_t *data_ = nullptr;
+        size_t size_ = 0;
+    };
+
+    /// Close a raw descriptor (e.g. one received but not mapped).
+    LUX_COMMUNICATION_PUBLIC void closeFd(int fd);
+
+} // namespace lux::communication::platform
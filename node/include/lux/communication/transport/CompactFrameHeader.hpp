@@ -0,0 +1,198 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+
+#include <lux/communication/transport/FrameHeader.hpp>
+
+namespace lux::communication::transport
+{
+    /// First byte of a compact frame.  Cannot collide with the little-endian
+    /// first byte of FrameHeader (0x46), FragmentHeader (0x47) or LinkReport (0x52).
+    static constexpr uint8_t kCompactFrameMarker = 0xC5;
+
+    /// Tag in the top 16 bits of FrameHeader::reserved marking a *binding*
+    /// frame: a full-header frame that (re)establishes the baseline compact
+    /// frames from the same sender are decoded against.
+    ///
+    ///   reserved = kCompactBindTag << 48 | epoch << 16 | topic_id
+    static constexpr uint64_t kCompactBindTag = 0x4342; // "CB"
+
+    /// Upper bound of an encoded compact header (marker, control, three
+    /// varints and a zigzag timestamp delta).
+    static constexpr size_t kMaxCompactHeaderSize = 1 + 1 + 3 + 10 + 3 + 10;
+
+    /// Compact frames carry at most this many frames per binding, and a new
+    /// binding is sent once the timestamp moved this far from its baseline,
+    /// so a lost binding frame costs a bounded number of frames.
+    static constexpr uint32_t kCompactRebindFrames = 64;
+    static constexpr uint64_t kCompactRebindIntervalNs = 100'000'000; // 100 ms
+
+    /// Compact wire header for small unfragmented UDP frames (negotiated).
+    ///
+    /// Layout (variable, 4–28 bytes, vs. 48 for FrameHeader):
+    ///  ┌──────────┬──────────┬─────────────────┬──────────────────┬───────────┬──────────────┐
+    ///  │ marker 1B│ ctl 1B   │ topic_id varint │ seq_delta varint │ [flags v] │ [ts_delta zz]│
+    ///  └──────────┴──────────┴─────────────────┴──────────────────┴───────────┴──────────────┘
+    ///   ctl bit 0     : timestamp present (zigzag delta from the binding's timestamp)
+    ///   ctl bit 1     : flags present (otherwise the binding's flags apply)
+    ///   ctl bits 4–7  : binding epoch (low 4 bits)
+    ///
+    /// Sequence and timestamp are deltas against the *binding* frame, not
+    /// the previous frame, so a lost compact frame never corrupts the next.
+    /// payload_size is implied by the datagram length.
+    struct CompactFields
+    {
+        uint16_t topic_id = 0;
+        uint8_t epoch = 0;   ///< Low 4 bits of the binding epoch
+        uint64_t seq_delta = 0;
+        bool has_flags = false;
+        uint16_t flags = 0;
+        bool has_timestamp = false;
+        int64_t timestamp_delta = 0;
+    };
+
+    /// Baseline a compact frame is decoded against (taken from its binding frame).
+    struct CompactBinding
+    {
+        uint64_t topic_hash = 0;
+        uint64_t base_seq = 0;
+        uint64_t base_timestamp_ns = 0;
+        uint32_t publisher_id = 0;
+        uint16_t flags = 0;
+        uint8_t epoch = 0;
+    };
+
+    // ──── Varint helpers (LEB128) ────
+
+    inline size_t writeVarint(uint8_t *out, uint64_t v)
+    {
+        size_t n = 0;
+        while (v >= 0x80)
+        {
+            out[n++] = static_cast<uint8_t>(v | 0x80);
+            v >>= 7;
+        }
+        out[n++] = static_cast<uint8_t>(v);
+        return n;
+    }
+
+    /// @return Bytes consumed, or 0 on truncated / overlong input.
+    inline size_t readVarint(const uint8_t *in, size_t len, uint64_t &v)
+    {
+        v = 0;
+        for (size_t i = 0; i < len && i < 10; ++i)
+        {
+            v |= static_cast<uint64_t>(in[i] & 0x7F) << (7 * i);
+            if ((in[i] & 0x80) == 0)
+                return i + 1;
+        }
+        return 0;
+    }
+
+    inline uint64_t zigzagEncode(int64_t v) { return (static_cast<uint64_t>(v) << 1) ^ static_cast<uint64_t>(v >> 63); }
+    inline int64_t zigzagDecode(uint64_t v) { return static_cast<int64_t>(v >> 1) ^ -static_cast<int64_t>(v & 1); }
+
+    // ──── Binding tag helpers ────
+
+    inline uint64_t makeCompactBindTag(uint16_t topic_id, uint8_t epoch)
+    {
+        return (kCompactBindTag << 48) | (static_cast<uint64_t>(epoch) << 16) | topic_id;
+    }
+
+    inline bool isCompactBinding(const FrameHeader &h) { return (h.reserved >> 48) == kCompactBindTag; }
+    inline uint16_t compactBindTopicId(const FrameHeader &h) { return static_cast<uint16_t>(h.reserved); }
+    inline uint8_t compactBindEpoch(const FrameHeader &h) { return static_cast<uint8_t>(h.reserved >> 16); }
+
+    inline bool isCompactFrame(const void *data, size_t len)
+    {
+        return len >= 4 && *static_cast<const uint8_t *>(data) == kCompactFrameMarker;
+    }
+
+    // ──── Encode / decode ────
+
+    /// Encode @p hdr against @p base into @p out (≥ kMaxCompactHeaderSize bytes).
+    /// @return Header length, or 0 if @p hdr cannot be expressed against
+    ///         @p base (sequence went backwards) — send a full header instead.
+    inline size_t encodeCompactHeader(uint8_t *out, const FrameHeader &hdr,
+                                      uint16_t topic_id, const CompactBinding &base)
+    {
+        if (hdr.seq_num < base.base_seq)
+            return 0;
+
+        const bool has_ts = hdr.timestamp_ns != 0;
+        const bool has_flags = hdr.flags != base.flags;
+
+        size_t n = 0;
+        out[n++] = kCompactFrameMarker;
+        out[n++] = static_cast<uint8_t>((has_ts ? 0x01 : 0) | (has_flags ? 0x02 : 0) |
+                                        ((base.epoch & 0x0F) << 4));
+        n += writeVarint(out + n, topic_id);
+        n += writeVarint(out + n, hdr.seq_num - base.base_seq);
+        if (has_flags)
+            n += writeVarint(out + n, hdr.flags);
+        if (has_ts)
+            n += writeVarint(out + n, zigzagEncode(static_cast<int64_t>(
+                                          hdr.timestamp_ns - base.base_timestamp_ns)));
+        return n;
+    }
+
+    /// Parse a compact header.
+    /// @return Header length (payload follows), or 0 if malformed.
+    inline size_t parseCompactHeader(const uint8_t *in, size_t len, CompactFields &f)
+    {
+        if (len < 4 || in[0] != kCompactFrameMarker)
+            return 0;
+        const uint8_t ctl = in[1];
+        f.has_timestamp = (ctl & 0x01) != 0;
+        f.has_flags = (ctl & 0x02) != 0;
+        f.epoch = static_cast<uint8_t>(ctl >> 4);
+
+        size_t n = 2;
+        uint64_t v = 0;
+        size_t k = readVarint(in + n, len - n, v);
+        if (k == 0 || v > UINT16_MAX)
+            return 0;
+        f.topic_id = static_cast<uint16_t>(v);
+        n += k;
+
+        k = readVarint(in + n, len - n, f.seq_delta);
+        if (k == 0)
+            return 0;
+        n += k;
+
+        if (f.has_flags)
+        {
+            k = readVarint(in + n, len - n, v);
+            if (k == 0 || v > UINT16_MAX)
+                return 0;
+            f.flags = static_cast<uint16_t>(v);
+            n += k;
+        }
+        if (f.has_timestamp)
+        {
+            k = readVarint(in + n, len - n, v);
+            if (k == 0)
+                return 0;
+            f.timestamp_delta = zigzagDecode(v);
+            n += k;
+        }
+        return n;
+    }
+
+    /// Rebuild the full FrameHeader of a compact frame.
+    inline FrameHeader expandCompactHeader(const CompactFields &f, const CompactBinding &base,
+                                           uint32_t payload_size)
+    {
+        FrameHeader hdr{};
+        hdr.flags = f.has_flags ? f.flags : base.flags;
+        hdr.topic_hash = base.topic_hash;
+        hdr.seq_num = base.base_seq + f.seq_delta;
+        hdr.timestamp_ns = f.has_timestamp
+                               ? base.base_timestamp_ns + static_cast<uint64_t>(f.timestamp_delta)
+                               : 0;
+        hdr.payload_size = payload_size;
+        hdr.publisher_id = base.publisher_id;
+        return hdr;
+    }
+
+} // namespace lux::communication::transport
@@ -2,32 +2,49 @@
 #include <cstdint>
 #include <chrono>
 #include <optional>
-#include <unordered_map>
 #include <vector>
 
 #include <lux/communication/transport/FragmentHeader.hpp>
+#include <lux/communication/transport/ReassemblyBufferPool.hpp>
 #include <lux/communication/visibility.h>
 
 namespace lux::communication::transport
 {
     /// Reassembles fragmented UDP messages from individual datagrams.
     ///
+    /// Allocation-free in steady state: in-flight groups live in a fixed table
+    /// of slots, each tracking arrivals in a word-wide bitmap (whose storage is
+    /// kept across uses), and message bytes are assembled directly into
+    /// size-classed, pre-touched buffers from a ReassemblyBufferPool.  A
+    /// completed message *lends* its buffer to the caller, and the buffer goes
+    /// back to the pool when the CompleteMessage is destroyed.
+    ///
+    /// When all slots are busy, the oldest in-flight group is evicted.
+    ///
     /// Thread-safety: **not** thread-safe. Intended to be called from a single
-    /// IO thread (the Reactor thread).
+    /// IO thread (the Reactor thread).  CompleteMessage must not outlive the
+    /// assembler and must be destroyed on the same thread.
     class LUX_COMMUNICATION_PUBLIC FragmentAssembler
     {
     public:
-        /// @param timeout  Max time to wait for all fragments of a group.
+        /// @param timeout    Max time to wait for all fragments of a group.
+        /// @param max_slots  Concurrent in-flight groups before eviction.
         explicit FragmentAssembler(
-            std::chrono::milliseconds timeout = std::chrono::milliseconds{200});
+            std::chrono::milliseconds timeout = std::chrono::milliseconds{200},
+            size_t max_slots = 64);
 
         ~FragmentAssembler();
 
-        /// A fully reassembled message (FrameHeader + serialized payload).
+        /// A fully reassembled message (FrameHeader + serialized payload),
+        /// backed by a pooled buffer that is returned on destruction.
         struct CompleteMessage
         {
-            std::vector<uint8_t> data;
-            uint64_t topic_hash;
+            PooledBuffer buffer;
+            uint32_t length = 0;
+            uint64_t topic_hash = 0;
+
+            const uint8_t *data() const { return buffer.data(); }
+            size_t size() const { return length; }
         };
 
         /// Feed one received fragment.
@@ -47,45 +64,44 @@ namespace lux::communication::transport
             uint64_t timed_out_groups = 0;
             uint64_t duplicate_fragments = 0;
             uint64_t pending_groups = 0;
+            uint64_t evicted_groups = 0;   ///< Dropped because every slot was busy
+            uint64_t buffer_allocations = 0; ///< Pool buffers taken from the heap
         };
         Stats stats() const;
 
+        /// Buffer pool (e.g. to prewarm() for a known message size).
+        ReassemblyBufferPool &bufferPool() { return pool_; }
+
         /// Reset all state (for testing).
         void reset();
 
     private:
-        struct FragmentGroup
+        struct Slot
         {
-            std::vector<uint8_t> buffer; // pre-allocated to total_msg_size
-            std::vector<bool> received;  // which fragments have arrived
+            bool in_use = false;
+            uint64_t topic_hash = 0;
+            uint32_t group_id = 0;
             uint16_t total_fragments = 0;
             uint16_t received_count = 0;
             uint32_t total_msg_size = 0;
-            uint64_t topic_hash = 0;
             std::chrono::steady_clock::time_point created_at;
+            PooledBuffer buffer;
+            std::vector<uint64_t> received; // bitmap; capacity retained across uses
         };
 
-        struct GroupKey
-        {
-            uint64_t topic_hash;
-            uint32_t group_id;
-            bool operator==(const GroupKey &) const = default;
-        };
-
-        struct GroupKeyHash
-        {
-            size_t operator()(const GroupKey &k) const
-            {
-                return std::hash<uint64_t>{}(k.topic_hash) ^ (std::hash<uint32_t>{}(k.group_id) << 1);
-            }
-        };
+        Slot *findSlot(uint64_t topic_hash, uint32_t group_id);
+        Slot *claimSlot();
+        void freeSlot(Slot &slot);
 
-        std::unordered_map<GroupKey, FragmentGroup, GroupKeyHash> groups_;
+        ReassemblyBufferPool pool_;
+        std::vector<Slot> slots_;
+        size_t in_use_ = 0;
         std::chrono::milliseconds timeout_;
 
         uint64_t stat_complete_ = 0;
         uint64_t stat_timed_out_ = 0;
         uint64_t stat_duplicates_ = 0;
+        uint64_t stat_evicted_ = 0;
     };
 
 } // namespace lux::communication::transport
@@ -0,0 +1,97 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+
+#include <lux/communication/visibility.h>
+
+namespace lux::communication::transport
+{
+    /// Optional controller that adapts the pacing rate to link feedback.
+    enum class CongestionControl : uint8_t
+    {
+        None = 0,       ///< Fixed rate.
+        LossBased = 1,  ///< ×0.7 on fragment-group loss, +1/8 per clean report.
+        DelayBased = 2, ///< LossBased, plus back off when SRTT rises above the path minimum.
+    };
+
+    /// Per-peer UDP fragment pacing configuration.
+    struct PacingConfig
+    {
+        /// Initial send rate in bytes/sec.  0 = pacing disabled (fragments
+        /// leave back-to-back, the pre-pacing behaviour).
+        uint64_t rate_bytes_per_sec = 0;
+        /// Bytes that may leave back-to-back after an idle period.
+        uint32_t burst_bytes = 64 * 1024;
+        /// Hand per-fragment departure times to the kernel (Linux SO_TXTIME;
+        /// needs the fq or etf qdisc).  Falls back to software pacing when
+        /// the socket option is unavailable.
+        bool use_txtime = false;
+        /// Pace fragmented frames on a per-peer sender thread so publish()
+        /// does not block for the duration of a large frame.
+        bool dedicated_sender = true;
+        /// Dedicated-sender backlog limit; newer frames are dropped beyond it.
+        size_t max_queued_bytes = 32u * 1024u * 1024u;
+
+        CongestionControl congestion = CongestionControl::None;
+        uint64_t min_rate_bytes_per_sec = 1024 * 1024;           ///< Controller floor
+        uint64_t max_rate_bytes_per_sec = 1250ull * 1000 * 1000; ///< Controller ceiling (10 Gbit/s)
+    };
+
+    /// Rate-based pacer for UDP fragments (token bucket expressed as a
+    /// "next departure time", so every datagram gets an exact send slot).
+    ///
+    /// Thread-safety: all methods are thread-safe.  The publish thread,
+    /// a dedicated sender thread and the IoThread (feedback) may share one.
+    class LUX_COMMUNICATION_PUBLIC FragmentPacer
+    {
+    public:
+        explicit FragmentPacer(const PacingConfig &cfg = {});
+
+        bool enabled() const { return cfg_.rate_bytes_per_sec != 0; }
+        const PacingConfig &config() const { return cfg_; }
+
+        /// Whether the socket accepted SO_TXTIME (set by the owner).
+        void setKernelPacing(bool on) { kernel_pacing_ = on; }
+        bool kernelPacing() const { return kernel_pacing_; }
+
+        /// Reserve @p bytes of send budget at local steady time @p now_ns.
+        /// @return The departure time (steady ns) for these bytes.
+        uint64_t reserve(size_t bytes, uint64_t now_ns);
+
+        /// Block until steady time @p t_ns (sleep for long waits, spin for the tail).
+        static void waitUntil(uint64_t t_ns);
+
+        /// Congestion-control input, typically one call per LinkReport.
+        /// @param lost_groups      New fragment groups the receiver timed out or evicted.
+        /// @param complete_groups  New fragment groups reassembled at the receiver.
+        /// @param srtt_ns          Current smoothed RTT (0 = unknown).
+        void onFeedback(uint64_t lost_groups, uint64_t complete_groups, uint64_t srtt_ns);
+
+        /// Current pacing rate (bytes/sec).
+        uint64_t rate() const;
+
+        struct Stats
+        {
+            uint64_t rate_bytes_per_sec = 0;
+            uint64_t paced_bytes = 0;
+            uint64_t rate_decreases = 0;
+            uint64_t rate_increases = 0;
+        };
+        Stats stats() const;
+
+    private:
+        PacingConfig cfg_;
+        bool kernel_pacing_ = false;
+
+        mutable std::mutex mutex_;
+        double rate_;           // bytes/sec
+        uint64_t next_tx_ns_ = 0;
+        uint64_t min_rtt_ns_ = 0;
+
+        uint64_t paced_bytes_ = 0;
+        uint64_t decreases_ = 0;
+        uint64_t increases_ = 0;
+    };
+
+} // namespace lux::communication::transport
@@ -6,8 +6,13 @@
 
 namespace lux::communication::transport
 {
+    class FragmentPacer;
+
     /// Splits a contiguous message (FrameHeader + payload) into fragments
     /// and sends each fragment as a separate UDP datagram.
+    ///
+    /// With a FragmentPacer, each fragment is given a departure slot: either
+    /// handed to the kernel (SO_TXTIME) or waited for in the calling thread.
     class LUX_COMMUNICATION_PUBLIC FragmentSender
     {
     public:
@@ -22,11 +27,13 @@ namespace lux::communication::transport
         /// @param topic_hash  Placed in each FragmentHeader for routing.
         /// @param dest_addr   Remote IPv4 address.
         /// @param dest_port   Remote UDP port.
+        /// @param pacer       Optional pacer (nullptr = back-to-back).
         /// @return true if all fragments were sent successfully.
         bool send(uint32_t group_id,
                   const void *data, size_t len,
                   uint64_t topic_hash,
-                  const std::string &dest_addr, uint16_t dest_port);
+                  const std::string &dest_addr, uint16_t dest_port,
+                  FragmentPacer *pacer = nullptr);
 
     private:
         platform::UdpSocket &sock_;
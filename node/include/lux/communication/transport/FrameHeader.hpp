@@ -29,10 +29,10 @@ namespace lux::communication::transport
         uint16_t version = 1;         // 0x04
         uint16_t flags = 0;           // 0x06
         uint64_t topic_hash = 0;      // 0x08
-        uint64_t seq_num = 0;         // 0x10
-        uint64_t timestamp_ns = 0;    // 0x18
+        uint64_t seq_num = 0;         // 0x10  per publisher
+        uint64_t timestamp_ns = 0;    // 0x18  publisher's HybridClock
         uint32_t payload_size = 0;    // 0x20  (excludes this header)
-        uint32_t header_crc = 0;      // 0x24  (optional, debug use)
+        uint32_t publisher_id = 0;    // 0x24  unique within the sending process
         uint64_t reserved = 0;        // 0x28  pad to 48B
     };
 
@@ -89,6 +89,13 @@ namespace lux::communication::transport
     inline bool isPong(const FrameHeader &h) { return (h.flags & kFlagPong) != 0; }
     inline void setPong(FrameHeader &h) { h.flags |= kFlagPong; }
 
+    /// bit 10: payload travels in a passed memfd (Unix domain socket transport);
+    ///         payload_size is its length and no bytes follow the header.
+    static constexpr uint16_t kFlagMemFd = 0x0400;
+
+    inline bool isMemFd(const FrameHeader &h) { return (h.flags & kFlagMemFd) != 0; }
+    inline void setMemFd(FrameHeader &h) { h.flags |= kFlagMemFd; }
+
     /// Control frames (Ping / Pong) carry no user payload.
     inline bool isControlFrame(const FrameHeader &h)
     {
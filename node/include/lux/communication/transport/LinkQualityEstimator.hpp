@@ -0,0 +1,98 @@
+#pragma once
+#include <cstdint>
+#include <chrono>
+
+#include <lux/communication/transport/LinkReport.hpp>
+#include <lux/communication/visibility.h>
+
+namespace lux::communication::transport
+{
+    /// Tuning knobs for LinkQualityEstimator.
+    struct LinkQualityConfig
+    {
+        /// Smallest UDP threshold: frames that fit a single datagram always go UDP.
+        uint32_t min_udp_threshold = 1472;
+        /// Largest UDP threshold reached on a loss-free link.
+        uint32_t max_udp_threshold = 8u * 1024u * 1024u;
+        /// Acceptable probability of losing one fragmented message.
+        double target_msg_loss = 0.01;
+        /// EWMA weight for per-fragment loss samples.
+        double loss_alpha = 0.25;
+        /// EWMA weight for RTT samples (RFC 6298).
+        double rtt_alpha = 0.125;
+        /// A new threshold is only applied once it differs from the current
+        /// one by more than this factor (hysteresis band).
+        double hysteresis = 1.5;
+        /// Minimum time between two threshold increases.
+        std::chrono::milliseconds min_dwell{500};
+        /// Without fresh loss samples, grow the threshold after this long so
+        /// that a recovered link is eventually probed again.
+        std::chrono::milliseconds probe_interval{2000};
+        /// Estimates older than max(stale_timeout, 8 × SRTT) are discarded.
+        std::chrono::milliseconds stale_timeout{1000};
+    };
+
+    /// Per-peer estimate of UDP fragment loss and RTT, used to choose between
+    /// UDP and TCP per message size at runtime.
+    ///
+    /// Loss is measured on fragment groups (reported back by the receiver as
+    /// assembler completions vs. timed-out or evicted groups) and converted into a per-fragment
+    /// loss rate using the average number of fragments per group sent.  From
+    /// that the estimator derives the largest message that still meets
+    /// @c target_msg_loss over UDP — anything larger should use TCP.
+    ///
+    /// Thread-safety: **not** thread-safe; guarded by the owner's mutex.
+    class LUX_COMMUNICATION_PUBLIC LinkQualityEstimator
+    {
+    public:
+        explicit LinkQualityEstimator(const LinkQualityConfig &cfg = {});
+
+        /// Record that a fragmented message of @p fragments was sent.
+        void onGroupSent(uint32_t fragments);
+
+        /// Feed a report received from the peer at local time @p now_ns.
+        void onReport(const LinkReport &rep, uint64_t now_ns);
+
+        /// Largest frame size (FrameHeader + payload) that should go over UDP.
+        /// Returns @p fallback while no fresh estimate is available.
+        uint32_t udpThreshold(uint32_t fallback, uint64_t now_ns) const;
+
+        /// Whether a fresh estimate is available at @p now_ns.
+        bool hasEstimate(uint64_t now_ns) const;
+
+        /// Snapshot of the current estimate.
+        struct Stats
+        {
+            double fragment_loss = 0.0;   ///< Smoothed per-fragment loss rate
+            uint64_t srtt_ns = 0;         ///< Smoothed RTT (0 = no sample yet)
+            uint32_t udp_threshold = 0;   ///< Current adaptive threshold
+            uint64_t reports = 0;         ///< Reports accepted
+            uint64_t threshold_changes = 0;
+        };
+        Stats stats() const;
+
+        void reset();
+
+    private:
+        void updateThreshold(bool have_loss_sample, uint64_t now_ns);
+
+        LinkQualityConfig cfg_;
+
+        double frag_loss_ = 0.0;
+        double avg_frags_per_group_ = 1.0;
+        uint64_t srtt_ns_ = 0;
+        uint32_t threshold_ = 0;
+
+        uint64_t last_complete_ = 0;
+        uint64_t last_lost_ = 0;
+        uint64_t last_echo_ts_ = 0;
+        uint64_t last_report_ns_ = 0;
+        uint64_t last_change_ns_ = 0;
+        uint64_t last_loss_sample_ns_ = 0;
+
+        uint64_t reports_ = 0;
+        uint64_t threshold_changes_ = 0;
+        bool has_loss_sample_ = false;
+    };
+
+} // namespace lux::communication::transport
@@ -0,0 +1,50 @@
+#pragma once
+#include <cstdint>
+#include <cstring>
+
+namespace lux::communication::transport
+{
+    /// Magic number for link-quality reports — "LUXR".
+    static constexpr uint32_t kLinkReportMagic = 0x4C555852;
+
+    /// LinkReport::capabilities bit: the reader decodes CompactFrameHeader.
+    static constexpr uint32_t kLinkCapCompactHeader = 0x1;
+
+    /// Feedback datagram sent by a UdpTransportReader back to the source
+    /// address of the frames it receives.  The UdpTransportWriter feeds it into
+    /// its LinkQualityEstimator to drive adaptive UDP/TCP path selection.
+    ///
+    /// Counters are cumulative so that a lost report only delays (never skews)
+    /// the loss estimate.  The capability bits let the writer negotiate wire
+    /// features (e.g. compact headers) with readers that understand them.
+    ///
+    /// Layout (48 bytes):
+    ///  ┌──────────────┬──────────────┬─────────────────────┐
+    ///  │ magic 4B     │ caps 4B      │ topic_hash 8B       │
+    ///  │ complete_groups 8B          │ lost_groups 8B      │
+    ///  │ echo_timestamp_ns 8B        │ echo_delay_ns 8B    │
+    ///  └─────────────────────────────┴─────────────────────┘
+    struct LinkReport
+    {
+        uint32_t magic = kLinkReportMagic; ///< kLinkReportMagic
+        uint32_t capabilities = 0;         ///< kLinkCap* bits supported by the reader
+        uint64_t topic_hash = 0;           ///< Topic of the most recent frame
+        uint64_t complete_groups = 0;      ///< Fragment groups reassembled so far
+        uint64_t lost_groups = 0;          ///< Fragment groups timed out or evicted
+        uint64_t echo_timestamp_ns = 0;    ///< FrameHeader::timestamp_ns of the last frame
+        uint64_t echo_delay_ns = 0;        ///< Time the reader held that timestamp before replying
+    };
+
+    static_assert(sizeof(LinkReport) == 48, "LinkReport must be 48 bytes");
+
+    /// Quick check for a valid link report datagram.
+    inline bool isLinkReport(const void *data, size_t len)
+    {
+        if (len != sizeof(LinkReport))
+            return false;
+        uint32_t magic;
+        std::memcpy(&magic, data, sizeof(magic));
+        return magic == kLinkReportMagic;
+    }
+
+} // namespace lux::communication::transport
@@ -13,13 +13,20 @@
 ///       publisher.publish(std::move(loan));
 ///   }
 ///
+/// The slot is reserved in the ring: publishes made while the loan is
+/// outstanding take the slots after it, and the reader sees them only once
+/// the loan is published or dropped, so ring order is publish order.
+///
 /// If the loan goes out of scope without being published, the slot is
-/// cancelled (marked Free, write_seq not advanced).
+/// cancelled (handed out again, or committed empty if later slots are
+/// already reserved).
 
 #include <lux/communication/transport/FrameHeader.hpp>
 #include <lux/communication/transport/ShmRingWriter.hpp>
 #include <lux/communication/serialization/Serializer.hpp>
 #include <cstring>
+#include <memory>
+#include <mutex>
 #include <type_traits>
 #include <utility>
 
@@ -46,13 +53,20 @@ namespace lux::communication::transport
         LoanedMessage() = default;
 
         /// Acquire a slot and placement-new the FrameHeader + default T.
-        LoanedMessage(ShmRingWriter *writer, const FrameHeader &header)
-            : writer_(writer)
+        /// @param writer_mutex  Taken around each use of @p writer (acquire,
+        ///                      commit, cancel; not held in between) and
+        ///                      keeps it alive for the loan — an aliasing
+        ///                      pointer into its owner.
+        LoanedMessage(ShmRingWriter *writer, const FrameHeader &header,
+                      std::shared_ptr<std::mutex> writer_mutex = {})
+            : writer_(writer), writer_mutex_(std::move(writer_mutex))
         {
+            auto lock = lockWriter();
             slot_base_ = writer_->acquireSlot();
             if (!slot_base_)
             {
                 writer_ = nullptr;
+                writer_mutex_.reset();
                 return;
             }
 
@@ -72,7 +86,7 @@ namespace lux::communication::transport
 
         // Move-only.
         LoanedMessage(LoanedMessage &&o) noexcept
-            : writer_(o.writer_), msg_(o.msg_),
+            : writer_(o.writer_), writer_mutex_(std::move(o.writer_mutex_)), msg_(o.msg_),
               slot_base_(o.slot_base_), committed_(o.committed_)
         {
             o.writer_ = nullptr;
@@ -88,6 +102,7 @@ namespace lux::communication::transport
                 if (msg_ && !committed_)
                     cancel();
                 writer_ = o.writer_;
+                writer_mutex_ = std::move(o.writer_mutex_);
                 msg_ = o.msg_;
                 slot_base_ = o.slot_base_;
                 committed_ = o.committed_;
@@ -123,10 +138,14 @@ namespace lux::communication::transport
             {
                 msg_->~T();
             }
-            writer_->cancelSlot();
+            {
+                auto lock = lockWriter();
+                writer_->cancelSlot(slot_base_);
+            }
             msg_ = nullptr;
             slot_base_ = nullptr;
             writer_ = nullptr;
+            writer_mutex_.reset();
         }
 
         /// Access the raw slot base (FrameHeader + T).
@@ -140,7 +159,8 @@ namespace lux::communication::transport
         {
             if (!msg_ || committed_)
                 return;
-            writer_->commitSlot(total_size);
+            auto lock = lockWriter();
+            writer_->commitSlot(slot_base_, total_size);
             committed_ = true;
         }
 
@@ -148,11 +168,13 @@ namespace lux::communication::transport
         template <typename U>
         friend class ::lux::communication::Publisher;
 
-        /// Mark as committed (prevent destructor cancel) without calling commitSlot.
-        /// Used by Publisher when it handles the commit itself.
-        void markCommitted() noexcept { committed_ = true; }
+        std::unique_lock<std::mutex> lockWriter()
+        {
+            return writer_mutex_ ? std::unique_lock(*writer_mutex_) : std::unique_lock<std::mutex>();
+        }
 
         ShmRingWriter *writer_ = nullptr;
+        std::shared_ptr<std::mutex> writer_mutex_; // null = caller serializes ring access
         T *msg_ = nullptr;
         void *slot_base_ = nullptr;
         bool committed_ = false;
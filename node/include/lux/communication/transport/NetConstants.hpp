@@ -33,4 +33,18 @@ namespace lux::communication::transport
     /// Fragment reassembly timeout (ms).
     static constexpr int kFragmentTimeoutMs = 200;
 
+    /// Interval between LinkReport feedback datagrams (reader → writer).
+    static constexpr int kLinkReportIntervalMs = 100;
+
+    // ── Unix domain socket transport (same host, SHM unavailable) ──
+
+    /// Payloads above this travel in a passed memfd instead of inline.
+    static constexpr uint32_t kUdsMemFdThreshold = 64 * 1024;
+
+    /// Largest inline payload a UdsTransportReader accepts (writer clamps to it).
+    static constexpr uint32_t kUdsMaxInlinePayload = 256 * 1024;
+
+    /// Default SO_SNDBUF / SO_RCVBUF for Unix domain sockets.
+    static constexpr int kUdsBufferSize = 4 * 1024 * 1024; // 4 MB
+
 } // namespace lux::communication::transport
@@ -0,0 +1,128 @@
+#pragma once
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include <lux/communication/visibility.h>
+
+namespace lux::communication::transport
+{
+    class ReassemblyBufferPool;
+
+    /// A pooled buffer lent out by ReassemblyBufferPool.  Move-only; returns
+    /// the buffer to its pool on destruction.
+    ///
+    /// Must not outlive the pool, and must be released on the pool's thread.
+    class LUX_COMMUNICATION_PUBLIC PooledBuffer
+    {
+    public:
+        PooledBuffer() = default;
+        ~PooledBuffer() { release(); }
+
+        PooledBuffer(PooledBuffer &&o) noexcept
+            : pool_(o.pool_), data_(o.data_), capacity_(o.capacity_), size_class_(o.size_class_)
+        {
+            o.pool_ = nullptr;
+            o.data_ = nullptr;
+            o.capacity_ = 0;
+        }
+
+        PooledBuffer &operator=(PooledBuffer &&o) noexcept
+        {
+            if (this != &o)
+            {
+                release();
+                pool_ = o.pool_;
+                data_ = o.data_;
+                capacity_ = o.capacity_;
+                size_class_ = o.size_class_;
+                o.pool_ = nullptr;
+                o.data_ = nullptr;
+                o.capacity_ = 0;
+            }
+            return *this;
+        }
+
+        PooledBuffer(const PooledBuffer &) = delete;
+        PooledBuffer &operator=(const PooledBuffer &) = delete;
+
+        uint8_t *data() const { return data_; }
+        size_t capacity() const { return capacity_; }
+        explicit operator bool() const { return data_ != nullptr; }
+
+        /// Return the buffer to the pool now.
+        void release();
+
+    private:
+        friend class ReassemblyBufferPool;
+        PooledBuffer(ReassemblyBufferPool *pool, uint8_t *data, size_t capacity, uint8_t size_class)
+            : pool_(pool), data_(data), capacity_(capacity), size_class_(size_class) {}
+
+        ReassemblyBufferPool *pool_ = nullptr;
+        uint8_t *data_ = nullptr;
+        size_t capacity_ = 0;
+        uint8_t size_class_ = 0;
+    };
+
+    /// Power-of-two size-classed buffer pool for UDP reassembly.
+    ///
+    /// Buffers are pre-touched (one write per page) when first allocated, so
+    /// reassembly never page-faults into fresh memory, and are kept on per-class
+    /// free lists up to @c max_retained_bytes.  Once warmed up, acquire/release
+    /// perform no heap allocation.
+    ///
+    /// Thread-safety: **not** thread-safe (owned by one FragmentAssembler).
+    class LUX_COMMUNICATION_PUBLIC ReassemblyBufferPool
+    {
+    public:
+        static constexpr size_t kMinClassShift = 11; ///< 2 KB — smallest fragmented message
+        static constexpr size_t kMaxClassShift = 26; ///< 64 MB — kMaxFragmentedMsgSize
+        static constexpr size_t kNumClasses = kMaxClassShift - kMinClassShift + 1;
+
+        explicit ReassemblyBufferPool(size_t max_retained_bytes = 64u * 1024u * 1024u);
+        ~ReassemblyBufferPool();
+
+        ReassemblyBufferPool(const ReassemblyBufferPool &) = delete;
+        ReassemblyBufferPool &operator=(const ReassemblyBufferPool &) = delete;
+
+        /// Lend a buffer of at least @p size bytes (contents unspecified).
+        /// Returns an empty PooledBuffer if @p size exceeds the largest class.
+        PooledBuffer acquire(size_t size);
+
+        /// Pre-allocate and pre-touch @p count buffers able to hold @p size bytes.
+        void prewarm(size_t size, size_t count);
+
+        struct Stats
+        {
+            uint64_t heap_allocations = 0; ///< Buffers obtained from the heap
+            uint64_t reuses = 0;           ///< acquire() served from a free list
+            uint64_t retained_bytes = 0;   ///< Bytes currently on free lists
+        };
+        Stats stats() const { return Stats{heap_allocations_, reuses_, retained_bytes_}; }
+
+    private:
+        friend class PooledBuffer;
+        void giveBack(uint8_t *data, uint8_t size_class);
+
+        static int classFor(size_t size);
+        static size_t classSize(int size_class) { return size_t{1} << (size_class + kMinClassShift); }
+        static uint8_t *allocateTouched(size_t bytes);
+
+        std::array<std::vector<uint8_t *>, kNumClasses> free_;
+        size_t max_retained_bytes_;
+        uint64_t retained_bytes_ = 0;
+        uint64_t heap_allocations_ = 0;
+        uint64_t reuses_ = 0;
+    };
+
+    inline void PooledBuffer::release()
+    {
+        if (pool_ && data_)
+            pool_->giveBack(data_, size_class_);
+        pool_ = nullptr;
+        data_ = nullptr;
+        capacity_ = 0;
+    }
+
+} // namespace lux::communication::transport
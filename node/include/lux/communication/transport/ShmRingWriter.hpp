@@ -30,19 +30,33 @@ namespace lux::communication::transport
         ShmRingWriter(ShmRingWriter &&other) noexcept;
         ShmRingWriter &operator=(ShmRingWriter &&other) noexcept;
 
-        /// Acquire the next writable slot's **payload** area.
+        /// Reserve the next writable slot and return its **payload** area.
+        ///
+        /// Several slots may be outstanding at once (a loan held across
+        /// other publishes); the reader sees them in acquisition order, each
+        /// once it and every slot before it is committed or cancelled.
         /// @return Pointer past the SlotHeader, or nullptr if ring is full.
         void *acquireSlot();
 
-        /// Commit the current slot: mark it READY, advance write_seq, wake reader.
+        /// Commit the most recently acquired slot.
         /// @param payload_size  Actual bytes written into the payload area.
         void commitSlot(uint32_t payload_size);
 
-        /// Cancel an acquired-but-not-committed slot.
-        /// Resets the slot state to Free without advancing write_seq.
-        /// Must be called exactly once per acquireSlot() that won't be committed.
+        /// Commit the slot whose payload area is @p payload: mark it READY,
+        /// advance write_seq over every leading committed slot, wake reader.
+        void commitSlot(const void *payload, uint32_t payload_size);
+
+        /// Cancel the most recently acquired slot.
         void cancelSlot();
 
+        /// Cancel an acquired-but-not-committed slot.
+        /// The newest reservation is handed out again by the next
+        /// acquireSlot(); an older one is committed empty (readers skip
+        /// payloads shorter than a FrameHeader) so the slots behind it can
+        /// be read.  Must be called exactly once per acquireSlot() that
+        /// won't be committed.
+        void cancelSlot(const void *payload);
+
         /// Convenience: copy @p data into the next slot and commit.
         /// @return true on success, false if ring is full.
         bool write(const void *data, uint32_t size);
@@ -57,11 +71,19 @@ namespace lux::communication::transport
         uint32_t maxPayloadSize() const;
 
     private:
+        /// Sequence number of the reserved slot holding @p payload.
+        uint64_t reservedSeq(const void *payload) const;
+
+        /// Publish the committed slots at the head of the reservations.
+        void advanceWriteSeq();
+
         platform::SharedMemorySegment *shm_ = nullptr;
         RingHeader *header_ = nullptr;
         uint32_t slot_count_ = 0;
         uint32_t slot_size_ = 0;
         uint64_t cached_read_seq_ = 0; // reduce cross-process cache bounce
+        uint64_t reserve_seq_ = 0;     // next slot to hand out (>= write_seq)
+        void *last_slot_ = nullptr;    // payload of the newest acquireSlot()
         std::string shm_name_;
 
         std::unique_ptr<ShmNotifier> notifier_;
@@ -50,6 +50,11 @@ namespace lux::communication::transport
         /// @return Number of subscribers that successfully received the data.
         uint32_t send(const FrameHeader &hdr, const void *payload, uint32_t payload_size);
 
+        /// Send complete frames (header + payload each, back to back) to all
+        /// connected subscribers with one write per connection.
+        /// @return Number of subscribers that successfully received the data.
+        uint32_t sendFrames(const void *frames, size_t size);
+
         /// Access the listen socket fd (for Reactor registration).
         platform::socket_t listenFd() const;
 
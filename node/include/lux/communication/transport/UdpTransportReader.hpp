@@ -2,11 +2,14 @@
 #include <cstdint>
 #include <chrono>
 #include <functional>
+#include <memory>
+#include <string>
 #include <vector>
 
 #include <lux/communication/platform/NetSocket.hpp>
 #include <lux/communication/transport/FrameHeader.hpp>
 #include <lux/communication/transport/FragmentAssembler.hpp>
+#include <lux/communication/transport/CompactFrameHeader.hpp>
 #include <lux/communication/visibility.h>
 
 namespace lux::communication::transport
@@ -41,6 +44,12 @@ namespace lux::communication::transport
         /// Run fragment GC (call periodically, e.g. every 100 ms).
         void gc();
 
+        /// Send a LinkReport (assembler completions / lost groups + RTT echo) back
+        /// to the source of the most recent datagram.  Rate-limited to one per
+        /// kLinkReportIntervalMs; call from the same periodic poller as gc().
+        /// Returns true if a report was sent.
+        bool sendLinkReport();
+
         /// Get native fd for Reactor registration.
         platform::socket_t nativeFd() const { return sock_.nativeFd(); }
 
@@ -51,12 +60,41 @@ namespace lux::communication::transport
         void close();
 
         /// Access the underlying assembler stats.
-        FragmentAssembler::Stats assemblerStats() const { return assembler_.stats(); }
+        FragmentAssembler::Stats assemblerStats() const { return assembler_->stats(); }
+
+        /// Compact-header frames decoded, and dropped for lack of a binding.
+        uint64_t compactFramesReceived() const { return compact_received_; }
+        uint64_t compactFramesUnbound() const { return compact_unbound_; }
 
     private:
         platform::UdpSocket sock_;
-        FragmentAssembler assembler_;
+        std::unique_ptr<FragmentAssembler> assembler_; // heap-held: pooled buffers point into it
         std::vector<uint8_t> recv_buf_; // scratch buffer for incoming datagrams
+
+        // ── Link feedback (adaptive path selection) ──
+        void noteFrame(const FrameHeader &hdr);
+
+        std::string report_addr_;        // source of the last datagram
+        uint16_t report_port_ = 0;
+        uint64_t last_topic_hash_ = 0;
+        uint64_t last_echo_ts_ = 0;      // timestamp_ns of the last complete frame
+        uint64_t last_echo_recv_ns_ = 0; // when that frame arrived
+        uint64_t last_report_ns_ = 0;
+
+        // ── Compact headers: baselines per (sender, topic_id) ──
+        struct SenderBinding
+        {
+            std::string addr;
+            uint16_t port = 0;
+            uint16_t topic_id = 0;
+            CompactBinding base;
+        };
+        void bindCompact(const FrameHeader &hdr);
+        const SenderBinding *findBinding(uint16_t topic_id) const;
+
+        std::vector<SenderBinding> bindings_;
+        uint64_t compact_received_ = 0;
+        uint64_t compact_unbound_ = 0;
     };
 
 } // namespace lux::communication::transport
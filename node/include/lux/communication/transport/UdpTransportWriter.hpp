@@ -1,12 +1,20 @@
 #pragma once
 #include <atomic>
+#include <condition_variable>
 #include <cstdint>
+#include <deque>
 #include <memory>
+#include <mutex>
 #include <string>
+#include <thread>
+#include <vector>
 
 #include <lux/communication/platform/NetSocket.hpp>
 #include <lux/communication/transport/FrameHeader.hpp>
+#include <lux/communication/transport/CompactFrameHeader.hpp>
 #include <lux/communication/transport/FragmentSender.hpp>
+#include <lux/communication/transport/FragmentPacer.hpp>
+#include <lux/communication/transport/LinkQualityEstimator.hpp>
 #include <lux/communication/visibility.h>
 
 namespace lux::communication::transport
@@ -16,38 +24,149 @@ namespace lux::communication::transport
     /// Small messages (FrameHeader + payload ≤ kMaxUdpPayload) are sent as a single
     /// datagram using scatter-gather.  Larger messages are fragmented via
     /// FragmentSender.
+    ///
+    /// The socket also receives LinkReport feedback from the remote reader;
+    /// pollLinkReports() folds it into a per-peer LinkQualityEstimator that the
+    /// Publisher consults in NetPathMode::Adaptive.
+    ///
+    /// With pacing enabled (setPacing), fragments leave at the configured
+    /// per-peer rate instead of back-to-back.  By default every frame is then
+    /// handed to a per-writer sender thread, in send() order, so send()
+    /// returns immediately and a small frame never overtakes a large one;
+    /// without the dedicated sender, single-datagram frames go out inline and
+    /// are charged to the same rate budget.
+    ///
+    /// Once the reader advertises kLinkCapCompactHeader in a LinkReport,
+    /// single-datagram frames are sent with a CompactFrameHeader against a
+    /// periodically refreshed binding frame; fragmented frames keep the full
+    /// FrameHeader.
     class LUX_COMMUNICATION_PUBLIC UdpTransportWriter
     {
     public:
         /// @param dest_addr  Remote subscriber IP address.
         /// @param dest_port  Remote subscriber UDP port.
-        UdpTransportWriter(const std::string &dest_addr, uint16_t dest_port);
+        /// @param link_cfg   Tuning for the adaptive path-selection estimator.
+        UdpTransportWriter(const std::string &dest_addr, uint16_t dest_port,
+                           const LinkQualityConfig &link_cfg = {});
         ~UdpTransportWriter();
 
-        UdpTransportWriter(UdpTransportWriter &&) noexcept;
-        UdpTransportWriter &operator=(UdpTransportWriter &&) noexcept;
+        /// Moving drains (and joins) the source's sender thread first.
+        UdpTransportWriter(UdpTransportWriter &&);
+        UdpTransportWriter &operator=(UdpTransportWriter &&);
 
         UdpTransportWriter(const UdpTransportWriter &) = delete;
         UdpTransportWriter &operator=(const UdpTransportWriter &) = delete;
 
         /// Send a complete message frame.
-        /// Returns true on success.
+        /// Returns true on success.  With the dedicated pacing sender, true
+        /// means the frame was queued; failures on the sender thread are
+        /// counted in queuedSendFailures().
         bool send(const FrameHeader &hdr, const void *payload, uint32_t payload_size);
 
         /// Direct raw send (for custom protocols).
         int sendRaw(const void *data, size_t len);
 
+        /// Configure fragment pacing for this peer (rate 0 = disabled).
+        /// Call before the first send(); an existing backlog is flushed first.
+        void setPacing(const PacingConfig &cfg);
+
+        /// The peer's pacer (nullptr when pacing was never configured).
+        const FragmentPacer *pacer() const { return pacer_.get(); }
+
+        /// Block until the dedicated sender has transmitted everything queued.
+        void flush();
+
+        /// Queued frames the dedicated sender failed to transmit.
+        uint64_t queuedSendFailures() const
+        {
+            return queued_failures_.load(std::memory_order_relaxed);
+        }
+
+        /// Non-blocking: drain pending LinkReports from the peer into the
+        /// link estimator.  Not thread-safe with respect to send().
+        /// @return Number of reports consumed.
+        size_t pollLinkReports();
+
+        /// Allow compact headers once the peer advertises support (default off).
+        void setCompactHeader(bool allowed) { compact_allowed_ = allowed; }
+
+        /// True when small frames currently go out with a compact header.
+        bool compactActive() const
+        {
+            return compact_allowed_ && peer_compact_.load(std::memory_order_relaxed);
+        }
+
+        /// Frames sent with a compact header so far.
+        uint64_t compactFramesSent() const { return compact_frames_; }
+
+        /// Loss / RTT estimate for this peer.
+        const LinkQualityEstimator &linkQuality() const { return link_; }
+
         const std::string &destAddr() const { return dest_addr_; }
         uint16_t destPort() const { return dest_port_; }
 
         void close();
 
     private:
+        struct PendingFrame
+        {
+            std::vector<uint8_t> data; // FrameHeader + payload, or the whole datagram
+            uint32_t group_id;
+            uint64_t topic_hash;
+            bool fragmented;
+        };
+
+        /// Whether send() goes through the dedicated sender thread.
+        bool queued() const
+        {
+            return pacer_ && pacer_->enabled() && pacer_->config().dedicated_sender;
+        }
+
+        /// Write the compact (or binding) header for a single-datagram frame
+        /// to @p out (≥ sizeof(FrameHeader) bytes); returns its length.
+        size_t encodeCompact(const FrameHeader &hdr, uint8_t *out);
+
+        /// Send one single-datagram frame with a compact (or binding) header.
+        bool sendCompact(const FrameHeader &hdr, const void *payload, uint32_t payload_size);
+
+        /// Queue a frame for the sender thread; false when the backlog is full.
+        bool enqueue(PendingFrame frame);
+
+        /// Take over @p o's state (its sender thread must be stopped).
+        void moveFrom(UdpTransportWriter &o);
+
+        void senderLoop();
+        /// Join the sender thread; @p drain = send the backlog first, else discard it.
+        void stopSender(bool drain);
+
         platform::UdpSocket sock_;
         std::string dest_addr_;
         uint16_t dest_port_;
         std::unique_ptr<FragmentSender> frag_sender_;
         std::atomic<uint32_t> next_group_id_{0};
+        LinkQualityEstimator link_;
+        uint64_t last_complete_groups_ = 0;
+        uint64_t last_lost_groups_ = 0;
+
+        // ── Compact headers (negotiated via LinkReport capabilities) ──
+        bool compact_allowed_ = false;
+        std::atomic<bool> peer_compact_{false};
+        bool bound_ = false;
+        CompactBinding binding_;
+        uint16_t topic_id_ = 0;
+        uint32_t frames_since_bind_ = 0;
+        uint64_t compact_frames_ = 0;
+
+        // ── Pacing (optional) ──
+        std::unique_ptr<FragmentPacer> pacer_;
+        std::thread sender_thread_;
+        std::mutex queue_mutex_;
+        std::condition_variable queue_cv_;
+        std::deque<PendingFrame> queue_;
+        size_t queued_bytes_ = 0;
+        bool sending_ = false; // sender thread is transmitting a dequeued frame
+        bool stop_sender_ = false;
+        std::atomic<uint64_t> queued_failures_{0};
     };
 
 } // namespace lux::communication::transport
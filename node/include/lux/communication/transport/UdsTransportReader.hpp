@@ -0,0 +1,67 @@
+#pragma once
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+#include <lux/communication/platform/UnixSocket.hpp>
+#include <lux/communication/transport/FrameHeader.hpp>
+#include <lux/communication/transport/Handshake.hpp>
+#include <lux/communication/visibility.h>
+
+namespace lux::communication::transport
+{
+    /// Unix domain socket transport reader: connects to a UdsTransportWriter,
+    /// performs the handshake, and receives one frame per message.  Frames
+    /// flagged kFlagMemFd are mapped read-only from the passed descriptor for
+    /// the duration of the callback.
+    class LUX_COMMUNICATION_PUBLIC UdsTransportReader
+    {
+    public:
+        /// @param path        Publisher's socket path.
+        /// @param topic_hash  Topic hash for the handshake.
+        /// @param type_hash   Type hash for the handshake.
+        /// @param local_pid   This subscriber's PID.
+        /// @param hostname    This machine's hostname.
+        UdsTransportReader(const std::string &path, uint64_t topic_hash, uint64_t type_hash,
+                           uint32_t local_pid, const std::string &hostname);
+        ~UdsTransportReader();
+
+        UdsTransportReader(const UdsTransportReader &) = delete;
+        UdsTransportReader &operator=(const UdsTransportReader &) = delete;
+
+        /// Connect and perform the handshake.
+        /// Returns true if the publisher accepted this subscriber.
+        bool connect();
+
+        /// Callback type for delivering a complete frame.
+        using FrameCallback = std::function<void(const FrameHeader &hdr,
+                                                 const void *payload,
+                                                 uint32_t payload_size)>;
+
+        /// Called by the Reactor when the socket is readable: drains all
+        /// pending messages, invoking @p cb once per frame.
+        void onDataReady(FrameCallback cb);
+
+        /// Non-blocking manual poll.
+        /// Returns true if at least one frame was delivered to @p cb.
+        bool pollOnce(FrameCallback cb);
+
+        platform::socket_t nativeFd() const { return sock_.nativeFd(); }
+        const std::string &path() const { return path_; }
+        bool isConnected() const { return connected_; }
+
+        void close();
+
+    private:
+        platform::UnixSocket sock_;
+        std::string path_;
+        uint64_t topic_hash_;
+        uint64_t type_hash_;
+        uint32_t local_pid_;
+        std::string hostname_;
+        bool connected_ = false;
+        std::vector<uint8_t> recv_buf_; // FrameHeader + largest inline payload
+    };
+
+} // namespace lux::communication::transport
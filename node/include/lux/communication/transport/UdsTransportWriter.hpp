@@ -0,0 +1,88 @@
+#pragma once
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include <lux/communication/platform/UnixSocket.hpp>
+#include <lux/communication/transport/FrameHeader.hpp>
+#include <lux/communication/transport/Handshake.hpp>
+#include <lux/communication/transport/NetConstants.hpp>
+#include <lux/communication/visibility.h>
+
+namespace lux::communication::transport
+{
+    /// Unix domain socket transport writer for same-host subscribers that
+    /// cannot use SHM (SHM disabled, or containers without a shared /dev/shm).
+    ///
+    /// Listens on a SOCK_SEQPACKET socket, performs the same handshake as
+    /// TcpTransportWriter, and sends every frame as one message — no
+    /// fragmentation, no IP stack.  Payloads above the memfd threshold are
+    /// written once into a memfd whose descriptor is passed to each
+    /// subscriber (kFlagMemFd), so large messages are never copied through
+    /// the socket.
+    class LUX_COMMUNICATION_PUBLIC UdsTransportWriter
+    {
+    public:
+        using SeqSupplier = std::function<uint64_t()>;
+
+        /// @param path             Filesystem path to listen on.
+        /// @param topic_hash       For handshake validation.
+        /// @param type_hash        For type-safety check.
+        /// @param memfd_threshold  Payloads above this go through a memfd
+        ///                         (clamped to kUdsMaxInlinePayload).
+        UdsTransportWriter(const std::string &path, uint64_t topic_hash, uint64_t type_hash,
+                           uint32_t memfd_threshold = kUdsMemFdThreshold);
+        ~UdsTransportWriter();
+
+        UdsTransportWriter(const UdsTransportWriter &) = delete;
+        UdsTransportWriter &operator=(const UdsTransportWriter &) = delete;
+
+        /// Set the sequence supplier for handshake responses.
+        void setSeqSupplier(SeqSupplier fn) { seq_supplier_ = std::move(fn); }
+
+        /// Bind the socket path and start listening.
+        bool startListening();
+
+        /// Called when the listen socket has a pending connection (e.g. from
+        /// the Reactor).  Performs accept + handshake.
+        void onAcceptReady();
+
+        /// Send a frame to all connected subscribers.  A subscriber whose
+        /// socket buffer is full misses this frame; a broken one is dropped.
+        /// @return Number of subscribers that received the frame.
+        uint32_t send(const FrameHeader &hdr, const void *payload, uint32_t payload_size);
+
+        platform::socket_t listenFd() const { return listener_.nativeFd(); }
+        const std::string &path() const { return path_; }
+        uint32_t memfdThreshold() const { return memfd_threshold_; }
+
+        size_t connectionCount() const;
+
+        /// Frames a subscriber missed because its socket buffer was full.
+        uint64_t droppedFrames() const;
+
+        void close();
+
+    private:
+        struct Connection
+        {
+            platform::UnixSocket sock;
+            uint32_t subscriber_pid = 0;
+        };
+
+        platform::UnixListener listener_;
+        std::string path_;
+        uint64_t topic_hash_;
+        uint64_t type_hash_;
+        uint32_t memfd_threshold_;
+        SeqSupplier seq_supplier_;
+
+        mutable std::mutex conn_mutex_;
+        std::vector<std::unique_ptr<Connection>> connections_;
+        uint64_t dropped_ = 0;
+    };
+
+} // namespace lux::communication::transport
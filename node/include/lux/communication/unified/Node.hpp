@@ -2,6 +2,7 @@
 /// Node implementation — supports intra-process, shared memory, and network
 /// transport configured via NodeOptions.
 
+#include <chrono>
 #include <memory>
 #include <vector>
 #include <mutex>
@@ -19,6 +20,7 @@
 namespace lux::communication
 {
     class CallbackGroupBase;
+    class Timer;
 
     // Forward declarations of unified Pub/Sub (header-only templates).
     template<typename T> class Publisher;
@@ -49,6 +51,9 @@ namespace lux::communication
             const PublishOptions& opts = {});
 
         /// Create a typed subscriber.
+        /// `callback` is either `void(callback_arg_t<T>)` or a batch callback
+        /// `void(std::span<const stored_msg_t<T>>)` (see SubscribeOptions
+        /// max_batch_size / max_batch_wait).
         template<typename T, typename Func>
         std::shared_ptr<Subscriber<T>> createSubscriber(
             const std::string& topic_name,
@@ -57,6 +62,15 @@ namespace lux::communication
             const SubscribeOptions& opts = {},
             typename Subscriber<T>::ContentFilter filter = nullptr);
 
+        /// Create a periodic timer.  It fires through the executor of
+        /// `cbg` (default group if null) like a subscriber, so the callback
+        /// obeys the group's exclusivity; it starts once the node is added
+        /// to an executor.
+        std::shared_ptr<Timer> createTimer(
+            std::chrono::nanoseconds period,
+            std::function<void()> callback,
+            CallbackGroupBase* cbg = nullptr);
+
         /// Access the shared IoReactor.
         transport::IoReactor& reactor()  { return *reactor_; }
 
@@ -66,7 +80,7 @@ namespace lux::communication
         /// Node-level options.
         const NodeOptions& options() const { return opts_; }
 
-        /// Stop all subscribers and the IO thread.
+        /// Stop all subscribers and timers, and the IO thread.
         void stop();
 
     private:
@@ -79,7 +93,7 @@ namespace lux::communication
         std::mutex                                    endpoints_mutex_;
         std::vector<std::shared_ptr<void>>            owned_endpoints_;
 
-        // Subscriber stop functions (for orderly shutdown).
+        // Subscriber and timer stop functions (for orderly shutdown).
         std::mutex                                    stoppers_mutex_;
         std::vector<std::function<void()>>            subscriber_stoppers_;
     };
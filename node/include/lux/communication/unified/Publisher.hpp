@@ -7,9 +7,13 @@
 /// For each remote (cross-process / cross-machine) Subscriber discovered via
 /// DiscoveryService, a dedicated SHM ring or network channel is created.
 
+#include <algorithm>
+#include <iterator>
 #include <memory>
 #include <mutex>
+#include <span>
 #include <string>
+#include <unordered_map>
 #include <vector>
 #include <cstring>
 
@@ -18,6 +22,8 @@
 #include <lux/communication/ExecutorBase.hpp>
 #include <lux/communication/MessageTraits.hpp>
 #include <lux/communication/ChannelKind.hpp>
+#include <lux/communication/FieldFilter.hpp>
+#include <lux/communication/HybridClock.hpp>
 #include <lux/communication/TransportSelector.hpp>
 #include <lux/communication/Hash.hpp>
 #include <lux/communication/intraprocess/Topic.hpp>
@@ -29,6 +35,7 @@
 #include <lux/communication/transport/LoanedMessage.hpp>
 #include <lux/communication/transport/UdpTransportWriter.hpp>
 #include <lux/communication/transport/TcpTransportWriter.hpp>
+#include <lux/communication/transport/UdsTransportWriter.hpp>
 #include <lux/communication/discovery/DiscoveryService.hpp>
 #include <lux/communication/platform/PlatformDefs.hpp>
 #include <lux/communication/TokenBucket.hpp>
@@ -65,6 +72,26 @@ namespace lux::communication
                           pub_pid);
             return buf;
         }
+
+        /// Unix domain socket path for one publisher (unique per process).
+        inline std::string makeUdsPath(const std::string &dir, uint64_t domain_id,
+                                       uint64_t topic_hash, uint32_t pub_pid)
+        {
+            static std::atomic<uint32_t> counter{0};
+            char buf[128];
+            std::snprintf(buf, sizeof(buf), "/lux_uds_%llu_%08llx_%u_%u.sock",
+                          static_cast<unsigned long long>(domain_id),
+                          static_cast<unsigned long long>(topic_hash),
+                          pub_pid, counter.fetch_add(1, std::memory_order_relaxed));
+            return dir + buf;
+        }
+
+        /// Id of a new publisher, unique within the process (0 is unused).
+        inline uint32_t nextPublisherId()
+        {
+            static std::atomic<uint32_t> counter{1};
+            return counter.fetch_add(1, std::memory_order_relaxed);
+        }
     } // namespace detail
 
     /// Unified Publisher.
@@ -97,7 +124,25 @@ namespace lux::communication
         template <typename... Args>
         void emplace(Args &&...args);
 
+        /// Publish a burst in one pass, e.g. everything a sensor driver read
+        /// from its FIFO: one sequence range and one clock reading for the
+        /// whole batch (consecutive stamps), one subscriber and one peer
+        /// snapshot, one bandwidth check.
+        /// Each SHM peer gets the batch in consecutive ring slots, each TCP
+        /// connection in one write.  With a BestEffort bandwidth limit the
+        /// batch is dropped as a whole when the budget does not cover it.
+        void publishBatch(std::span<const T> msgs);
+
+        /// Iterator form; a range that is not contiguous storage of T is
+        /// copied into a buffer first.
+        template <std::input_iterator It, std::sentinel_for<It> S>
+        void publishBatch(It first, S last);
+
         /// Zero-copy loan (TriviallyCopyableMsg only, SHM path).
+        ///
+        /// Reserves a slot on the first SHM peer's ring.  Other publishes may
+        /// run while the loan is outstanding; they fill the slots behind it
+        /// and reach that subscriber after the loan is published or dropped.
         auto loan() -> transport::LoanedMessage<T>
             requires serialization::TriviallyCopyableMsg<T>;
 
@@ -107,31 +152,144 @@ namespace lux::communication
 
         const std::string &topicName() const { return topic_name_; }
 
+        /// Carried in every frame; unique within this process only.
+        uint32_t publisherId() const { return publisher_id_; }
+
+        /// Override UDP fragment pacing for one net peer ("addr:port", as
+        /// announced by the subscriber).  Applies now if the peer is known,
+        /// otherwise when it is discovered.
+        void setPeerPacing(const std::string &endpoint, const transport::PacingConfig &cfg);
+
     private:
+        // ── Content filter pushdown ──
+        /// FieldFilters announced by the subscribers behind one peer; the
+        /// peer gets a message if any of them accepts it.
+        struct PeerFilters
+        {
+            struct Entry
+            {
+                FieldFilter filter;
+                uint64_t last_pass_ns = 0; // sampling state
+            };
+            std::vector<Entry> entries;
+            bool unfiltered = false; // some subscriber wants everything
+
+            /// Merge one subscriber's encoded filter ("" or unreadable = none).
+            void add(const std::string &encoded);
+            /// Evaluate for one message stamped `ts_ns`.
+            bool wants(const T &msg, uint64_t ts_ns);
+        };
+
+        /// State common to SHM and net peers.  The peer lists are immutable
+        /// snapshots swapped on discovery, so publishing takes no
+        /// publisher-wide lock; `mutex` serializes the use of one peer's
+        /// writers (SPSC ring, sockets) and its filters instead.
+        struct PeerBase
+        {
+            std::mutex mutex;
+            /// Discovery endpoint id and encoded filter of each subscriber
+            /// behind this peer; `filters` is rebuilt from them on a change.
+            std::vector<std::pair<uint32_t, std::string>> subscribers; // guarded by mutex
+            PeerFilters filters;                // guarded by mutex
+            std::atomic<bool> filtered{false};  // filters has entries to evaluate
+
+            /// Add a subscriber, or update one already known.
+            void addSubscriber(uint32_t endpoint_id, const std::string &encoded)
+            {
+                std::lock_guard lock(mutex);
+                auto it = std::find_if(subscribers.begin(), subscribers.end(),
+                                       [&](const auto &s)
+                                       { return s.first == endpoint_id; });
+                if (it == subscribers.end())
+                    subscribers.emplace_back(endpoint_id, encoded);
+                else if (it->second != encoded)
+                    it->second = encoded;
+                else
+                    return; // repeated announce — keep the sampling state
+                rebuildFilters();
+            }
+
+            /// Drop a subscriber; returns false once none is left.
+            bool removeSubscriber(uint32_t endpoint_id)
+            {
+                std::lock_guard lock(mutex);
+                std::erase_if(subscribers, [&](const auto &s)
+                              { return s.first == endpoint_id; });
+                rebuildFilters();
+                return !subscribers.empty();
+            }
+
+            void rebuildFilters() // mutex held
+            {
+                filters = PeerFilters{};
+                for (const auto &s : subscribers)
+                    filters.add(s.second);
+                filtered.store(!filters.unfiltered && !filters.entries.empty(),
+                               std::memory_order_release);
+            }
+
+            bool wants(const T &msg, uint64_t ts_ns)
+            {
+                if (!filtered.load(std::memory_order_acquire))
+                    return true;
+                std::lock_guard lock(mutex);
+                return filters.wants(msg, ts_ns);
+            }
+        };
+
         // ── SHM peer management ──
-        struct ShmPeer
+        struct ShmPeer : PeerBase
         {
-            uint32_t sub_pid;
+            uint32_t sub_pid = 0;
             std::unique_ptr<transport::ShmRingWriter> writer;
         };
+        using ShmPeerList = std::vector<std::shared_ptr<ShmPeer>>;
 
         // ── Net peer management ──
-        struct NetPeer
+        struct NetPeer : PeerBase
         {
             std::string endpoint;
             std::unique_ptr<transport::UdpTransportWriter> udp;
             std::unique_ptr<transport::TcpTransportWriter> tcp;
         };
+        using NetPeerList = std::vector<std::shared_ptr<NetPeer>>;
 
         void onPeerDiscovered(const discovery::TopicEndpoint &ep);
         void onPeerLost(const discovery::TopicEndpoint &ep);
 
+        std::shared_ptr<const ShmPeerList> shmPeers() const
+        {
+            return std::atomic_load_explicit(&shm_peers_, std::memory_order_acquire);
+        }
+        std::shared_ptr<const NetPeerList> netPeers() const
+        {
+            return std::atomic_load_explicit(&net_peers_, std::memory_order_acquire);
+        }
+
         void publishIntra(stored_msg_t<T> msg);
-        void publishShm(const T &msg, transport::FrameHeader &hdr, uint32_t ser_size);
+        void publishIntraBatch(std::span<const T> msgs);
+        transport::FrameHeader makeHeader(uint64_t seq, uint64_t ts_ns, uint32_t ser_size) const;
+        /// The SHM peers whose filters accept `msg` (thread-local list,
+        /// valid until the next call on this thread).
+        const std::vector<ShmPeer *> &selectShmPeers(const ShmPeerList &peers,
+                                                     const T &msg, uint64_t ts_ns);
+        void publishShm(const T &msg, transport::FrameHeader &hdr, uint32_t ser_size,
+                        const std::vector<ShmPeer *> &peers);
+        /// A ring slot of `peer` (caller holds its mutex); Reliable waits up
+        /// to shm_reliable_timeout.  nullptr if the ring stays full.
+        void *acquireShmSlot(ShmPeer &peer);
+        void publishShmBatch(std::span<const T> msgs, std::span<const uint32_t> sizes,
+                             uint64_t first_seq, uint64_t ts_ns);
         void publishShmViaPool(const T &msg, transport::FrameHeader &hdr,
-                               uint32_t ser_size, uint32_t sub_count);
-        void publishNet(const T &msg, transport::FrameHeader &hdr, uint32_t ser_size);
+                               uint32_t ser_size, const std::vector<ShmPeer *> &peers);
+        void publishNet(const T &msg, transport::FrameHeader &hdr, uint32_t ser_size,
+                        const NetPeerList &peers);
+        void publishNetBatch(std::span<const T> msgs, std::span<const uint32_t> sizes,
+                             uint64_t first_seq, uint64_t ts_ns, const NetPeerList &peers);
+        void publishUds(const T &msg, transport::FrameHeader &hdr, uint32_t ser_size);
+        bool setupUds();
         void ensureDataPool();
+        void ensureLinkFeedbackPoller();
 
         std::string topic_name_;
         Node *node_;
@@ -140,21 +298,46 @@ namespace lux::communication
         uint64_t discovery_handle_ = 0;
         uint64_t listener_id_ = 0;
 
+        /// Sequence space and clock of this publisher alone: frames of
+        /// different topics (and publishers) never touch the same counter.
+        /// A gap in one publisher's seq_num means a lost frame.
+        const uint32_t publisher_id_ = detail::nextPublisherId();
+        alignas(64) std::atomic<uint64_t> next_seq_{1};
+        HybridClock clock_;
+
+        /// First of `n` consecutive sequence numbers.
+        uint64_t allocateSeqRange(size_t n)
+        {
+            return next_seq_.fetch_add(static_cast<uint64_t>(n), std::memory_order_relaxed);
+        }
+
+        /// Copy-on-write peer snapshots (like TopicBase::sub_snapshot_):
+        /// read lock-free with shmPeers() / netPeers(), replaced whole under
+        /// shm_mutex_ / net_mutex_, which only discovery takes.
         std::mutex shm_mutex_;
-        std::vector<ShmPeer> shm_peers_;
+        std::shared_ptr<const ShmPeerList> shm_peers_ = std::make_shared<const ShmPeerList>();
 
         std::mutex net_mutex_;
-        std::vector<NetPeer> net_peers_;
+        std::shared_ptr<const NetPeerList> net_peers_ = std::make_shared<const NetPeerList>();
+        std::unordered_map<std::string, transport::PacingConfig> peer_pacing_; // guarded by net_mutex_
 
         /// Fast-path: true when neither SHM nor Net transport is possible.
         /// Avoids per-message mutex locks for the common intra-only case.
         bool intra_only_ = false;
 
         /// Atomic peer-count flags (updated in onPeerDiscovered/onPeerLost)
-        /// so publish() can skip mutex when no cross-process peers exist.
+        /// so publish() can skip the snapshot loads when no cross-process
+        /// peers exist.
         std::atomic<bool> has_shm_peers_{false};
         std::atomic<bool> has_net_peers_{false};
+        std::atomic<bool> has_uds_peers_{false};
+
+        /// Same-host subscribers without SHM connect here (accepted on the
+        /// IoReactor); announced as "uds:<path>".
+        std::unique_ptr<transport::UdsTransportWriter> uds_writer_;
+        std::string uds_endpoint_;
 
+        std::mutex pool_mutex_; // data_pool_ creation and allocation (single writer)
         std::unique_ptr<transport::ShmDataPool> data_pool_;
 
         /// Phase 6 — bandwidth limiter (nullptr when bandwidth_limit == 0).
@@ -164,6 +347,11 @@ namespace lux::communication
         uint64_t tcp_heartbeat_poller_ = 0;
         /// Last time a TCP Ping was sent (used for interval gating).
         std::chrono::steady_clock::time_point last_tcp_ping_{};
+
+        /// IoThread poller draining UDP LinkReports for adaptive path
+        /// selection and pacing congestion control (0 = off).
+        uint64_t link_report_poller_ = 0;
+        std::once_flag link_report_once_;
     };
 
 } // namespace lux::communication
@@ -195,8 +383,9 @@ namespace lux::communication
     {
         const auto &nopts = node_->options();
 
-        // Fast-path flag: skip SHM/Net per-message overhead when neither is possible.
-        intra_only_ = (!nopts.enable_shm && !nopts.enable_net) || opts_.transport_hint == PublishTransportHint::IntraOnly;
+        // Fast-path flag: skip SHM/UDS/Net per-message overhead when none is possible.
+        intra_only_ = (!nopts.enable_shm && !nopts.enable_net && !nopts.enable_uds) ||
+                      opts_.transport_hint == PublishTransportHint::IntraOnly;
 
         // Phase 6: Initialize bandwidth limiter if configured.
         if (opts_.qos.bandwidth_limit > 0)
@@ -210,8 +399,11 @@ namespace lux::communication
         {
             auto &ds = discovery::DiscoveryService::getInstance(node_->domain().id());
 
+            if (setupUds())
+                uds_endpoint_ = makeUdsEndpoint(uds_writer_->path());
+
             discovery_handle_ = ds.announcePublisher(
-                topic_name_, typeid(T).name(), typeid(T).hash_code());
+                topic_name_, typeid(T).name(), typeid(T).hash_code(), "", uds_endpoint_);
 
             listener_id_ = ds.addListener(topic_name_,
                                           [this](const discovery::DiscoveryEvent &ev)
@@ -246,17 +438,102 @@ namespace lux::communication
                         return;
                     last_tcp_ping_ = now;
 
-                    std::lock_guard lock(net_mutex_);
-                    for (auto &peer : net_peers_)
+                    for (const auto &peer : *netPeers())
                     {
-                        if (!peer.tcp)
+                        if (!peer->tcp)
                             continue;
-                        peer.tcp->recvPongAll();
-                        peer.tcp->sendPingAll();
-                        peer.tcp->gcDeadConnections(ping_timeout);
+                        std::lock_guard lock(peer->mutex);
+                        peer->tcp->recvPongAll();
+                        peer->tcp->sendPingAll();
+                        peer->tcp->gcDeadConnections(ping_timeout);
                     }
                 });
         }
+
+        // ── Link feedback: adaptive UDP/TCP selection, pacing congestion
+        //    control, compact-header negotiation ──
+        if (nopts.enable_net &&
+            (opts_.net_path_mode == NetPathMode::Adaptive ||
+             opts_.net_pacing.congestion != transport::CongestionControl::None ||
+             opts_.net_compact_header))
+        {
+            ensureLinkFeedbackPoller();
+        }
+    }
+
+    template <typename T>
+    void Publisher<T>::ensureLinkFeedbackPoller()
+    {
+        // Must not be called with a peer mutex held: the poller takes them on
+        // the IoThread while IoThread holds its own poller lock.
+        std::call_once(link_report_once_, [this]
+                       {
+                           link_report_poller_ = node_->ioThread().registerPoller(
+                               [this]()
+                               {
+                                   for (const auto &peer : *netPeers())
+                                   {
+                                       if (!peer->udp)
+                                           continue;
+                                       std::lock_guard lock(peer->mutex);
+                                       peer->udp->pollLinkReports();
+                                   }
+                               });
+                       });
+    }
+
+    template <typename T>
+    bool Publisher<T>::setupUds()
+    {
+        const auto &nopts = node_->options();
+        if (!nopts.enable_uds || !platform::unixSocketsSupported() ||
+            opts_.transport_hint != PublishTransportHint::Auto)
+            return false;
+        if constexpr (!serialization::HasSerializer<T>)
+            return false;
+
+        auto writer = std::make_unique<transport::UdsTransportWriter>(
+            detail::makeUdsPath(nopts.uds_socket_dir, node_->domain().id(),
+                                topic_hash_, platform::currentPid()),
+            topic_hash_, typeid(T).hash_code(), opts_.uds_memfd_threshold);
+        if (!writer->startListening())
+            return false; // e.g. directory not writable — stay on SHM / Net
+        writer->setSeqSupplier([this]()
+                               { return next_seq_.load(std::memory_order_relaxed); });
+
+        auto *raw = writer.get();
+        uds_writer_ = std::move(writer);
+        node_->reactor().addFd(
+            raw->listenFd(), transport::IoReactor::Readable,
+            [this, raw](platform::socket_t, uint8_t events)
+            {
+                if (events & transport::IoReactor::Error)
+                    return;
+                raw->onAcceptReady();
+                has_uds_peers_.store(raw->connectionCount() > 0, std::memory_order_release);
+            });
+        node_->ioThread().start(); // the reactor is only driven once IoThread runs
+        return true;
+    }
+
+    template <typename T>
+    void Publisher<T>::setPeerPacing(const std::string &endpoint,
+                                     const transport::PacingConfig &cfg)
+    {
+        if (cfg.congestion != transport::CongestionControl::None &&
+            node_->options().enable_net)
+            ensureLinkFeedbackPoller();
+
+        std::lock_guard lock(net_mutex_);
+        peer_pacing_[endpoint] = cfg;
+        for (const auto &peer : *netPeers())
+        {
+            if (peer->endpoint == endpoint && peer->udp)
+            {
+                std::lock_guard peer_lock(peer->mutex);
+                peer->udp->setPacing(cfg);
+            }
+        }
     }
 
     template <typename T>
@@ -268,6 +545,11 @@ namespace lux::communication
             node_->ioThread().unregisterPoller(tcp_heartbeat_poller_);
             tcp_heartbeat_poller_ = 0;
         }
+        if (link_report_poller_)
+        {
+            node_->ioThread().unregisterPoller(link_report_poller_);
+            link_report_poller_ = 0;
+        }
 
         const auto &nopts = node_->options();
         if (nopts.enable_discovery && listener_id_)
@@ -279,10 +561,18 @@ namespace lux::communication
         }
 
         std::lock_guard lk1(shm_mutex_);
-        shm_peers_.clear();
+        std::atomic_store_explicit(&shm_peers_, std::make_shared<const ShmPeerList>(),
+                                   std::memory_order_release);
 
         std::lock_guard lk2(net_mutex_);
-        net_peers_.clear();
+        std::atomic_store_explicit(&net_peers_, std::make_shared<const NetPeerList>(),
+                                   std::memory_order_release);
+
+        if (uds_writer_)
+        {
+            node_->reactor().removeFd(uds_writer_->listenFd());
+            uds_writer_->close();
+        }
     }
 
     // ── Peer discovery callbacks ─────────────────────────────────────
@@ -301,9 +591,15 @@ namespace lux::communication
         case ChannelKind::Shm:
         {
             std::lock_guard lock(shm_mutex_);
-            for (const auto &p : shm_peers_)
-                if (p.sub_pid == ep.pid)
-                    return; // duplicate
+            const auto current = shmPeers();
+            for (const auto &p : *current)
+            {
+                if (p->sub_pid == ep.pid)
+                {
+                    p->addSubscriber(ep.endpoint_id, ep.content_filter); // another subscriber there
+                    return;
+                }
+            }
 
             std::string ring_name = detail::makeRingName(
                 node_->domain().id(), topic_hash_,
@@ -313,7 +609,15 @@ namespace lux::communication
             {
                 auto writer = std::make_unique<transport::ShmRingWriter>(
                     ring_name, opts_.shm_ring_slot_count, opts_.shm_ring_slot_size);
-                shm_peers_.push_back(ShmPeer{ep.pid, std::move(writer)});
+                auto peer = std::make_shared<ShmPeer>();
+                peer->sub_pid = ep.pid;
+                peer->writer = std::move(writer);
+                peer->addSubscriber(ep.endpoint_id, ep.content_filter);
+
+                auto next = std::make_shared<ShmPeerList>(*current);
+                next->push_back(std::move(peer));
+                std::atomic_store_explicit(&shm_peers_, std::shared_ptr<const ShmPeerList>(std::move(next)),
+                                           std::memory_order_release);
                 has_shm_peers_.store(true, std::memory_order_release);
 
                 // Re-announce with the SHM name so the subscriber can connect.
@@ -321,7 +625,7 @@ namespace lux::communication
                 ds.withdraw(discovery_handle_);
                 discovery_handle_ = ds.announcePublisher(
                     topic_name_, typeid(T).name(), typeid(T).hash_code(),
-                    ring_name);
+                    ring_name, uds_endpoint_);
             }
             catch (const std::exception &)
             {
@@ -333,9 +637,15 @@ namespace lux::communication
         case ChannelKind::Net:
         {
             std::lock_guard lock(net_mutex_);
-            for (const auto &p : net_peers_)
-                if (p.endpoint == ep.net_endpoint)
-                    return; // duplicate
+            const auto current = netPeers();
+            for (const auto &p : *current)
+            {
+                if (p->endpoint == ep.net_endpoint)
+                {
+                    p->addSubscriber(ep.endpoint_id, ep.content_filter); // another subscriber there
+                    return;
+                }
+            }
 
             try
             {
@@ -347,12 +657,28 @@ namespace lux::communication
                 uint16_t port = static_cast<uint16_t>(
                     std::stoi(ep.net_endpoint.substr(colon + 1)));
 
-                auto udp = std::make_unique<transport::UdpTransportWriter>(addr, port);
+                transport::LinkQualityConfig link_cfg;
+                link_cfg.max_udp_threshold = opts_.net_adaptive_max_threshold;
+                auto udp = std::make_unique<transport::UdpTransportWriter>(addr, port, link_cfg);
+                auto pacing = peer_pacing_.find(ep.net_endpoint);
+                const auto &pacing_cfg = pacing != peer_pacing_.end() ? pacing->second : opts_.net_pacing;
+                if (pacing_cfg.rate_bytes_per_sec != 0)
+                    udp->setPacing(pacing_cfg);
+                udp->setCompactHeader(opts_.net_compact_header);
                 auto tcp = std::make_unique<transport::TcpTransportWriter>(
                     "0.0.0.0", 0, topic_hash_, typeid(T).hash_code());
                 tcp->setSeqSupplier([this]()
-                                    { return node_->domain().currentSeq(); });
-                net_peers_.push_back(NetPeer{ep.net_endpoint, std::move(udp), std::move(tcp)});
+                                    { return next_seq_.load(std::memory_order_relaxed); });
+                auto peer = std::make_shared<NetPeer>();
+                peer->endpoint = ep.net_endpoint;
+                peer->udp = std::move(udp);
+                peer->tcp = std::move(tcp);
+                peer->addSubscriber(ep.endpoint_id, ep.content_filter);
+
+                auto next = std::make_shared<NetPeerList>(*current);
+                next->push_back(std::move(peer));
+                std::atomic_store_explicit(&net_peers_, std::shared_ptr<const NetPeerList>(std::move(next)),
+                                           std::memory_order_release);
                 has_net_peers_.store(true, std::memory_order_release);
             }
             catch (const std::exception &)
@@ -361,6 +687,10 @@ namespace lux::communication
             }
             break;
         }
+
+        case ChannelKind::Uds:
+            // UDS subscribers connect to our listening socket themselves.
+            break;
         }
     }
 
@@ -376,19 +706,29 @@ namespace lux::communication
         case ChannelKind::Shm:
         {
             std::lock_guard lock(shm_mutex_);
-            std::erase_if(shm_peers_, [&](const ShmPeer &p)
-                          { return p.sub_pid == ep.pid; });
-            has_shm_peers_.store(!shm_peers_.empty(), std::memory_order_release);
+            auto next = std::make_shared<ShmPeerList>(*shmPeers());
+            // The peer stays while other subscribers of that process remain.
+            std::erase_if(*next, [&](const auto &p)
+                          { return p->sub_pid == ep.pid && !p->removeSubscriber(ep.endpoint_id); });
+            has_shm_peers_.store(!next->empty(), std::memory_order_release);
+            // Publishes in flight keep the old snapshot, and the peer, alive.
+            std::atomic_store_explicit(&shm_peers_, std::shared_ptr<const ShmPeerList>(std::move(next)),
+                                       std::memory_order_release);
             break;
         }
         case ChannelKind::Net:
         {
             std::lock_guard lock(net_mutex_);
-            std::erase_if(net_peers_, [&](const NetPeer &p)
-                          { return p.endpoint == ep.net_endpoint; });
-            has_net_peers_.store(!net_peers_.empty(), std::memory_order_release);
+            auto next = std::make_shared<NetPeerList>(*netPeers());
+            std::erase_if(*next, [&](const auto &p)
+                          { return p->endpoint == ep.net_endpoint && !p->removeSubscriber(ep.endpoint_id); });
+            has_net_peers_.store(!next->empty(), std::memory_order_release);
+            std::atomic_store_explicit(&net_peers_, std::shared_ptr<const NetPeerList>(std::move(next)),
+                                       std::memory_order_release);
             break;
         }
+        case ChannelKind::Uds:
+            break; // connection dropped on the next failed send
         }
     }
 
@@ -418,7 +758,8 @@ namespace lux::communication
             // Quick peer check via atomics — avoid mutex when no peers exist.
             const bool has_shm = has_shm_peers_.load(std::memory_order_relaxed);
             const bool has_net = has_net_peers_.load(std::memory_order_relaxed);
-            if (!has_shm && !has_net)
+            const bool has_uds = has_uds_peers_.load(std::memory_order_relaxed);
+            if (!has_shm && !has_net && !has_uds)
                 return;
 
             const uint32_t ser_size = static_cast<uint32_t>(Ser::serializedSize(msg));
@@ -433,38 +774,30 @@ namespace lux::communication
             }
 
             // Build FrameHeader (shared by SHM & Net paths).
-            transport::FrameHeader hdr;
-            hdr.topic_hash = topic_hash_;
-            hdr.seq_num = node_->domain().allocateSeqRange(1);
-            hdr.timestamp_ns = platform::steadyNowNs();
-            transport::setFormat(hdr, Ser::format);
-            hdr.payload_size = ser_size;
-
-            // Phase 6: Set Reliable flag in header.
-            if (opts_.qos.reliability == Reliability::Reliable)
-                transport::setReliable(hdr);
+            auto hdr = makeHeader(allocateSeqRange(1), clock_.tick(platform::steadyNowNs()), ser_size);
 
             // 2. SHM path — same-machine cross-process.
             if (has_shm)
             {
-                std::lock_guard lock(shm_mutex_);
-                if (!shm_peers_.empty())
-                {
-                    const auto sub_count = static_cast<uint32_t>(shm_peers_.size());
-                    if (sub_count > 1 && ser_size >= transport::kPoolThreshold)
-                        publishShmViaPool(msg, hdr, ser_size, sub_count);
-                    else
-                        publishShm(msg, hdr, ser_size);
-                }
+                const auto peers = shmPeers(); // keeps the peers alive
+                const auto &selected = selectShmPeers(*peers, msg, hdr.timestamp_ns);
+                if (selected.size() > 1 && ser_size >= transport::kPoolThreshold)
+                    publishShmViaPool(msg, hdr, ser_size, selected);
+                else if (!selected.empty())
+                    publishShm(msg, hdr, ser_size, selected);
             }
 
             // 3. Net path — cross-machine.
             if (has_net)
             {
-                std::lock_guard lock(net_mutex_);
-                if (!net_peers_.empty())
-                    publishNet(msg, hdr, ser_size);
+                const auto peers = netPeers();
+                if (!peers->empty())
+                    publishNet(msg, hdr, ser_size, *peers);
             }
+
+            // 4. UDS path — same-machine without SHM.
+            if (has_uds)
+                publishUds(msg, hdr, ser_size);
         }
     }
 
@@ -491,7 +824,8 @@ namespace lux::communication
             // Quick peer check via atomics — avoid mutex when no peers exist.
             const bool has_shm = has_shm_peers_.load(std::memory_order_relaxed);
             const bool has_net = has_net_peers_.load(std::memory_order_relaxed);
-            if (!has_shm && !has_net)
+            const bool has_uds = has_uds_peers_.load(std::memory_order_relaxed);
+            if (!has_shm && !has_net && !has_uds)
                 return;
 
             const uint32_t ser_size = static_cast<uint32_t>(Ser::serializedSize(*msg));
@@ -505,34 +839,25 @@ namespace lux::communication
                     return; // BestEffort: drop
             }
 
-            transport::FrameHeader hdr;
-            hdr.topic_hash = topic_hash_;
-            hdr.seq_num = node_->domain().allocateSeqRange(1);
-            hdr.timestamp_ns = platform::steadyNowNs();
-            transport::setFormat(hdr, Ser::format);
-            hdr.payload_size = ser_size;
-
-            if (opts_.qos.reliability == Reliability::Reliable)
-                transport::setReliable(hdr);
+            auto hdr = makeHeader(allocateSeqRange(1), clock_.tick(platform::steadyNowNs()), ser_size);
 
             if (has_shm)
             {
-                std::lock_guard lock(shm_mutex_);
-                if (!shm_peers_.empty())
-                {
-                    const auto sub_count = static_cast<uint32_t>(shm_peers_.size());
-                    if (sub_count > 1 && ser_size >= transport::kPoolThreshold)
-                        publishShmViaPool(*msg, hdr, ser_size, sub_count);
-                    else
-                        publishShm(*msg, hdr, ser_size);
-                }
+                const auto peers = shmPeers(); // keeps the peers alive
+                const auto &selected = selectShmPeers(*peers, *msg, hdr.timestamp_ns);
+                if (selected.size() > 1 && ser_size >= transport::kPoolThreshold)
+                    publishShmViaPool(*msg, hdr, ser_size, selected);
+                else if (!selected.empty())
+                    publishShm(*msg, hdr, ser_size, selected);
             }
             if (has_net)
             {
-                std::lock_guard lock(net_mutex_);
-                if (!net_peers_.empty())
-                    publishNet(*msg, hdr, ser_size);
+                const auto peers = netPeers();
+                if (!peers->empty())
+                    publishNet(*msg, hdr, ser_size, *peers);
             }
+            if (has_uds)
+                publishUds(*msg, hdr, ser_size);
         }
     }
 
@@ -552,6 +877,112 @@ namespace lux::communication
         }
     }
 
+    template <typename T>
+    void Publisher<T>::publishBatch(std::span<const T> msgs)
+    {
+        if (msgs.empty())
+            return;
+
+        publishIntraBatch(msgs);
+
+        if constexpr (serialization::HasSerializer<T>)
+        {
+            if (intra_only_)
+                return;
+
+            const bool has_shm = has_shm_peers_.load(std::memory_order_relaxed);
+            const bool has_net = has_net_peers_.load(std::memory_order_relaxed);
+            const bool has_uds = has_uds_peers_.load(std::memory_order_relaxed);
+            if (!has_shm && !has_net && !has_uds)
+                return;
+
+            thread_local std::vector<uint32_t> sizes;
+            sizes.resize(msgs.size());
+            size_t total = 0;
+            for (size_t i = 0; i < msgs.size(); ++i)
+            {
+                sizes[i] = static_cast<uint32_t>(Ser::serializedSize(msgs[i]));
+                total += sizes[i];
+            }
+
+            if (bandwidth_limiter_)
+            {
+                if (opts_.qos.reliability == Reliability::Reliable)
+                {
+                    // In bucket-sized pieces: more than the burst at once
+                    // would never become available.
+                    for (size_t left = total; left > 0;)
+                    {
+                        const size_t piece = std::min(left, bandwidth_limiter_->burst());
+                        bandwidth_limiter_->waitAndConsume(piece);
+                        left -= piece;
+                    }
+                }
+                else if (!bandwidth_limiter_->tryConsume(total))
+                {
+                    return; // BestEffort: drop the batch
+                }
+            }
+
+            const uint64_t first_seq = allocateSeqRange(msgs.size());
+            const uint64_t ts_ns = clock_.tick(platform::steadyNowNs(), msgs.size());
+
+            if (has_shm)
+                publishShmBatch(msgs, sizes, first_seq, ts_ns);
+
+            if (has_net)
+            {
+                const auto peers = netPeers();
+                if (!peers->empty())
+                    publishNetBatch(msgs, sizes, first_seq, ts_ns, *peers);
+            }
+
+            if (has_uds)
+            {
+                for (size_t i = 0; i < msgs.size(); ++i)
+                {
+                    auto hdr = makeHeader(first_seq + i, ts_ns + i, sizes[i]);
+                    publishUds(msgs[i], hdr, sizes[i]);
+                }
+            }
+        }
+    }
+
+    template <typename T>
+    template <std::input_iterator It, std::sentinel_for<It> S>
+    void Publisher<T>::publishBatch(It first, S last)
+    {
+        if constexpr (std::contiguous_iterator<It> && std::sized_sentinel_for<S, It> &&
+                      std::same_as<std::iter_value_t<It>, T>)
+        {
+            publishBatch(std::span<const T>(std::to_address(first), static_cast<size_t>(last - first)));
+        }
+        else
+        {
+            std::vector<T> buf;
+            for (; first != last; ++first)
+                buf.push_back(*first);
+            publishBatch(std::span<const T>(buf));
+        }
+    }
+
+    template <typename T>
+    transport::FrameHeader Publisher<T>::makeHeader(uint64_t seq, uint64_t ts_ns, uint32_t ser_size) const
+    {
+        transport::FrameHeader hdr;
+        hdr.topic_hash = topic_hash_;
+        hdr.seq_num = seq;
+        hdr.timestamp_ns = ts_ns;
+        transport::setFormat(hdr, Ser::format);
+        hdr.payload_size = ser_size;
+        hdr.publisher_id = publisher_id_;
+
+        // Phase 6: Set Reliable flag in header.
+        if (opts_.qos.reliability == Reliability::Reliable)
+            transport::setReliable(hdr);
+        return hdr;
+    }
+
     // ── Intra path — distribute to same-process unified Subscribers ──
 
     template <typename T>
@@ -569,7 +1000,7 @@ namespace lux::communication
         for (size_t i = 0; i < n; ++i)
         {
             auto *sub = static_cast<Subscriber<T> *>((*snapshot)[i]);
-            auto *exec = sub->callbackGroup()->executor();
+            auto *exec = sub->executor();
             const uint64_t seq = exec ? exec->allocateSeq() : 0;
             if (i + 1 < n)
                 sub->enqueue(seq, msg);           // copy for non-last
@@ -578,57 +1009,197 @@ namespace lux::communication
         }
     }
 
-    // ── SHM inline path ─────────────────────────────────────────────
+    template <typename T>
+    void Publisher<T>::publishIntraBatch(std::span<const T> msgs)
+    {
+        auto snapshot = topicAs<TopicT>().getSubscriberSnapshot();
+        if (!snapshot || snapshot->empty())
+            return;
+
+        // Large messages are shared by all subscribers: one allocation each.
+        std::span<const stored_msg_t<T>> stored;
+        std::vector<std::shared_ptr<T>> shared;
+        if constexpr (SmallValueMsg<T>)
+        {
+            stored = msgs;
+        }
+        else
+        {
+            shared.reserve(msgs.size());
+            for (const auto &msg : msgs)
+                shared.push_back(std::make_shared<T>(msg));
+            stored = shared;
+        }
+
+        // One contiguous range of each executor's sequence space.
+        for (auto *base : *snapshot)
+        {
+            auto *sub = static_cast<Subscriber<T> *>(base);
+            auto *exec = sub->executor();
+            const uint64_t first_seq = exec ? exec->allocateSeqRange(msgs.size()) : 0;
+            sub->enqueueBatch(first_seq, stored);
+        }
+    }
+
+    // ── Content filter pushdown ──────────────────────────────────────
 
     template <typename T>
-    void Publisher<T>::publishShm(const T &msg, transport::FrameHeader &hdr,
-                                  uint32_t ser_size)
+    void Publisher<T>::PeerFilters::add(const std::string &encoded)
     {
-        for (auto &peer : shm_peers_)
+        if (unfiltered)
+            return;
+        FieldFilter filter;
+        if (encoded.empty() || !FieldFilter::decode(encoded, filter) || filter.empty())
         {
-            void *slot = nullptr;
+            unfiltered = true;
+            entries.clear();
+            return;
+        }
+        filter.resolve<T>();
+        entries.push_back(Entry{std::move(filter)});
+    }
 
-            if (opts_.qos.reliability == Reliability::Reliable)
-            {
-                // Spin-wait with timeout for Reliable QoS.
-                auto deadline_tp = std::chrono::steady_clock::now() + opts_.shm_reliable_timeout;
-                while (!slot && std::chrono::steady_clock::now() < deadline_tp)
-                {
-                    slot = peer.writer->acquireSlot();
-                    if (!slot)
-                        std::this_thread::yield();
-                }
-            }
-            else
-            {
-                slot = peer.writer->acquireSlot();
-            }
+    template <typename T>
+    bool Publisher<T>::PeerFilters::wants(const T &msg, uint64_t ts_ns)
+    {
+        if (unfiltered || entries.empty())
+            return true;
+        // Every filter sees the message, so each keeps its own sampling
+        // state in step with its subscriber.
+        bool any = false;
+        for (auto &e : entries)
+        {
+            if (e.filter.matches(msg) && e.filter.sampled(ts_ns, e.last_pass_ns))
+                any = true;
+        }
+        return any;
+    }
+
+    template <typename T>
+    auto Publisher<T>::selectShmPeers(const ShmPeerList &peers, const T &msg, uint64_t ts_ns)
+        -> const std::vector<ShmPeer *> &
+    {
+        thread_local std::vector<ShmPeer *> selected;
+        selected.clear();
+        for (const auto &peer : peers)
+        {
+            if (peer->wants(msg, ts_ns))
+                selected.push_back(peer.get());
+        }
+        return selected;
+    }
 
+    // ── SHM inline path ─────────────────────────────────────────────
+
+    template <typename T>
+    void Publisher<T>::publishShm(const T &msg, transport::FrameHeader &hdr,
+                                  uint32_t ser_size, const std::vector<ShmPeer *> &peers)
+    {
+        for (ShmPeer *peer : peers)
+        {
+            // The ring is SPSC: one publishing thread per peer at a time.
+            std::lock_guard lock(peer->mutex);
+            void *slot = acquireShmSlot(*peer);
             if (!slot)
                 continue; // ring full — drop (even Reliable times out)
 
             std::memcpy(slot, &hdr, sizeof(hdr));
             char *payload = static_cast<char *>(slot) + sizeof(hdr);
             Ser::serialize(msg, payload,
-                           peer.writer->maxPayloadSize() - sizeof(hdr));
-            peer.writer->commitSlot(
+                           peer->writer->maxPayloadSize() - sizeof(hdr));
+            peer->writer->commitSlot(
                 static_cast<uint32_t>(sizeof(hdr) + ser_size));
         }
     }
 
+    template <typename T>
+    void *Publisher<T>::acquireShmSlot(ShmPeer &peer)
+    {
+        if (opts_.qos.reliability != Reliability::Reliable)
+            return peer.writer->acquireSlot();
+
+        // Spin-wait with timeout for Reliable QoS.
+        void *slot = nullptr;
+        auto deadline_tp = std::chrono::steady_clock::now() + opts_.shm_reliable_timeout;
+        while (!slot && std::chrono::steady_clock::now() < deadline_tp)
+        {
+            slot = peer.writer->acquireSlot();
+            if (!slot)
+                std::this_thread::yield();
+        }
+        return slot;
+    }
+
+    template <typename T>
+    void Publisher<T>::publishShmBatch(std::span<const T> msgs, std::span<const uint32_t> sizes,
+                                       uint64_t first_seq, uint64_t ts_ns)
+    {
+        const auto peers = shmPeers(); // keeps the peers alive
+        const bool reliable = opts_.qos.reliability == Reliability::Reliable;
+
+        for (size_t i = 0; i < msgs.size();)
+        {
+            // Pool-sized messages go one at a time, as in publish().
+            if (sizes[i] >= transport::kPoolThreshold)
+            {
+                auto hdr = makeHeader(first_seq + i, ts_ns + i, sizes[i]);
+                const auto &selected = selectShmPeers(*peers, msgs[i], ts_ns + i);
+                if (selected.size() > 1)
+                    publishShmViaPool(msgs[i], hdr, sizes[i], selected);
+                else if (!selected.empty())
+                    publishShm(msgs[i], hdr, sizes[i], selected);
+                ++i;
+                continue;
+            }
+
+            // A run of inline messages: one lock per peer, consecutive slots.
+            size_t end = i + 1;
+            while (end < msgs.size() && sizes[end] < transport::kPoolThreshold)
+                ++end;
+
+            for (const auto &peer : *peers)
+            {
+                std::lock_guard lock(peer->mutex);
+                const bool filtered = peer->filtered.load(std::memory_order_relaxed);
+                for (size_t k = i; k < end; ++k)
+                {
+                    if (filtered && !peer->filters.wants(msgs[k], ts_ns + k))
+                        continue;
+                    void *slot = acquireShmSlot(*peer);
+                    if (!slot)
+                    {
+                        if (reliable)
+                            break; // timed out: the rest would wait as long
+                        continue;  // ring full — drop
+                    }
+
+                    const auto hdr = makeHeader(first_seq + k, ts_ns + k, sizes[k]);
+                    std::memcpy(slot, &hdr, sizeof(hdr));
+                    Ser::serialize(msgs[k], static_cast<char *>(slot) + sizeof(hdr),
+                                   peer->writer->maxPayloadSize() - sizeof(hdr));
+                    peer->writer->commitSlot(static_cast<uint32_t>(sizeof(hdr) + sizes[k]));
+                }
+            }
+            i = end;
+        }
+    }
+
     // ── SHM pool path (Phase 3 — large message 1:N) ─────────────────
 
     template <typename T>
     void Publisher<T>::publishShmViaPool(const T &msg, transport::FrameHeader &hdr,
-                                         uint32_t ser_size, uint32_t sub_count)
+                                         uint32_t ser_size, const std::vector<ShmPeer *> &peers)
     {
-        ensureDataPool();
-
-        auto alloc = data_pool_->allocate(ser_size, sub_count);
+        transport::ShmDataPool::AllocResult alloc;
+        {
+            std::lock_guard lock(pool_mutex_);
+            ensureDataPool();
+            alloc = data_pool_->allocate(ser_size, static_cast<uint32_t>(peers.size()));
+        }
         if (!alloc.payload)
         {
             // Pool full — fallback to inline.
-            publishShm(msg, hdr, ser_size);
+            publishShm(msg, hdr, ser_size, peers);
             return;
         }
 
@@ -642,9 +1213,10 @@ namespace lux::communication
         hdr.payload_size = sizeof(transport::PoolDescriptor);
         transport::setPooled(hdr);
 
-        for (auto &peer : shm_peers_)
+        for (ShmPeer *peer : peers)
         {
-            void *slot = peer.writer->acquireSlot();
+            std::lock_guard lock(peer->mutex);
+            void *slot = peer->writer->acquireSlot();
             if (!slot)
             {
                 data_pool_->release(alloc.ref_count_offset);
@@ -652,7 +1224,7 @@ namespace lux::communication
             }
             std::memcpy(slot, &hdr, sizeof(hdr));
             std::memcpy(static_cast<char *>(slot) + sizeof(hdr), &desc, sizeof(desc));
-            peer.writer->commitSlot(
+            peer->writer->commitSlot(
                 static_cast<uint32_t>(sizeof(hdr) + sizeof(desc)));
         }
     }
@@ -672,8 +1244,19 @@ namespace lux::communication
 
     template <typename T>
     void Publisher<T>::publishNet(const T &msg, transport::FrameHeader &hdr,
-                                  uint32_t ser_size)
+                                  uint32_t ser_size, const NetPeerList &peers)
     {
+        // Pushed-down filters first: nothing to serialize if no peer wants it.
+        thread_local std::vector<NetPeer *> selected;
+        selected.clear();
+        for (const auto &peer : peers)
+        {
+            if (peer->wants(msg, hdr.timestamp_ns))
+                selected.push_back(peer.get());
+        }
+        if (selected.empty())
+            return;
+
         // Serialize once into a contiguous buffer.
         const uint32_t frame_size = static_cast<uint32_t>(sizeof(hdr) + ser_size);
         thread_local std::vector<char> buf;
@@ -681,24 +1264,123 @@ namespace lux::communication
         std::memcpy(buf.data(), &hdr, sizeof(hdr));
         Ser::serialize(msg, buf.data() + sizeof(hdr), ser_size);
 
-        for (auto &peer : net_peers_)
+        const bool adaptive = opts_.net_path_mode == NetPathMode::Adaptive;
+        const uint64_t now_ns = adaptive ? platform::steadyNowNs() : 0;
+
+        for (NetPeer *peer : selected)
         {
+            std::lock_guard lock(peer->mutex);
+
+            // Adaptive: per-peer frame-size limit derived from measured loss.
+            const bool use_udp =
+                adaptive && peer->udp
+                    ? frame_size <= peer->udp->linkQuality().udpThreshold(
+                                        opts_.net_large_threshold, now_ns)
+                    : ser_size < opts_.net_large_threshold;
+
             // Phase 6: Reliable → always use TCP.
-            if (opts_.qos.reliability == Reliability::Reliable && peer.tcp)
+            if (opts_.qos.reliability == Reliability::Reliable && peer->tcp)
             {
-                peer.tcp->send(hdr, buf.data() + sizeof(hdr), ser_size);
+                peer->tcp->send(hdr, buf.data() + sizeof(hdr), ser_size);
             }
-            else if (ser_size < opts_.net_large_threshold && peer.udp)
+            else if (use_udp && peer->udp)
             {
-                peer.udp->send(hdr, buf.data() + sizeof(hdr), ser_size);
+                peer->udp->send(hdr, buf.data() + sizeof(hdr), ser_size);
             }
-            else if (peer.tcp)
+            else if (peer->tcp)
             {
-                peer.tcp->send(hdr, buf.data() + sizeof(hdr), ser_size);
+                peer->tcp->send(hdr, buf.data() + sizeof(hdr), ser_size);
             }
         }
     }
 
+    template <typename T>
+    void Publisher<T>::publishNetBatch(std::span<const T> msgs, std::span<const uint32_t> sizes,
+                                       uint64_t first_seq, uint64_t ts_ns, const NetPeerList &peers)
+    {
+        // Serialize every frame once, back to back, so that consecutive TCP
+        // frames go out in one write.
+        thread_local std::vector<char> buf;
+        thread_local std::vector<size_t> offsets;
+        offsets.resize(msgs.size() + 1);
+        offsets[0] = 0;
+        for (size_t k = 0; k < msgs.size(); ++k)
+            offsets[k + 1] = offsets[k] + sizeof(transport::FrameHeader) + sizes[k];
+        buf.resize(offsets.back());
+        for (size_t k = 0; k < msgs.size(); ++k)
+        {
+            const auto hdr = makeHeader(first_seq + k, ts_ns + k, sizes[k]);
+            std::memcpy(buf.data() + offsets[k], &hdr, sizeof(hdr));
+            Ser::serialize(msgs[k], buf.data() + offsets[k] + sizeof(hdr), sizes[k]);
+        }
+
+        const bool reliable = opts_.qos.reliability == Reliability::Reliable;
+        const bool adaptive = opts_.net_path_mode == NetPathMode::Adaptive;
+        const uint64_t now_ns = adaptive ? platform::steadyNowNs() : 0;
+
+        for (const auto &peer : peers)
+        {
+            std::lock_guard lock(peer->mutex);
+            const bool filtered = peer->filtered.load(std::memory_order_relaxed);
+            const size_t udp_limit = adaptive && peer->udp
+                                         ? peer->udp->linkQuality().udpThreshold(opts_.net_large_threshold, now_ns)
+                                         : 0;
+
+            // Pending run of TCP frames: buf[run_begin, run_end).
+            size_t run_begin = 0;
+            size_t run_end = 0;
+            auto flush = [&]
+            {
+                if (run_end > run_begin)
+                    peer->tcp->sendFrames(buf.data() + run_begin, run_end - run_begin);
+                run_begin = run_end;
+            };
+
+            for (size_t k = 0; k < msgs.size(); ++k)
+            {
+                if (filtered && !peer->filters.wants(msgs[k], ts_ns + k))
+                    continue;
+
+                // Same choice as publishNet().
+                const size_t frame_size = offsets[k + 1] - offsets[k];
+                const bool use_udp = adaptive && peer->udp
+                                         ? frame_size <= udp_limit
+                                         : sizes[k] < opts_.net_large_threshold;
+                if (peer->tcp && (reliable || !(use_udp && peer->udp)))
+                {
+                    if (run_end != offsets[k])
+                    {
+                        flush();
+                        run_begin = offsets[k];
+                    }
+                    run_end = offsets[k + 1];
+                }
+                else if (use_udp && peer->udp)
+                {
+                    transport::FrameHeader hdr;
+                    std::memcpy(&hdr, buf.data() + offsets[k], sizeof(hdr));
+                    peer->udp->send(hdr, buf.data() + offsets[k] + sizeof(hdr), sizes[k]);
+                }
+            }
+            flush();
+        }
+    }
+
+    // ── UDS path ─────────────────────────────────────────────────────
+
+    template <typename T>
+    void Publisher<T>::publishUds(const T &msg, transport::FrameHeader &hdr,
+                                  uint32_t ser_size)
+    {
+        thread_local std::vector<char> buf;
+        buf.resize(ser_size);
+        Ser::serialize(msg, buf.data(), ser_size);
+
+        if (uds_writer_->send(hdr, buf.data(), ser_size) == 0 &&
+            uds_writer_->connectionCount() == 0)
+            has_uds_peers_.store(false, std::memory_order_release);
+    }
+
     // ── Loan API (SHM, TriviallyCopyableMsg only) ────────────────────
 
     template <typename T>
@@ -708,16 +1390,22 @@ namespace lux::communication
 
         transport::FrameHeader hdr;
         hdr.topic_hash = topic_hash_;
-        hdr.seq_num = node_->domain().allocateSeqRange(1);
-        hdr.timestamp_ns = platform::steadyNowNs();
+        hdr.seq_num = allocateSeqRange(1);
+        hdr.timestamp_ns = clock_.tick(platform::steadyNowNs());
         hdr.payload_size = static_cast<uint32_t>(sizeof(T));
+        hdr.publisher_id = publisher_id_;
         transport::setFormat(hdr, transport::SerializationFormat::RawMemcpy);
         transport::setLoaned(hdr);
 
-        std::lock_guard lock(shm_mutex_);
-        if (shm_peers_.empty())
+        const auto peers = shmPeers();
+        if (peers->empty())
             return {}; // no SHM subscribers
-        return transport::LoanedMessage<T>(shm_peers_[0].writer.get(), hdr);
+        // The loan shares ownership of the peer, so its ring outlives a
+        // discovery update that drops the peer.  The peer's mutex guards
+        // each ring operation; the slot itself stays reserved in between.
+        const auto &first = peers->front();
+        return transport::LoanedMessage<T>(first->writer.get(), hdr,
+                                           std::shared_ptr<std::mutex>(first, &first->mutex));
     }
 
     template <typename T>
@@ -728,27 +1416,35 @@ namespace lux::communication
         if (!loaned.valid())
             return;
 
-        std::lock_guard lock(shm_mutex_);
-        uint32_t total = static_cast<uint32_t>(sizeof(transport::FrameHeader) + sizeof(T));
-        loaned.markCommitted();
-        shm_peers_[0].writer->commitSlot(total);
+        const uint32_t total = static_cast<uint32_t>(sizeof(transport::FrameHeader) + sizeof(T));
+        // Copy out first: once committed, the slot belongs to the reader.
+        stored_msg_t<T> intra;
+        if constexpr (SmallValueMsg<T>)
+            intra = *loaned.get();
+        else
+            intra = std::make_shared<T>(*loaned.get());
 
-        // Replicate to additional SHM peers.
-        if (shm_peers_.size() > 1)
+        // Replicate to the other SHM peers (the current snapshot; the
+        // loaned peer may have left it since).
+        const void *src = loaned.slotBase();
+        for (const auto &peer : *shmPeers())
         {
-            const void *src = loaned.slotBase();
-            for (size_t i = 1; i < shm_peers_.size(); ++i)
-            {
-                void *dst = shm_peers_[i].writer->acquireSlot();
-                if (!dst)
-                    continue;
-                std::memcpy(dst, src, total);
-                shm_peers_[i].writer->commitSlot(total);
-            }
+            if (peer->writer.get() == loaned.writer_)
+                continue;
+            std::lock_guard lock(peer->mutex);
+            void *dst = peer->writer->acquireSlot();
+            if (!dst)
+                continue;
+            std::memcpy(dst, src, total);
+            peer->writer->commitSlot(total);
         }
 
+        // On the ring the slot was loaned from (releases the publishes
+        // queued behind it there).
+        loaned.commit(total);
+
         // Also publish to intra subscribers (they need the data too).
-        publishIntra(std::make_shared<T>(*loaned.get()));
+        publishIntra(std::move(intra));
     }
 
 } // namespace lux::communication
@@ -3,19 +3,28 @@
 ///
 /// - Intra: called by Topic<T>::publish() → enqueue()  (same-process, zero-copy)
 /// - SHM:   polled by IoThread → pollShmReaders() → deserialize → enqueue()
+/// - UDS:   IoReactor callback → deserialize → enqueue()
 /// - Net:   IoReactor callback → deserialize → enqueue()
 ///
 /// All paths converge into one ordered_queue_t, fed through the standard
-/// CallbackGroup → Executor pipeline.
+/// CallbackGroup → Executor pipeline.  With
+/// SubscribeOptions::deserialize_on_executor, SHM / network messages are
+/// queued as raw bytes and deserialized by the executor thread that pops
+/// them.
 
+#include <algorithm>
 #include <functional>
 #include <thread>
 #include <atomic>
 #include <mutex>
 #include <chrono>
+#include <coroutine>
+#include <span>
 #include <vector>
 
 #include <lux/communication/Queue.hpp>
+#include <lux/communication/KeepLastRing.hpp>
+#include <lux/communication/MessagePool.hpp>
 #include <lux/communication/MessageTraits.hpp>
 #include <lux/communication/SubscriberBase.hpp>
 #include <lux/communication/SubscribeOptions.hpp>
@@ -23,6 +32,7 @@
 #include <lux/communication/TransportSelector.hpp>
 #include <lux/communication/CallbackGroupBase.hpp>
 #include <lux/communication/Hash.hpp>
+#include <lux/communication/HybridClock.hpp>
 #include <lux/communication/intraprocess/Topic.hpp>
 
 #include <lux/communication/serialization/Serializer.hpp>
@@ -32,6 +42,7 @@
 #include <lux/communication/transport/IoReactor.hpp>
 #include <lux/communication/transport/UdpTransportReader.hpp>
 #include <lux/communication/transport/TcpTransportReader.hpp>
+#include <lux/communication/transport/UdsTransportReader.hpp>
 #include <lux/communication/discovery/DiscoveryService.hpp>
 #include <lux/communication/platform/PlatformDefs.hpp>
 #include <lux/communication/builtin_msgs/common_msgs/timestamp.st.h>
@@ -53,6 +64,17 @@ namespace lux::communication
 {
 
     /// Unified Subscriber.
+    ///
+    /// The callback is either per message (`void(callback_arg_t<T>)`) or a
+    /// batch callback (`void(std::span<const stored_msg_t<T>>)`).  A batch
+    /// callback receives everything one takeAll() drains as one contiguous
+    /// span, split by SubscribeOptions::max_batch_size and held back for up
+    /// to SubscribeOptions::max_batch_wait while the batch is not full.
+    ///
+    /// A coroutine can instead `co_await sub->next()` (pass `nullptr` as the
+    /// callback for a subscriber consumed only that way).  The message is
+    /// moved from the queue straight into the awaiting frame, and the
+    /// coroutine resumes on the executor thread that takes the subscriber.
     template <typename T>
     class Subscriber : public SubscriberBase
     {
@@ -64,11 +86,23 @@ namespace lux::communication
         static CallbackGroupBase *resolveCallbackGroup(CallbackGroupBase *cbg, Node *node);
 
         // ── Ordered item ──
+        struct NoRawBytes
+        {
+        };
+        /// Serialized payload of a message not yet deserialized.
+        using raw_bytes_t = std::conditional_t<SmallValueMsg<T>, NoRawBytes,
+                                               std::shared_ptr<std::vector<uint8_t>>>;
+
         struct OrderedItem
         {
             uint64_t seq;
             uint64_t timestamp_ns; // publish-time (for lifespan checking)
             stored_msg_t<T> msg;
+            /// Set instead of msg under deserialize_on_executor; see materialize().
+            [[no_unique_address]] raw_bytes_t raw{};
+            /// OrderKey::origin of a message from another process (seq holds
+            /// its stamp); 0 for intra-process and stamped messages.
+            uint64_t origin{0};
         };
 
 #ifdef LUX_UNIFIED_SUBSCRIBER_USE_LOCKFREE_QUEUE
@@ -100,8 +134,35 @@ namespace lux::communication
 
     public:
         using Callback = std::function<void(callback_arg_t<T>)>;
+        /// Span elements are stored messages: `T` for small values (a span
+        /// cannot hold `const T&`), `shared_ptr<T>` otherwise.
+        using BatchCallback = std::function<void(std::span<const stored_msg_t<T>>)>;
         using ContentFilter = std::function<bool(const T &)>;
 
+        /// Awaiter returned by next().  Completes immediately if a message
+        /// is queued, otherwise parks the coroutine until the executor takes
+        /// this subscriber.
+        class NextAwaiter
+        {
+        public:
+            explicit NextAwaiter(Subscriber &sub) : sub_(&sub) {}
+            ~NextAwaiter();
+
+            NextAwaiter(const NextAwaiter &) = delete;
+            NextAwaiter &operator=(const NextAwaiter &) = delete;
+
+            bool await_ready() { return sub_->popAccepted(msg_); }
+            void await_suspend(std::coroutine_handle<> handle);
+            stored_msg_t<T> await_resume() { return std::move(msg_); }
+
+        private:
+            friend class Subscriber;
+
+            Subscriber *sub_;
+            std::coroutine_handle<> handle_;
+            stored_msg_t<T> msg_{};
+        };
+
         template <typename Func>
         Subscriber(const std::string &topic_name, Node *node, Func &&func,
                    CallbackGroupBase *cbg = nullptr,
@@ -121,8 +182,14 @@ namespace lux::communication
         // ── Intra path entry point (called by Topic<T>::publish) ──
         void enqueue(uint64_t seq, stored_msg_t<T> msg);
 
+        /// Enqueue a burst with consecutive sequence numbers from `first_seq`
+        /// (0 = unsequenced): one timestamp, one deadline reset and one
+        /// executor notification for the lot.
+        void enqueueBatch(uint64_t first_seq, std::span<const stored_msg_t<T>> msgs);
+
         // ── SubscriberBase interface (called by Executors) ──
         void takeAll() override;
+        void takeSome(size_t max_count) override;
         void drainAll(std::vector<TimeExecEntry> &out) override;
         void drainAllExec(std::vector<ExecEntry> &out) override;
         size_t drainExecSome(std::vector<ExecEntry> &out, size_t max_count) override;
@@ -130,6 +197,17 @@ namespace lux::communication
         /// Poll all SHM readers.  Called by IoThread.
         void pollShmReaders();
 
+        /// Await the next message.  One coroutine may await a subscriber at
+        /// a time; while it waits it takes precedence over the callback.
+        NextAwaiter next() { return NextAwaiter(*this); }
+
+        /// Messages a KeepLast subscription overwrote before they were taken
+        /// (0 for KeepAll).
+        uint64_t keepLastDropped() const { return keep_last_ ? keep_last_->dropped() : 0; }
+
+        /// True if the subscriber was created with a batch callback.
+        bool isBatch() const { return static_cast<bool>(batch_callback_); }
+
         const std::string &topicName() const { return topic_name_; }
 
     private:
@@ -139,12 +217,34 @@ namespace lux::communication
         void onPeerDiscovered(const discovery::TopicEndpoint &ep);
         void onPeerLost(const discovery::TopicEndpoint &ep);
 
+        /// Discovery endpoint ids of the publishers sharing one channel
+        /// (one process); the channel is closed once all of them are lost.
+        using PublisherIds = std::vector<uint32_t>;
+
+        /// Record `id` on an existing channel; returns false if it was known.
+        static bool addPublisher(PublisherIds &ids, uint32_t id)
+        {
+            if (std::find(ids.begin(), ids.end(), id) != ids.end())
+                return false;
+            ids.push_back(id);
+            return true;
+        }
+
+        /// Forget `id`; returns true once the channel has no publisher left.
+        static bool removePublisher(PublisherIds &ids, uint32_t id)
+        {
+            std::erase(ids, id);
+            return ids.empty();
+        }
+
         // ── SHM reader management ──
         struct ShmPeer
         {
             uint32_t pub_pid;
             std::string shm_name;
             std::unique_ptr<transport::ShmRingReader> reader;
+            PublisherIds publishers;
+            uint32_t process_tag; // see processTag()
         };
 
         // ── Net reader management ──
@@ -153,24 +253,91 @@ namespace lux::communication
             std::string endpoint;
             std::unique_ptr<transport::UdpTransportReader> udp;
             std::unique_ptr<transport::TcpTransportReader> tcp;
+            PublisherIds publishers;
+        };
+
+        // ── UDS reader management ──
+        struct UdsPeer
+        {
+            std::string endpoint;
+            std::unique_ptr<transport::UdsTransportReader> reader;
+            PublisherIds publishers;
         };
 
         void processReadView(ShmPeer &entry);
         void ensurePool(const ShmPeer &entry);
 
-        /// Process a received network frame (TCP or UDP).
+        /// Process a received network frame (TCP, UDP or UDS) sent by the
+        /// process `process_tag` stands for.
         void processNetFrame(const transport::FrameHeader &hdr,
-                             const void *payload, uint32_t payload_size);
+                             const void *payload, uint32_t payload_size,
+                             uint32_t process_tag);
 
-        /// Unregister all net peer fds from the IoReactor.
+        /// Unregister all net and UDS peer fds from the IoReactor.
         void unregisterNetFds();
 
-        static void invokeTrampoline(void *obj, std::shared_ptr<void> msg);
+        /// Content filters: field_filter predicates, the ContentFilter
+        /// callback, then field_filter sampling by `ts_ns` (steady ns).
+        bool admit(const T &msg, uint64_t ts_ns);
+
+        /// Order key of a frame from another process: frame seq_num counts
+        /// per publisher, so SeqOrderedExecutor merges these by stamp and
+        /// sender instead (see OrderKey).
+        static OrderKey remoteKey(const transport::FrameHeader &hdr, uint32_t process_tag)
+        {
+            return {hdr.timestamp_ns, OrderKey::makeOrigin(hdr.publisher_id, process_tag)};
+        }
+
+        /// Queue a decoded message from another process and schedule the
+        /// subscriber.  Stamped messages order by their own stamp instead.
+        void pushRemote(OrderKey key, uint64_t timestamp_ns, stored_msg_t<T> msg);
+
+        /// Storage for a received (SHM / network) message, recycled from
+        /// msg_pool_ when pooling is on.
+        std::shared_ptr<T> newMessage()
+            requires(!SmallValueMsg<T>)
+        {
+            return msg_pool_ ? msg_pool_->acquire() : std::make_shared<T>();
+        }
+
+        // ── Deferred deserialization (deserialize_on_executor) ──
+        /// Queue a received payload as raw bytes (IoThread).
+        void pushRaw(OrderKey key, uint64_t timestamp_ns, const void *data, size_t size);
+        /// Deserialize a raw item in place and apply the content filter;
+        /// false if it must be dropped.  No-op for items already decoded.
+        bool materialize(OrderedItem &item);
+
+        // ── Message queue (KeepLast ring or unbounded queue) ──
+        /// Queue `item`; a full KeepLast ring evicts its oldest entries,
+        /// reported to `exec` as consumed when given.
+        void pushItem(OrderedItem item, ExecutorBase *exec = nullptr);
+        bool popItem(OrderedItem &out);
+        size_t popBulk(OrderedItem *items, size_t max_count);
+        size_t queuedApprox();
+
+        /// ExecEntry invoker: runs the callback on an entry's stored message.
+        static void invokeExec(void *obj, stored_msg_t<T> &msg);
+
+        // ── Awaiting coroutine ──
+        /// Pop the next message that passes the QoS checks.
+        bool popAccepted(stored_msg_t<T> &out);
+        /// Take the armed awaiter together with the message it will receive.
+        NextAwaiter *takeAwaiter(OrderedItem &item);
+        /// ExecEntry invoker: hands an entry's message to an awaiter.
+        static void resumeExec(void *obj, stored_msg_t<T> &msg);
+        /// True if anything will consume queued messages.
+        bool hasConsumer() const;
+
+        // ── Batch delivery ──
+        void takeBatch(size_t max_count);
+        void flushBatch();
+        void checkBatchWait();
 
         // ── Members ──
         std::string topic_name_;
         Node *node_;
         Callback callback_func_;
+        BatchCallback batch_callback_;
         ContentFilter content_filter_;
         SubscribeOptions opts_;
         uint64_t topic_hash_;
@@ -178,13 +345,22 @@ namespace lux::communication
         uint64_t listener_id_ = 0;
         uint64_t io_poll_handle_ = 0;
 
+        /// Timestamp of the last message passed by field_filter sampling.
+        std::atomic<uint64_t> sample_last_ns_{0};
+
         std::mutex shm_mutex_;
         std::vector<ShmPeer> shm_peers_;
 
         std::mutex net_mutex_;
         std::vector<NetPeer> net_peers_;
 
+        std::mutex uds_mutex_;
+        std::vector<UdsPeer> uds_peers_;
+
         ordered_queue_t queue_;
+        std::unique_ptr<KeepLastRing<OrderedItem>> keep_last_; // History::KeepLast only
+        std::shared_ptr<MessagePool<T>> msg_pool_;              // received messages, non-small T
+        std::shared_ptr<MessagePool<std::vector<uint8_t>>> raw_pool_; // deserialize_on_executor only
         std::atomic<bool> stopped_{false};
 
         std::unique_ptr<transport::ShmDataPool> data_pool_;
@@ -199,6 +375,15 @@ namespace lux::communication
         uint64_t deadline_poll_handle_ = 0;
         std::function<void()> deadline_missed_cb_;
 
+        // ── Batch callback: partial batch held for max_batch_wait ──
+        std::vector<stored_msg_t<T>> batch_;
+        std::atomic<uint64_t> batch_due_ns_{0}; // 0 = nothing held
+        uint64_t batch_since_ns_ = 0;            // timestamp of batch_.front()
+        uint64_t batch_poll_handle_ = 0;
+
+        // ── Coroutine parked in next() ──
+        std::atomic<NextAwaiter *> waiter_{nullptr};
+
         // ── QoS helpers ──
         bool shouldDiscard(const OrderedItem &item) const;
         void checkDeadline();
@@ -241,10 +426,46 @@ namespace lux::communication
         : SubscriberBase(getOrCreateTopic(node, topic_name),
                          node,
                          resolveCallbackGroup(cbg, node)),
-          topic_name_(topic_name), node_(node), callback_func_(std::forward<Func>(func)), content_filter_(std::move(filter)), opts_(opts), topic_hash_(fnv1a_64(topic_name)), deadline_missed_cb_(opts.on_deadline_missed)
+          topic_name_(topic_name), node_(node), content_filter_(std::move(filter)), opts_(opts), topic_hash_(fnv1a_64(topic_name)), deadline_missed_cb_(opts.on_deadline_missed)
     {
+        if constexpr (std::is_null_pointer_v<std::remove_cvref_t<Func>>)
+        {
+            // Consumed through next() only.
+        }
+        else if constexpr (std::is_invocable_v<Func &, callback_arg_t<T>>)
+        {
+            callback_func_ = std::forward<Func>(func);
+        }
+        else
+        {
+            static_assert(std::is_invocable_v<Func &, std::span<const stored_msg_t<T>>>,
+                          "Subscriber callback must take callback_arg_t<T> or std::span<const stored_msg_t<T>>");
+            batch_callback_ = std::forward<Func>(func);
+        }
+
+        opts_.field_filter.resolve<T>();
+        if (opts_.qos.history == History::KeepLast && opts_.qos.depth > 0)
+            keep_last_ = std::make_unique<KeepLastRing<OrderedItem>>(opts_.qos.depth);
+        if constexpr (!SmallValueMsg<T>)
+        {
+            if (opts_.message_pool_size > 0)
+                msg_pool_ = MessagePool<T>::create(opts_.message_pool_size);
+            if (opts_.deserialize_on_executor)
+                raw_pool_ = MessagePool<std::vector<uint8_t>>::create(
+                    opts_.message_pool_size ? opts_.message_pool_size : 1);
+        }
+
         const auto &nopts = node_->options();
 
+        // ── Executor scheduling hints (ReadyPolicy, WaitPolicy) ──
+        {
+            const std::chrono::nanoseconds budget(opts_.qos.latency_budget);
+            const std::chrono::nanoseconds rel_deadline =
+                budget.count() > 0 ? budget : std::chrono::nanoseconds(opts_.qos.deadline);
+            setSchedulingHints(opts_.priority, static_cast<uint64_t>(rel_deadline.count()),
+                               static_cast<uint64_t>(budget.count()));
+        }
+
         // ── Discovery (for SHM / Net peers) ──
         if (nopts.enable_discovery &&
             opts_.transport_hint != SubscribeTransportHint::IntraOnly)
@@ -252,7 +473,8 @@ namespace lux::communication
             auto &ds = discovery::DiscoveryService::getInstance(node_->domain().id());
 
             discovery_handle_ = ds.announceSubscriber(
-                topic_name_, typeid(T).name(), typeid(T).hash_code());
+                topic_name_, typeid(T).name(), typeid(T).hash_code(), "", "",
+                opts_.field_filter.encode());
 
             listener_id_ = ds.addListener(topic_name_,
                                           [this](const discovery::DiscoveryEvent &ev)
@@ -289,6 +511,14 @@ namespace lux::communication
                 [this]()
                 { checkDeadline(); });
         }
+
+        // ── Flush partial batches that waited max_batch_wait ──
+        if (batch_callback_ && opts_.max_batch_wait.count() > 0)
+        {
+            batch_poll_handle_ = node_->ioThread().registerPoller(
+                [this]()
+                { checkBatchWait(); });
+        }
     }
 
     // ── Destructor ───────────────────────────────────────────────────
@@ -318,6 +548,13 @@ namespace lux::communication
             io_poll_handle_ = 0;
         }
 
+        // Unregister batch-wait poller.
+        if (batch_poll_handle_)
+        {
+            node_->ioThread().unregisterPoller(batch_poll_handle_);
+            batch_poll_handle_ = 0;
+        }
+
         // Unregister deadline poller.
         if (deadline_poll_handle_)
         {
@@ -375,14 +612,20 @@ namespace lux::communication
                 return; // ring not yet created
 
             std::lock_guard lock(shm_mutex_);
-            for (const auto &p : shm_peers_)
+            for (auto &p : shm_peers_)
+            {
                 if (p.pub_pid == ep.pid)
+                {
+                    addPublisher(p.publishers, ep.endpoint_id); // another publisher there
                     return;
+                }
+            }
 
             try
             {
                 auto reader = std::make_unique<transport::ShmRingReader>(ep.shm_segment_name);
-                shm_peers_.push_back(ShmPeer{ep.pid, ep.shm_segment_name, std::move(reader)});
+                shm_peers_.push_back(ShmPeer{ep.pid, ep.shm_segment_name, std::move(reader), {ep.endpoint_id},
+                                             processTag(ep.hostname, ep.pid)});
             }
             catch (const std::exception &)
             {
@@ -397,9 +640,14 @@ namespace lux::communication
                 return;
 
             std::lock_guard lock(net_mutex_);
-            for (const auto &p : net_peers_)
+            for (auto &p : net_peers_)
+            {
                 if (p.endpoint == ep.net_endpoint)
+                {
+                    addPublisher(p.publishers, ep.endpoint_id);
                     return;
+                }
+            }
 
             try
             {
@@ -411,6 +659,7 @@ namespace lux::communication
                 uint16_t port = static_cast<uint16_t>(
                     std::stoi(ep.net_endpoint.substr(colon + 1)));
 
+                const uint32_t tag = processTag(ep.hostname, ep.pid);
                 auto udp = std::make_unique<transport::UdpTransportReader>();
                 auto tcp = std::make_unique<transport::TcpTransportReader>(
                     addr, port, topic_hash_, typeid(T).hash_code(),
@@ -423,15 +672,15 @@ namespace lux::communication
                     node_->reactor().addFd(
                         tcp_raw->nativeFd(),
                         transport::IoReactor::Readable,
-                        [this, tcp_raw](platform::socket_t, uint8_t events)
+                        [this, tcp_raw, tag](platform::socket_t, uint8_t events)
                         {
                             if (events & transport::IoReactor::Error)
                                 return;
                             tcp_raw->onDataReady(
-                                [this](const transport::FrameHeader &hdr,
-                                       const void *payload, uint32_t sz)
+                                [this, tag](const transport::FrameHeader &hdr,
+                                            const void *payload, uint32_t sz)
                                 {
-                                    processNetFrame(hdr, payload, sz);
+                                    processNetFrame(hdr, payload, sz, tag);
                                 });
                         });
                 }
@@ -441,19 +690,19 @@ namespace lux::communication
                 node_->reactor().addFd(
                     udp_raw->nativeFd(),
                     transport::IoReactor::Readable,
-                    [this, udp_raw](platform::socket_t, uint8_t events)
+                    [this, udp_raw, tag](platform::socket_t, uint8_t events)
                     {
                         if (events & transport::IoReactor::Error)
                             return;
                         udp_raw->pollOnce(
-                            [this](const transport::FrameHeader &hdr,
-                                   const void *payload, uint32_t sz)
+                            [this, tag](const transport::FrameHeader &hdr,
+                                        const void *payload, uint32_t sz)
                             {
-                                processNetFrame(hdr, payload, sz);
+                                processNetFrame(hdr, payload, sz, tag);
                             });
                     });
 
-                // ── Register periodic UDP fragment GC if not already done ──
+                // ── Register periodic UDP fragment GC + link feedback if not already done ──
                 if (udp_gc_handle_ == 0)
                 {
                     udp_gc_handle_ = node_->ioThread().registerPoller(
@@ -463,12 +712,15 @@ namespace lux::communication
                             for (auto &p : net_peers_)
                             {
                                 if (p.udp)
+                                {
                                     p.udp->gc();
+                                    p.udp->sendLinkReport(); // feeds the publisher's adaptive path
+                                }
                             }
                         });
                 }
 
-                net_peers_.push_back(NetPeer{ep.net_endpoint, std::move(udp), std::move(tcp)});
+                net_peers_.push_back(NetPeer{ep.net_endpoint, std::move(udp), std::move(tcp), {ep.endpoint_id}});
             }
             catch (const std::exception &)
             {
@@ -476,6 +728,50 @@ namespace lux::communication
             }
             break;
         }
+
+        case ChannelKind::Uds:
+        {
+            if (opts_.transport_hint != SubscribeTransportHint::Auto)
+                return;
+
+            std::lock_guard lock(uds_mutex_);
+            for (auto &p : uds_peers_)
+            {
+                if (p.endpoint == ep.net_endpoint)
+                {
+                    addPublisher(p.publishers, ep.endpoint_id);
+                    return;
+                }
+            }
+
+            auto reader = std::make_unique<transport::UdsTransportReader>(
+                udsPathOf(ep.net_endpoint), topic_hash_, typeid(T).hash_code(),
+                platform::currentPid(), platform::currentHostname());
+            if (!reader->connect())
+                return; // publisher gone or type mismatch — retry on next announce
+
+            auto *uds_raw = reader.get();
+            const uint32_t tag = processTag(ep.hostname, ep.pid);
+            node_->reactor().addFd(
+                uds_raw->nativeFd(),
+                transport::IoReactor::Readable,
+                [this, uds_raw, tag](platform::socket_t fd, uint8_t)
+                {
+                    // Drain first: a hang-up may arrive together with the
+                    // publisher's last frames.
+                    uds_raw->onDataReady(
+                        [this, tag](const transport::FrameHeader &hdr,
+                                    const void *payload, uint32_t sz)
+                        {
+                            processNetFrame(hdr, payload, sz, tag);
+                        });
+                    if (!uds_raw->isConnected())
+                        node_->reactor().removeFd(fd); // stop level-triggered HUP spinning
+                });
+            node_->ioThread().start(); // no-op if already running
+            uds_peers_.push_back(UdsPeer{ep.net_endpoint, std::move(reader), {ep.endpoint_id}});
+            break;
+        }
         }
     }
 
@@ -491,16 +787,18 @@ namespace lux::communication
         case ChannelKind::Shm:
         {
             std::lock_guard lock(shm_mutex_);
-            std::erase_if(shm_peers_, [&](const ShmPeer &p)
-                          { return p.pub_pid == ep.pid; });
+            // The ring stays while other publishers of that process remain.
+            std::erase_if(shm_peers_, [&](ShmPeer &p)
+                          { return p.pub_pid == ep.pid && removePublisher(p.publishers, ep.endpoint_id); });
             break;
         }
         case ChannelKind::Net:
         {
             std::lock_guard lock(net_mutex_);
-            std::erase_if(net_peers_, [&](const NetPeer &p)
+            std::erase_if(net_peers_, [&](NetPeer &p)
                           {
             if (p.endpoint != ep.net_endpoint) return false;
+            if (!removePublisher(p.publishers, ep.endpoint_id)) return false;
             if (p.tcp && p.tcp->isConnected())
                 node_->reactor().removeFd(p.tcp->nativeFd());
             if (p.udp && p.udp->isValid())
@@ -508,6 +806,18 @@ namespace lux::communication
             return true; });
             break;
         }
+        case ChannelKind::Uds:
+        {
+            std::lock_guard lock(uds_mutex_);
+            std::erase_if(uds_peers_, [&](UdsPeer &p)
+                          {
+            if (p.endpoint != ep.net_endpoint) return false;
+            if (!removePublisher(p.publishers, ep.endpoint_id)) return false;
+            if (p.reader->isConnected())
+                node_->reactor().removeFd(p.reader->nativeFd());
+            return true; });
+            break;
+        }
         }
     }
 
@@ -516,36 +826,73 @@ namespace lux::communication
     template <typename T>
     void Subscriber<T>::enqueue(uint64_t seq, stored_msg_t<T> msg)
     {
+        auto *exec = executor();
+
         // Content filter — reject before enqueue to avoid Executor overhead.
+        // The seq was allocated for this subscriber: tell the executor it is
+        // consumed so SeqOrderedExecutor does not wait for it.
+        const uint64_t filter_ts = opts_.field_filter.minIntervalNs() ? platform::steadyNowNs() : 0;
+        bool accepted = true;
         if constexpr (SmallValueMsg<T>)
+            accepted = admit(msg, filter_ts);
+        else
+            accepted = admit(*msg, filter_ts);
+        if (!accepted)
         {
-            if (content_filter_ && !content_filter_(msg))
-                return;
+            if (exec && seq)
+                exec->seqConsumed(seq);
+            return;
         }
-        else
+
+        // Lazy timestamp: only call steadyNowNs() when lifespan QoS is active
+        // or the executor orders by publish time.
+        const uint64_t ts = (opts_.qos.lifespan.count() > 0 || (exec && exec->needsTimestamps()))
+                                ? platform::steadyNowNs()
+                                : 0;
+        pushItem(OrderedItem{seq, ts, std::move(msg)}, exec);
+
+        // Deadline tracking — reset timer on every received message.
+        if (opts_.qos.deadline.count() > 0)
         {
-            if (content_filter_ && !content_filter_(*msg))
-                return;
+            last_message_time_.store(std::chrono::steady_clock::now(),
+                                     std::memory_order_relaxed);
+            deadline_fired_.store(false, std::memory_order_relaxed);
         }
 
-        // Lazy timestamp: only call steadyNowNs() when lifespan QoS is active.
-        const uint64_t ts = (opts_.qos.lifespan.count() > 0)
+        notifyReady();
+    }
+
+    template <typename T>
+    void Subscriber<T>::enqueueBatch(uint64_t first_seq, std::span<const stored_msg_t<T>> msgs)
+    {
+        auto *exec = executor();
+
+        const uint64_t filter_ts = opts_.field_filter.minIntervalNs() ? platform::steadyNowNs() : 0;
+        const uint64_t ts = (opts_.qos.lifespan.count() > 0 || (exec && exec->needsTimestamps()))
                                 ? platform::steadyNowNs()
                                 : 0;
-        push_item(queue_, OrderedItem{seq, ts, std::move(msg)});
 
-        // KeepLast depth enforcement (approximate — ConcurrentQueue size is best-effort).
-        if (opts_.qos.history == History::KeepLast && opts_.qos.depth > 0)
+        size_t pushed = 0;
+        for (size_t i = 0; i < msgs.size(); ++i)
         {
-            while (queue_size_approx(queue_) > opts_.qos.depth)
+            const uint64_t seq = first_seq ? first_seq + i : 0;
+            bool accepted = true;
+            if constexpr (SmallValueMsg<T>)
+                accepted = admit(msgs[i], filter_ts);
+            else
+                accepted = admit(*msgs[i], filter_ts);
+            if (!accepted)
             {
-                OrderedItem discard;
-                if (!try_pop_item(queue_, discard))
-                    break;
+                if (exec && seq)
+                    exec->seqConsumed(seq);
+                continue;
             }
+            pushItem(OrderedItem{seq, ts, msgs[i]}, exec);
+            ++pushed;
         }
+        if (pushed == 0)
+            return;
 
-        // Deadline tracking — reset timer on every received message.
         if (opts_.qos.deadline.count() > 0)
         {
             last_message_time_.store(std::chrono::steady_clock::now(),
@@ -553,7 +900,7 @@ namespace lux::communication
             deadline_fired_.store(false, std::memory_order_relaxed);
         }
 
-        callbackGroup()->notify(this);
+        notifyReady();
     }
 
     // ── SHM poll (called by IoThread) ────────────────────────────────
@@ -626,6 +973,15 @@ namespace lux::communication
                         continue;
                     }
 
+                    if (raw_pool_)
+                    {
+                        pushRaw(remoteKey(*hdr, entry.process_tag), hdr->timestamp_ns,
+                                pool_data, desc->data_size);
+                        data_pool_->release(desc->ref_count_offset);
+                        entry.reader->releaseReadView();
+                        continue;
+                    }
+
                     stored_msg_t<T> msg_storage{};
                     T *raw_ptr;
                     if constexpr (SmallValueMsg<T>)
@@ -634,7 +990,7 @@ namespace lux::communication
                     }
                     else
                     {
-                        msg_storage = std::make_shared<T>();
+                        msg_storage = newMessage();
                         raw_ptr = msg_storage.get();
                     }
                     bool ok = Ser::deserialize(*raw_ptr, pool_data, desc->data_size);
@@ -644,36 +1000,11 @@ namespace lux::communication
                     if (ok)
                     {
                         // Content filter (Phase 6).
-                        if (content_filter_ && !content_filter_(*raw_ptr))
+                        if (!admit(*raw_ptr, hdr->timestamp_ns))
                             continue;
 
-                        uint64_t msg_seq = hdr->seq_num;
-                        if constexpr (is_msg_stamped<T>)
-                        {
-                            msg_seq = builtin_msgs::common_msgs::extract_timstamp(*raw_ptr);
-                        }
-                        push_item(queue_, OrderedItem{msg_seq, hdr->timestamp_ns, std::move(msg_storage)});
-
-                        // KeepLast depth enforcement.
-                        if (opts_.qos.history == History::KeepLast && opts_.qos.depth > 0)
-                        {
-                            while (queue_size_approx(queue_) > opts_.qos.depth)
-                            {
-                                OrderedItem discard;
-                                if (!try_pop_item(queue_, discard))
-                                    break;
-                            }
-                        }
-
-                        // Deadline tracking.
-                        if (opts_.qos.deadline.count() > 0)
-                        {
-                            last_message_time_.store(std::chrono::steady_clock::now(),
-                                                     std::memory_order_relaxed);
-                            deadline_fired_.store(false, std::memory_order_relaxed);
-                        }
-
-                        callbackGroup()->notify(this);
+                        pushRemote(remoteKey(*hdr, entry.process_tag), hdr->timestamp_ns,
+                                   std::move(msg_storage));
                     }
                     continue;
                 }
@@ -681,6 +1012,13 @@ namespace lux::communication
                 // ── Inline path ──
                 const char *payload =
                     static_cast<const char *>(view.data) + sizeof(transport::FrameHeader);
+                if (raw_pool_)
+                {
+                    pushRaw(remoteKey(*hdr, entry.process_tag), hdr->timestamp_ns,
+                            payload, hdr->payload_size);
+                    entry.reader->releaseReadView();
+                    continue;
+                }
                 stored_msg_t<T> msg_storage{};
                 T *raw_ptr;
                 if constexpr (SmallValueMsg<T>)
@@ -689,45 +1027,20 @@ namespace lux::communication
                 }
                 else
                 {
-                    msg_storage = std::make_shared<T>();
+                    msg_storage = newMessage();
                     raw_ptr = msg_storage.get();
                 }
                 if (Ser::deserialize(*raw_ptr, payload, hdr->payload_size))
                 {
                     // Content filter (Phase 6).
-                    if (content_filter_ && !content_filter_(*raw_ptr))
+                    if (!admit(*raw_ptr, hdr->timestamp_ns))
                     {
                         entry.reader->releaseReadView();
                         continue;
                     }
 
-                    uint64_t msg_seq = hdr->seq_num;
-                    if constexpr (is_msg_stamped<T>)
-                    {
-                        msg_seq = builtin_msgs::common_msgs::extract_timstamp(*raw_ptr);
-                    }
-                    push_item(queue_, OrderedItem{msg_seq, hdr->timestamp_ns, std::move(msg_storage)});
-
-                    // KeepLast depth enforcement.
-                    if (opts_.qos.history == History::KeepLast && opts_.qos.depth > 0)
-                    {
-                        while (queue_size_approx(queue_) > opts_.qos.depth)
-                        {
-                            OrderedItem discard;
-                            if (!try_pop_item(queue_, discard))
-                                break;
-                        }
-                    }
-
-                    // Deadline tracking.
-                    if (opts_.qos.deadline.count() > 0)
-                    {
-                        last_message_time_.store(std::chrono::steady_clock::now(),
-                                                 std::memory_order_relaxed);
-                        deadline_fired_.store(false, std::memory_order_relaxed);
-                    }
-
-                    callbackGroup()->notify(this);
+                    pushRemote(remoteKey(*hdr, entry.process_tag), hdr->timestamp_ns,
+                               std::move(msg_storage));
                 }
                 entry.reader->releaseReadView();
             }
@@ -758,7 +1071,8 @@ namespace lux::communication
 
     template <typename T>
     void Subscriber<T>::processNetFrame(const transport::FrameHeader &hdr,
-                                        const void *payload, uint32_t payload_size)
+                                        const void *payload, uint32_t payload_size,
+                                        uint32_t process_tag)
     {
         if constexpr (!serialization::HasSerializer<T>)
             return;
@@ -767,6 +1081,15 @@ namespace lux::communication
             if (!transport::isValidFrame(hdr))
                 return;
 
+            if (raw_pool_)
+            {
+                const uint64_t ts = (opts_.qos.lifespan.count() > 0)
+                                        ? platform::steadyNowNs()
+                                        : hdr.timestamp_ns;
+                pushRaw(remoteKey(hdr, process_tag), ts, payload, payload_size);
+                return;
+            }
+
             stored_msg_t<T> msg_storage{};
             T *raw_ptr;
             if constexpr (SmallValueMsg<T>)
@@ -775,48 +1098,47 @@ namespace lux::communication
             }
             else
             {
-                msg_storage = std::make_shared<T>();
+                msg_storage = newMessage();
                 raw_ptr = msg_storage.get();
             }
             if (!Ser::deserialize(*raw_ptr, payload, payload_size))
                 return;
 
             // Content filter.
-            if (content_filter_ && !content_filter_(*raw_ptr))
+            if (!admit(*raw_ptr, hdr.timestamp_ns))
                 return;
 
-            uint64_t msg_seq = hdr.seq_num;
-            if constexpr (is_msg_stamped<T>)
-            {
-                msg_seq = builtin_msgs::common_msgs::extract_timstamp(*raw_ptr);
-            }
-
             const uint64_t ts = (opts_.qos.lifespan.count() > 0)
                                     ? platform::steadyNowNs()
                                     : hdr.timestamp_ns;
-            push_item(queue_, OrderedItem{msg_seq, ts, std::move(msg_storage)});
+            pushRemote(remoteKey(hdr, process_tag), ts, std::move(msg_storage));
+        } // else (HasSerializer<T>)
+    }
 
-            // KeepLast depth enforcement.
-            if (opts_.qos.history == History::KeepLast && opts_.qos.depth > 0)
-            {
-                while (queue_size_approx(queue_) > opts_.qos.depth)
-                {
-                    OrderedItem discard;
-                    if (!try_pop_item(queue_, discard))
-                        break;
-                }
-            }
+    template <typename T>
+    void Subscriber<T>::pushRemote(OrderKey key, uint64_t timestamp_ns, stored_msg_t<T> msg)
+    {
+        OrderedItem item{key.stamp, timestamp_ns, std::move(msg)};
+        item.origin = key.origin;
+        if constexpr (is_msg_stamped<T>)
+        {
+            if constexpr (SmallValueMsg<T>)
+                item.seq = builtin_msgs::common_msgs::extract_timstamp(item.msg);
+            else
+                item.seq = builtin_msgs::common_msgs::extract_timstamp(*item.msg);
+            item.origin = 0;
+        }
+        pushItem(std::move(item));
 
-            // Deadline tracking.
-            if (opts_.qos.deadline.count() > 0)
-            {
-                last_message_time_.store(std::chrono::steady_clock::now(),
-                                         std::memory_order_relaxed);
-                deadline_fired_.store(false, std::memory_order_relaxed);
-            }
+        // Deadline tracking.
+        if (opts_.qos.deadline.count() > 0)
+        {
+            last_message_time_.store(std::chrono::steady_clock::now(),
+                                     std::memory_order_relaxed);
+            deadline_fired_.store(false, std::memory_order_relaxed);
+        }
 
-            callbackGroup()->notify(this);
-        } // else (HasSerializer<T>)
+        notifyReady();
     }
 
     template <typename T>
@@ -831,6 +1153,12 @@ namespace lux::communication
                 node_->reactor().removeFd(p.udp->nativeFd());
         }
         net_peers_.clear();
+
+        std::lock_guard uds_lock(uds_mutex_);
+        for (auto &p : uds_peers_)
+            if (p.reader->isConnected())
+                node_->reactor().removeFd(p.reader->nativeFd());
+        uds_peers_.clear();
     }
 
     // ── Executor interface ───────────────────────────────────────────
@@ -838,11 +1166,40 @@ namespace lux::communication
     template <typename T>
     void Subscriber<T>::takeAll()
     {
+        takeSome(std::numeric_limits<size_t>::max());
+    }
+
+    template <typename T>
+    void Subscriber<T>::takeSome(size_t max_count)
+    {
+        if (batch_callback_ && !waiter_.load(std::memory_order_acquire))
+        {
+            takeBatch(max_count);
+            return;
+        }
+
         OrderedItem item;
-        while (try_pop_item(queue_, item))
+        size_t n = 0;
+        CallbackProfiler *prof = profiler();
+        uint64_t clock_ns = 0; // end of the previous callback
+        while (n < max_count)
         {
-            if (shouldDiscard(item))
+            // An awaiting coroutine gets the message first; it may await
+            // again while resumed, re-arming waiter_ for the next one.
+            if (NextAwaiter *aw = takeAwaiter(item))
+            {
+                ++n;
+                aw->msg_ = std::move(item.msg);
+                aw->handle_.resume();
+                clock_ns = 0;
                 continue;
+            }
+            if (!callback_func_ || !popItem(item))
+                break;
+            if (shouldDiscard(item) || !materialize(item))
+                continue;
+            ++n;
+            CallbackProfiler::Scope scope(prof, this, item.timestamp_ns, clock_ns);
             if constexpr (SmallValueMsg<T>)
             {
                 callback_func_(item.msg); // const T&
@@ -854,54 +1211,145 @@ namespace lux::communication
         }
 
         clearReady();
-        if (queue_size_approx(queue_) > 0)
-            callbackGroup()->notify(this);
+        if (queuedApprox() > 0 && hasConsumer())
+            notifyReady();
     }
 
     template <typename T>
-    void Subscriber<T>::drainAll(std::vector<TimeExecEntry> &out)
+    void Subscriber<T>::takeBatch(size_t max_count)
     {
-        OrderedItem item;
-        while (try_pop_item(queue_, item))
+        static constexpr size_t kBulkSize = 256;
+        thread_local OrderedItem bulk_buffer[kBulkSize];
+
+        const size_t limit = opts_.max_batch_size ? opts_.max_batch_size : SIZE_MAX;
+        size_t total = 0;
+        while (total < max_count)
         {
-            if (shouldDiscard(item))
-                continue;
+            const size_t to_pop = std::min(kBulkSize, max_count - total);
+            const size_t count = popBulk(bulk_buffer, to_pop);
+            if (count == 0)
+                break;
 
-            if constexpr (SmallValueMsg<T>)
+            for (size_t i = 0; i < count; ++i)
             {
-                auto invoker = [this, m = item.msg]() mutable
+                if (!shouldDiscard(bulk_buffer[i]) && materialize(bulk_buffer[i]))
                 {
-                    this->callback_func_(m);
-                };
-                out.push_back(TimeExecEntry{item.seq, std::move(invoker)});
+                    if (batch_.empty())
+                        batch_since_ns_ = bulk_buffer[i].timestamp_ns;
+                    batch_.push_back(std::move(bulk_buffer[i].msg));
+                    if (batch_.size() >= limit)
+                        flushBatch();
+                }
+                if constexpr (!SmallValueMsg<T>)
+                {
+                    bulk_buffer[i].msg.reset();
+                    bulk_buffer[i].raw.reset();
+                }
             }
-            else
+            total += count;
+        }
+
+        // A partial batch waits for more messages, up to max_batch_wait.
+        if (!batch_.empty())
+        {
+            const auto wait_ns = static_cast<uint64_t>(opts_.max_batch_wait.count());
+            const uint64_t due = batch_due_ns_.load(std::memory_order_relaxed);
+            const uint64_t now = wait_ns ? platform::steadyNowNs() : 0;
+            if (wait_ns == 0 || (due != 0 && now >= due))
+                flushBatch();
+            else if (due == 0)
+                batch_due_ns_.store(now + wait_ns, std::memory_order_relaxed);
+        }
+
+        clearReady();
+        if (queuedApprox() > 0)
+            notifyReady();
+    }
+
+    template <typename T>
+    void Subscriber<T>::flushBatch()
+    {
+        {
+            // Queue wait of the oldest message in the span.
+            CallbackProfiler::Scope scope(profiler(), this, batch_since_ns_);
+            batch_callback_(std::span<const stored_msg_t<T>>(batch_.data(), batch_.size()));
+        }
+        batch_.clear();
+        batch_due_ns_.store(0, std::memory_order_relaxed);
+    }
+
+    template <typename T>
+    void Subscriber<T>::checkBatchWait()
+    {
+        // Runs on the IoThread: only re-schedule, the executor flushes.
+        const uint64_t due = batch_due_ns_.load(std::memory_order_relaxed);
+        if (due != 0 && platform::steadyNowNs() >= due)
+            notifyReady();
+    }
+
+    template <typename T>
+    void Subscriber<T>::drainAll(std::vector<TimeExecEntry> &out)
+    {
+        OrderedItem item;
+        if (NextAwaiter *aw = takeAwaiter(item))
+        {
+            auto &e = out.emplace_back();
+            e.timestamp_ns = item.timestamp_ns;
+            if constexpr (is_msg_stamped<T>)
             {
-                auto invoker = [this, m = std::move(item.msg)]() mutable
-                {
-                    this->callback_func_(std::move(m));
-                };
-                out.push_back(TimeExecEntry{item.seq, std::move(invoker)});
+                if constexpr (SmallValueMsg<T>)
+                    e.timestamp_ns = builtin_msgs::common_msgs::extract_timstamp(item.msg);
+                else
+                    e.timestamp_ns = builtin_msgs::common_msgs::extract_timstamp(*item.msg);
+            }
+            e.exec.template emplace<stored_msg_t<T>, &Subscriber<T>::resumeExec>(
+                e.timestamp_ns, aw, std::move(item.msg));
+        }
+
+        while ((callback_func_ || batch_callback_) && popItem(item))
+        {
+            if (shouldDiscard(item) || !materialize(item))
+                continue;
+
+            // Stamped messages order by their own stamp, others by publish time.
+            uint64_t ts = item.timestamp_ns;
+            if constexpr (is_msg_stamped<T>)
+            {
+                if constexpr (SmallValueMsg<T>)
+                    ts = builtin_msgs::common_msgs::extract_timstamp(item.msg);
+                else
+                    ts = builtin_msgs::common_msgs::extract_timstamp(*item.msg);
             }
+
+            auto &e = out.emplace_back();
+            e.timestamp_ns = ts;
+            e.exec.template emplace<stored_msg_t<T>, &Subscriber<T>::invokeExec>(
+                ts, this, std::move(item.msg));
         }
         clearReady();
-        if (queue_size_approx(queue_) > 0)
-            callbackGroup()->notify(this);
+        if (queuedApprox() > 0 && hasConsumer())
+            notifyReady();
     }
 
     template <typename T>
-    void Subscriber<T>::invokeTrampoline(void *obj, std::shared_ptr<void> msg)
+    void Subscriber<T>::invokeExec(void *obj, stored_msg_t<T> &msg)
     {
         auto *self = static_cast<Subscriber<T> *>(obj);
+        // Ordered executors keep no enqueue time: execution time only.
+        CallbackProfiler::Scope scope(self->profiler(), self, 0);
+        if (self->batch_callback_)
+        {
+            // Ordered executors release entries one by one.
+            self->batch_callback_(std::span<const stored_msg_t<T>>(&msg, 1));
+            return;
+        }
         if constexpr (SmallValueMsg<T>)
         {
-            auto *typed = static_cast<T *>(msg.get());
-            self->callback_func_(*typed); // const T&
+            self->callback_func_(msg); // const T&
         }
         else
         {
-            auto typed_msg = std::static_pointer_cast<T>(std::move(msg));
-            self->callback_func_(std::move(typed_msg));
+            self->callback_func_(std::move(msg)); // shared_ptr<T>
         }
     }
 
@@ -918,48 +1366,257 @@ namespace lux::communication
         thread_local OrderedItem bulk_buffer[kBulkSize];
 
         size_t total = 0;
-        while (total < max_count)
+        if (max_count > 0)
+        {
+            OrderedItem item;
+            if (NextAwaiter *aw = takeAwaiter(item))
+            {
+                auto &e = out.emplace_back();
+                e.template emplace<stored_msg_t<T>, &Subscriber<T>::resumeExec>(
+                    item.seq, aw, std::move(item.msg));
+                e.origin = item.origin;
+                ++total;
+            }
+        }
+
+        while (total < max_count && (callback_func_ || batch_callback_))
         {
             const size_t to_pop = std::min(kBulkSize, max_count - total);
-            const size_t count = try_pop_bulk(queue_, bulk_buffer, to_pop);
+            const size_t count = popBulk(bulk_buffer, to_pop);
             if (count == 0)
                 break;
 
             for (size_t i = 0; i < count; ++i)
             {
-                if (shouldDiscard(bulk_buffer[i]))
+                if (shouldDiscard(bulk_buffer[i]) || !materialize(bulk_buffer[i]))
                 {
+                    // Empty entry: marks the seq consumed for the reorder
+                    // buffer.  Remote messages hold no seq there.
+                    if (!bulk_buffer[i].origin)
+                        out.emplace_back().seq = bulk_buffer[i].seq;
                     if constexpr (!SmallValueMsg<T>)
+                    {
                         bulk_buffer[i].msg.reset();
+                        bulk_buffer[i].raw.reset();
+                    }
                     continue;
                 }
 
-                ExecEntry e;
-                e.seq = bulk_buffer[i].seq;
-                e.obj = this;
-                e.invoke = &Subscriber<T>::invokeTrampoline;
-                if constexpr (SmallValueMsg<T>)
-                {
-                    // Wrap value in shared_ptr for type-erased ExecEntry.
-                    e.msg = std::make_shared<T>(bulk_buffer[i].msg);
-                }
-                else
-                {
-                    e.msg = std::static_pointer_cast<void>(bulk_buffer[i].msg);
+                // Message is moved into the entry's inline storage (no allocation).
+                auto &e = out.emplace_back();
+                e.template emplace<stored_msg_t<T>, &Subscriber<T>::invokeExec>(
+                    bulk_buffer[i].seq, this, std::move(bulk_buffer[i].msg));
+                e.origin = bulk_buffer[i].origin;
+                if constexpr (!SmallValueMsg<T>)
                     bulk_buffer[i].msg.reset();
-                }
-                out.push_back(std::move(e));
             }
             total += count;
         }
 
         clearReady();
-        if (queue_size_approx(queue_) > 0)
-            callbackGroup()->notify(this);
+        if (queuedApprox() > 0 && hasConsumer())
+            notifyReady();
 
         return total;
     }
 
+    // ── Awaiting coroutine ───────────────────────────────────────────
+
+    template <typename T>
+    Subscriber<T>::NextAwaiter::~NextAwaiter()
+    {
+        // Disarm if the frame dies while still parked (e.g. destroyed task).
+        NextAwaiter *self = this;
+        sub_->waiter_.compare_exchange_strong(self, nullptr, std::memory_order_acq_rel);
+    }
+
+    template <typename T>
+    void Subscriber<T>::NextAwaiter::await_suspend(std::coroutine_handle<> handle)
+    {
+        handle_ = handle;
+        // The frame may be resumed on another thread as soon as waiter_ is
+        // published: only the local copy of sub_ is used afterwards.
+        Subscriber *sub = sub_;
+        sub->waiter_.store(this, std::memory_order_release);
+        // Pairs with the fence in hasConsumer(): either a take that found no
+        // consumer re-checks and sees us, or we see its queued message.
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (sub->queuedApprox() > 0)
+            sub->notifyReady();
+    }
+
+    template <typename T>
+    bool Subscriber<T>::popAccepted(stored_msg_t<T> &out)
+    {
+        OrderedItem item;
+        while (popItem(item))
+        {
+            if (shouldDiscard(item) || !materialize(item))
+            {
+                if (auto *exec = executor(); exec && item.seq && !item.origin)
+                    exec->seqConsumed(item.seq);
+                continue;
+            }
+            out = std::move(item.msg);
+            return true;
+        }
+        return false;
+    }
+
+    template <typename T>
+    typename Subscriber<T>::NextAwaiter *Subscriber<T>::takeAwaiter(OrderedItem &item)
+    {
+        if (!waiter_.load(std::memory_order_acquire))
+            return nullptr;
+        NextAwaiter *aw = waiter_.exchange(nullptr, std::memory_order_acq_rel);
+        if (!aw)
+            return nullptr;
+
+        while (popItem(item))
+        {
+            if (!shouldDiscard(item) && materialize(item))
+                return aw;
+            if (auto *exec = executor(); exec && item.seq && !item.origin)
+                exec->seqConsumed(item.seq);
+        }
+        // Nothing to hand over: the coroutine keeps waiting.
+        waiter_.store(aw, std::memory_order_release);
+        return nullptr;
+    }
+
+    template <typename T>
+    void Subscriber<T>::resumeExec(void *obj, stored_msg_t<T> &msg)
+    {
+        auto *aw = static_cast<NextAwaiter *>(obj);
+        aw->msg_ = std::move(msg);
+        aw->handle_.resume();
+    }
+
+    // ── Content filters ──────────────────────────────────────────────
+
+    template <typename T>
+    bool Subscriber<T>::admit(const T &msg, uint64_t ts_ns)
+    {
+        const auto &ff = opts_.field_filter;
+        if (!ff.matches(msg))
+            return false;
+        if (content_filter_ && !content_filter_(msg))
+            return false;
+        const uint64_t interval = ff.minIntervalNs();
+        if (interval == 0)
+            return true;
+        // Publishers already sampled with the same rule and timestamps, so
+        // this passes everything they sent unless intra-process messages
+        // or several subscribers share the stream.
+        uint64_t last = sample_last_ns_.load(std::memory_order_relaxed);
+        do
+        {
+            if (last != 0 && ts_ns < last + interval)
+                return false;
+        } while (!sample_last_ns_.compare_exchange_weak(last, ts_ns, std::memory_order_relaxed));
+        return true;
+    }
+
+    // ── Deferred deserialization ─────────────────────────────────────
+
+    template <typename T>
+    void Subscriber<T>::pushRaw(OrderKey key, uint64_t timestamp_ns, const void *data, size_t size)
+    {
+        if constexpr (!SmallValueMsg<T>)
+        {
+            // One copy out of the SHM slot / socket buffer; the recycled
+            // vector keeps its capacity, so this does not allocate.
+            auto raw = raw_pool_->acquire();
+            const auto *bytes = static_cast<const uint8_t *>(data);
+            raw->assign(bytes, bytes + size);
+
+            // Stamped messages get their seq from the stamp in materialize().
+            OrderedItem item{is_msg_stamped<T> ? 0 : key.stamp, timestamp_ns, nullptr};
+            item.raw = std::move(raw);
+            item.origin = is_msg_stamped<T> ? 0 : key.origin;
+            pushItem(std::move(item));
+
+            // Deadline tracking.
+            if (opts_.qos.deadline.count() > 0)
+            {
+                last_message_time_.store(std::chrono::steady_clock::now(),
+                                         std::memory_order_relaxed);
+                deadline_fired_.store(false, std::memory_order_relaxed);
+            }
+
+            notifyReady();
+        }
+    }
+
+    template <typename T>
+    bool Subscriber<T>::materialize(OrderedItem &item)
+    {
+        if constexpr (SmallValueMsg<T> || !serialization::HasSerializer<T>)
+        {
+            return true;
+        }
+        else
+        {
+            if (!item.raw)
+                return true;
+
+            auto raw = std::move(item.raw);
+            item.msg = newMessage();
+            if (!Ser::deserialize(*item.msg, raw->data(), raw->size()))
+                return false;
+            if (!admit(*item.msg, item.timestamp_ns))
+                return false;
+            if constexpr (is_msg_stamped<T>)
+                item.seq = builtin_msgs::common_msgs::extract_timstamp(*item.msg);
+            return true;
+        }
+    }
+
+    // ── Message queue ────────────────────────────────────────────────
+
+    template <typename T>
+    void Subscriber<T>::pushItem(OrderedItem item, ExecutorBase *exec)
+    {
+        if (!keep_last_)
+        {
+            push_item(queue_, std::move(item));
+            return;
+        }
+        keep_last_->push(std::move(item), [exec](OrderedItem &&evicted)
+                         {
+                             if (exec && evicted.seq && !evicted.origin)
+                                 exec->seqConsumed(evicted.seq);
+                         });
+    }
+
+    template <typename T>
+    bool Subscriber<T>::popItem(OrderedItem &out)
+    {
+        return keep_last_ ? keep_last_->tryPop(out) : try_pop_item(queue_, out);
+    }
+
+    template <typename T>
+    size_t Subscriber<T>::popBulk(OrderedItem *items, size_t max_count)
+    {
+        return keep_last_ ? keep_last_->tryPopBulk(items, max_count)
+                          : try_pop_bulk(queue_, items, max_count);
+    }
+
+    template <typename T>
+    size_t Subscriber<T>::queuedApprox()
+    {
+        return keep_last_ ? keep_last_->sizeApprox() : queue_size_approx(queue_);
+    }
+
+    template <typename T>
+    bool Subscriber<T>::hasConsumer() const
+    {
+        if (callback_func_ || batch_callback_)
+            return true;
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        return waiter_.load(std::memory_order_relaxed) != nullptr;
+    }
+
     // ── QoS helpers ──────────────────────────────────────────────────
 
     template <typename T>
@@ -35,7 +35,7 @@ struct DiscoveryPacket {
     uint64_t type_hash       = 0;
 
     uint32_t pid             = 0;
-    uint32_t reserved2       = 0;
+    uint32_t endpoint_id     = 0;      // announcer's handle; 0 from older senders
 
     char     topic_name[240]   = {};
     char     net_endpoint[128] = {};
@@ -43,7 +43,7 @@ struct DiscoveryPacket {
 
     uint64_t timestamp_ns    = 0;
 
-    char     padding[32]     = {};     // pad to 512 bytes
+    char     content_filter[32] = {};  // subscriber FieldFilter; zeros from older senders
 };
 #pragma pack(pop)
 
@@ -20,6 +20,7 @@ struct LookupFilter {
 
 struct LookupResult {
     uint32_t     pid;
+    uint32_t     endpoint_id;
     uint64_t     domain_id;
     std::string  topic_name;
     std::string  type_name;
@@ -28,6 +29,7 @@ struct LookupResult {
     std::string  shm_segment_name;
     std::string  net_endpoint;
     std::string  hostname;
+    std::string  content_filter;
 };
 
 // ──────── ShmRegistry ────────
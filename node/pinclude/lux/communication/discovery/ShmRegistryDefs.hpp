@@ -8,12 +8,13 @@ namespace lux::communication::discovery {
 // ──────── Constants ────────
 
 static constexpr uint32_t kShmRegistryMagic   = 0x4C555852; // "LUXR"
-static constexpr uint32_t kShmRegistryVersion = 1;
+static constexpr uint32_t kShmRegistryVersion = 2;
 
 static constexpr size_t kMaxTopicNameLen = 240;
 static constexpr size_t kMaxTypeNameLen  = 128;
 static constexpr size_t kMaxEndpointLen  = 128;
 static constexpr size_t kMaxHostnameLen  = 64;
+static constexpr size_t kMaxFilterLen    = 32;
 
 // ──────── Enums ────────
 
@@ -53,13 +54,16 @@ struct alignas(64) TopicEndpointEntry {
     // ── Endpoint ──
     uint8_t  role;                          // EndpointRole
     uint8_t  reserved1[3];
-    uint32_t reserved2;
+    uint32_t endpoint_id;                   // DiscoveryService handle
     char     shm_segment_name[kMaxEndpointLen];
     char     net_endpoint[kMaxEndpointLen];
     char     hostname[kMaxHostnameLen];
 
     // ── Liveness ──
     std::atomic<uint64_t> heartbeat_ns;     // steady_clock timestamp
+
+    // ── Subscriber content filter (version 2; former tail padding) ──
+    char content_filter[kMaxFilterLen];     // FieldFilter::encode(), "" = none
 };
 
 static_assert(sizeof(TopicEndpointEntry) % 64 == 0,
@@ -83,6 +87,7 @@ static_assert(sizeof(ShmRegistryHeader) == 32, "ShmRegistryHeader must be 32 byt
 /// Plain C++ struct used to pass data into ShmRegistry::announce().
 struct TopicEndpointInfo {
     uint32_t     pid              = 0;
+    uint32_t     endpoint_id      = 0;
     uint64_t     domain_id        = 0;
     uint64_t     topic_name_hash  = 0;
     uint64_t     type_hash        = 0;
@@ -92,6 +97,7 @@ struct TopicEndpointInfo {
     std::string  shm_segment_name;
     std::string  net_endpoint;
     std::string  hostname;
+    std::string  content_filter;
 };
 
 } // namespace lux::communication::discovery
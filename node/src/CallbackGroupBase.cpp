@@ -12,6 +12,27 @@ namespace lux::communication {
 
     CallbackGroupBase::~CallbackGroupBase()
     {
+        // Subscribers are owned by the node, which may outlive this group:
+        // detach the remaining ones so their destructors never reach back
+        // into it.
+        std::vector<SubscriberBase*> remaining;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            remaining = subscribers_.values();
+            for (auto* sub : remaining)
+                subscribers_.erase(sub->idInCallbackGroup());
+        }
+        for (auto* sub : remaining)
+        {
+            if (executor_)
+            {
+                sub->executorChanged(executor_, nullptr);
+                if (auto* prof = executor_->profiler())
+                    prof->forget(sub);
+            }
+            sub->setIdIInCallbackGroup(std::numeric_limits<size_t>::max());
+            sub->callback_group_.store(nullptr, std::memory_order_release);
+        }
         node_->removeCallbackGroup(this);
     }
 
@@ -20,6 +41,30 @@ namespace lux::communication {
         return type_;
     }
 
+    void CallbackGroupBase::setExecutor(ExecutorBase* executor)
+    {
+        ExecutorBase* old = executor_;
+        executor_ = executor;
+        if (old == executor)
+            return;
+
+        foreachSubscriber([&](SubscriberBase* sub)
+        {
+            // Timers re-arm on the new executor's timing wheel.
+            sub->executorChanged(old, executor);
+            if (executor)
+                executor->noteLatencyBudget(sub->latencyBudgetNs());
+
+            // A subscriber still flagged ready sits in the old executor's
+            // queue; hand it to the new one instead of leaving it muted.
+            if (executor && sub->ready_flag_.test(std::memory_order_acquire))
+            {
+                sub->clearReady();
+                notify(sub);
+            }
+        });
+    }
+
     void CallbackGroupBase::notify(SubscriberBase* sub)
     {
         // fast-path: if flag was clear, set it and enqueue once
@@ -30,6 +75,27 @@ namespace lux::communication {
         }
     }
 
+    void CallbackGroupBase::deferReady(SubscriberBase* sub)
+    {
+        std::lock_guard<std::mutex> lock(deferred_mutex_);
+        deferred_.push_back(sub);
+        deferred_count_.fetch_add(1, std::memory_order_seq_cst);
+    }
+
+    SubscriberBase* CallbackGroupBase::takeDeferred()
+    {
+        if (deferred_count_.load(std::memory_order_seq_cst) == 0)
+            return nullptr;
+
+        std::lock_guard<std::mutex> lock(deferred_mutex_);
+        if (deferred_.empty())
+            return nullptr;
+        auto* sub = deferred_.front();
+        deferred_.pop_front();
+        deferred_count_.fetch_sub(1, std::memory_order_seq_cst);
+        return sub;
+    }
+
     void CallbackGroupBase::addSubscriber(SubscriberBase* sub)
     {
         std::lock_guard<std::mutex> lock(mutex_);
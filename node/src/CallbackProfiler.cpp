@@ -0,0 +1,170 @@
+#include "lux/communication/CallbackProfiler.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace lux::communication
+{
+    namespace
+    {
+        std::atomic<uint64_t> g_next_profiler_id{1};
+
+        // Last shard this thread used: recording on one executor thread
+        // finds its shard without touching anything shared.
+        thread_local uint64_t tls_profiler_id = 0;
+        thread_local void*    tls_shard       = nullptr;
+    }
+
+    uint64_t DurationHistogram::quantileNs(double q) const
+    {
+        if (count == 0)
+            return 0;
+        const auto rank = static_cast<uint64_t>(std::ceil(std::clamp(q, 0.0, 1.0) * static_cast<double>(count)));
+        uint64_t seen = 0;
+        for (size_t i = 0; i < kBuckets; ++i)
+        {
+            seen += buckets[i];
+            if (seen >= rank && seen > 0)
+            {
+                const uint64_t upper = i + 1 < 64 ? (uint64_t{1} << (i + 1)) - 1 : UINT64_MAX;
+                return std::min(upper, max_ns);
+            }
+        }
+        return max_ns;
+    }
+
+    CallbackProfiler::CallbackProfiler(uint64_t budget_ns)
+        : id_(g_next_profiler_id.fetch_add(1, std::memory_order_relaxed)), budget_ns_(budget_ns)
+    {
+    }
+
+    CallbackProfiler::~CallbackProfiler() = default;
+
+    CallbackProfiler::Shard& CallbackProfiler::localShard()
+    {
+        if (tls_profiler_id == id_) [[likely]]
+            return *static_cast<Shard*>(tls_shard);
+
+        const auto self = std::this_thread::get_id();
+        std::lock_guard<std::mutex> lock(shards_mutex_);
+        Shard* shard = nullptr;
+        for (auto& s : shards_)
+        {
+            if (s->owner == self)
+            {
+                shard = s.get();
+                break;
+            }
+        }
+        if (!shard)
+        {
+            shards_.push_back(std::make_unique<Shard>());
+            shard        = shards_.back().get();
+            shard->owner = self;
+        }
+        tls_profiler_id = id_;
+        tls_shard       = shard;
+        return *shard;
+    }
+
+    void CallbackProfiler::record(const SubscriberBase* sub, uint64_t enqueue_ns,
+                                  uint64_t start_ns, uint64_t end_ns)
+    {
+        const uint64_t exec_ns   = end_ns > start_ns ? end_ns - start_ns : 0;
+        const uint64_t budget_ns = budget_ns_.load(std::memory_order_relaxed);
+        const bool     slow      = budget_ns > 0 && exec_ns > budget_ns;
+
+        Shard& shard = localShard();
+        {
+            std::lock_guard<std::mutex> lock(shard.mutex);
+            // A take runs one subscriber many times in a row.
+            if (!shard.last || shard.last->subscriber != sub)
+            {
+                shard.last             = &shard.stats[sub];
+                shard.last->subscriber = sub;
+            }
+            CallbackStats& s = *shard.last;
+            if (enqueue_ns != 0 && enqueue_ns <= start_ns)
+                s.queue_wait.record(start_ns - enqueue_ns);
+            s.exec.record(exec_ns);
+            if (slow)
+                ++s.over_budget;
+        }
+
+        if (slow && slow_handler_)
+            slow_handler_(sub, exec_ns);
+    }
+
+    std::vector<CallbackStats> CallbackProfiler::snapshot() const
+    {
+        std::unordered_map<const SubscriberBase*, CallbackStats> merged;
+        {
+            std::lock_guard<std::mutex> lock(shards_mutex_);
+            for (const auto& shard : shards_)
+            {
+                std::lock_guard<std::mutex> shard_lock(shard->mutex);
+                for (const auto& [sub, s] : shard->stats)
+                {
+                    CallbackStats& m = merged[sub];
+                    m.subscriber = sub;
+                    m.queue_wait.merge(s.queue_wait);
+                    m.exec.merge(s.exec);
+                    m.over_budget += s.over_budget;
+                }
+            }
+        }
+
+        std::vector<CallbackStats> out;
+        out.reserve(merged.size());
+        for (auto& [sub, s] : merged)
+            out.push_back(s);
+        return out;
+    }
+
+    CallbackStats CallbackProfiler::stats(const SubscriberBase* sub) const
+    {
+        CallbackStats out;
+        out.subscriber = sub;
+        std::lock_guard<std::mutex> lock(shards_mutex_);
+        for (const auto& shard : shards_)
+        {
+            std::lock_guard<std::mutex> shard_lock(shard->mutex);
+            auto it = shard->stats.find(sub);
+            if (it == shard->stats.end())
+                continue;
+            out.queue_wait.merge(it->second.queue_wait);
+            out.exec.merge(it->second.exec);
+            out.over_budget += it->second.over_budget;
+        }
+        return out;
+    }
+
+    size_t CallbackProfiler::threadCount() const
+    {
+        std::lock_guard<std::mutex> lock(shards_mutex_);
+        return shards_.size();
+    }
+
+    void CallbackProfiler::reset()
+    {
+        std::lock_guard<std::mutex> lock(shards_mutex_);
+        for (auto& shard : shards_)
+        {
+            std::lock_guard<std::mutex> shard_lock(shard->mutex);
+            shard->stats.clear();
+            shard->last = nullptr;
+        }
+    }
+
+    void CallbackProfiler::forget(const SubscriberBase* sub)
+    {
+        std::lock_guard<std::mutex> lock(shards_mutex_);
+        for (auto& shard : shards_)
+        {
+            std::lock_guard<std::mutex> shard_lock(shard->mutex);
+            shard->stats.erase(sub);
+            shard->last = nullptr;
+        }
+    }
+
+} // namespace lux::communication
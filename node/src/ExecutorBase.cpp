@@ -1,11 +1,27 @@
 #include "lux/communication/ExecutorBase.hpp"
 #include "lux/communication/NodeBase.hpp"
 #include "lux/communication/SubscriberBase.hpp"
+#include "lux/communication/Timer.hpp"
+#include "lux/communication/platform/PlatformDefs.hpp"
+
+#include <algorithm>
+#include <cstdio>
+#include <thread>
 
 namespace lux::communication 
 {  
-    ExecutorBase::ExecutorBase() : spinning_(false) {}
-    ExecutorBase::~ExecutorBase() { stop(); }
+    ExecutorBase::ExecutorBase()
+        : spinning_(false), timer_wheel_(platform::steadyNowNs())
+    {
+    }
+
+    ExecutorBase::~ExecutorBase()
+    {
+        stop();
+        // spin() may still be waking up on another thread.
+        while (in_spin_.load(std::memory_order_acquire))
+            std::this_thread::yield();
+    }
 
     void ExecutorBase::addNode(NodeBase* node)
     {
@@ -20,6 +36,7 @@ namespace lux::communication
         if (nodes_.erase(node->idInExecutor()))
         {
             node->setExecutor(std::numeric_limits<size_t>::max(), nullptr);
+            refreshLatencyBudget();
         }
     }
 
@@ -43,7 +60,289 @@ namespace lux::communication
 
     bool ExecutorBase::checkRunnable()
     {
-        return ready_queue_.size_approx() > 0;
+        return hasReady();
+    }
+
+    // ── Ready policy ────────────────────────────────────────────────
+
+    void ExecutorBase::takeReady(SubscriberBase* sub)
+    {
+        if (ready_policy_.load(std::memory_order_relaxed) == ReadyPolicy::Fifo)
+            sub->takeAll();
+        else
+            sub->takeSome(ready_batch_);
+    }
+
+    void ExecutorBase::stampReady(SubscriberBase* sub)
+    {
+        // Written before the enqueue publishes the subscriber; the ready flag
+        // keeps it out of the queue until its callbacks have been taken.
+        if (ready_policy_.load(std::memory_order_relaxed) == ReadyPolicy::EarliestDeadline)
+            sub->ready_since_ns_ = platform::steadyNowNs();
+    }
+
+    bool ExecutorBase::applyThreadOptions(size_t index, size_t count)
+    {
+        if (thread_opts_.empty())
+            return true;
+
+        std::string error;
+        if (platform::applyThreadOptions(thread_opts_, index, count, &error))
+            return true;
+
+        thread_option_errors_.fetch_add(1, std::memory_order_relaxed);
+        std::fprintf(stderr, "[Executor WARNING] thread %zu/%zu options not fully applied: %s\n",
+                     index, count, error.c_str());
+        return false;
+    }
+
+    // ── Profiling ───────────────────────────────────────────────────
+
+    void ExecutorBase::enableProfiling(std::chrono::nanoseconds budget)
+    {
+        const auto budget_ns = static_cast<uint64_t>(std::max<int64_t>(budget.count(), 0));
+        std::lock_guard<std::mutex> lock(profiler_mutex_);
+        if (!profiler_owner_)
+        {
+            profiler_owner_ = std::make_unique<CallbackProfiler>(budget_ns);
+            profiler_.store(profiler_owner_.get(), std::memory_order_release);
+        }
+        else
+        {
+            profiler_owner_->setBudgetNs(budget_ns);
+        }
+    }
+
+    // ── Waiting ─────────────────────────────────────────────────────
+
+    SubscriberBase* ExecutorBase::waitOneReady()
+    {
+        pollTimers();
+
+        SubscriberBase* sub = nullptr;
+        if (tryDequeueReady(sub))
+            return sub;
+
+        // Phase 1: user-space spin.  Producers see no waiter and skip the
+        // futex entirely.
+        const uint64_t start = platform::steadyNowNs();
+        if (spinWait([&] { return tryDequeueReady(sub); }, start))
+            return sub;
+
+        // Phase 2: announce the wait, re-check, then park until notified or
+        // the next timer expiry.  An enqueue racing with the announcement is
+        // caught by the re-check or bumps the key.
+        const EventCount::Key key = ready_ec_.prepareWait();
+        if (tryDequeueReady(sub) || !spinning_.load(std::memory_order_relaxed))
+        {
+            ready_ec_.cancelWait();
+            return sub;
+        }
+        (void)waitUntil(ready_ec_, key, UINT64_MAX);
+        pollTimers();
+        if (tryDequeueReady(sub) && sub)
+            recordWait(platform::steadyNowNs() - start);
+        return sub;
+    }
+
+    uint64_t ExecutorBase::spinWindowNs() const
+    {
+        switch (wait_policy_.load(std::memory_order_relaxed))
+        {
+        case WaitPolicy::BusySpin: return UINT64_MAX;
+        case WaitPolicy::ParkOnly: return 0;
+        default:                   break;
+        }
+
+        const uint64_t budget = min_latency_budget_ns_.load(std::memory_order_relaxed);
+        const uint64_t cap    = budget < kParkLatencyNs ? kTightSpinNs : kMaxSpinNs;
+        const uint64_t avg    = wait_avg_ns_.load(std::memory_order_relaxed);
+
+        // The next arrival is expected beyond any window we would spin:
+        // park almost at once instead of burning the whole cap.
+        if (avg > cap)
+            return kMinSpinNs;
+        return std::clamp(2 * avg, kMinSpinNs, cap);
+    }
+
+    void ExecutorBase::noteLatencyBudget(uint64_t budget_ns)
+    {
+        if (budget_ns == 0)
+            return;
+        uint64_t cur = min_latency_budget_ns_.load(std::memory_order_relaxed);
+        while (budget_ns < cur &&
+               !min_latency_budget_ns_.compare_exchange_weak(cur, budget_ns, std::memory_order_relaxed))
+        {
+        }
+    }
+
+    void ExecutorBase::refreshLatencyBudget()
+    {
+        uint64_t budget = UINT64_MAX;
+        for (NodeBase* node : nodes_.values())
+        {
+            node->foreachSubscriber([&](SubscriberBase* sub)
+            {
+                if (sub->latencyBudgetNs() > 0)
+                    budget = std::min(budget, sub->latencyBudgetNs());
+            });
+        }
+        min_latency_budget_ns_.store(budget, std::memory_order_relaxed);
+    }
+
+    SubscriberBase* ExecutorBase::waitOneReadyTimeout(std::chrono::nanoseconds timeout)
+    {
+        const uint64_t deadline = platform::steadyNowNs() + static_cast<uint64_t>(std::max<int64_t>(timeout.count(), 0));
+        pollTimers();
+        SubscriberBase* sub = nullptr;
+        if (tryDequeueReady(sub))
+            return sub;
+
+        const EventCount::Key key = ready_ec_.prepareWait();
+        if (tryDequeueReady(sub) || !spinning_.load(std::memory_order_relaxed))
+        {
+            ready_ec_.cancelWait();
+            return sub;
+        }
+        (void)waitUntil(ready_ec_, key, deadline);
+        pollTimers();
+        (void)tryDequeueReady(sub);
+        return sub;
+    }
+
+    bool ExecutorBase::waitUntil(EventCount& ec, EventCount::Key key, uint64_t deadline_ns)
+    {
+        // Wake a little ahead of a timer and let the spin phase meet the
+        // deadline: futex timeouts overshoot by tens of microseconds.
+        const uint64_t timer = next_timer_ns_.load(std::memory_order_acquire);
+        const uint64_t lead  = timer == UINT64_MAX ? UINT64_MAX
+                             : timer > kTimerLeadNs ? timer - kTimerLeadNs : 0;
+        return ec.commitWait(key, std::min(deadline_ns, lead));
+    }
+
+    // ── Timers ──────────────────────────────────────────────────────
+
+    void ExecutorBase::addTimer(Timer* timer)
+    {
+        bool earlier;
+        {
+            std::lock_guard<std::mutex> lock(timer_mutex_);
+            if (timer->isCanceled())
+                return;
+
+            // Bring an idle wheel up to date so the new entry lands at its
+            // real distance, not behind a stale current tick.
+            const uint64_t now = platform::steadyNowNs();
+            advanceTimers(now);
+
+            const uint64_t before = next_timer_ns_.load(std::memory_order_relaxed);
+            timer->wheel_entry_.expiry_ns = now + static_cast<uint64_t>(timer->period().count());
+            timer_wheel_.insert(timer->wheel_entry_);
+            next_timer_ns_.store(timer_wheel_.nextExpiry(), std::memory_order_release);
+            earlier = next_timer_ns_.load(std::memory_order_relaxed) < before;
+        }
+        // A thread blocked on the old deadline has to re-read it.
+        if (earlier && spinning_.load(std::memory_order_relaxed))
+            wakeForTimers();
+    }
+
+    void ExecutorBase::removeTimer(Timer* timer)
+    {
+        std::lock_guard<std::mutex> lock(timer_mutex_);
+        timer_wheel_.remove(timer->wheel_entry_);
+        next_timer_ns_.store(timer_wheel_.nextExpiry(), std::memory_order_release);
+    }
+
+    size_t ExecutorBase::timerCount() const
+    {
+        std::lock_guard<std::mutex> lock(timer_mutex_);
+        return timer_wheel_.size();
+    }
+
+    void ExecutorBase::expireTimers()
+    {
+        const uint64_t now = platform::steadyNowNs();
+        if (now < next_timer_ns_.load(std::memory_order_acquire))
+            return;
+
+        // Whoever holds the lock fires the due timers for everyone.
+        std::unique_lock<std::mutex> lock(timer_mutex_, std::try_to_lock);
+        if (!lock.owns_lock())
+            return;
+        advanceTimers(now);
+        next_timer_ns_.store(timer_wheel_.nextExpiry(), std::memory_order_release);
+    }
+
+    void ExecutorBase::advanceTimers(uint64_t now_ns)
+    {
+        expired_timers_.clear();
+        timer_wheel_.advance(now_ns, expired_timers_);
+        for (auto* entry : expired_timers_)
+        {
+            auto* timer = static_cast<Timer*>(entry->owner);
+            timer->expire(entry->expiry_ns, now_ns); // sets the next expiry
+            timer_wheel_.insert(*entry);
+        }
+    }
+
+    bool ExecutorBase::tryDequeuePrioritized(SubscriberBase*& out)
+    {
+        // Min-heap on (deadline, rank, order); std heap functions build a
+        // max-heap, so the comparator is inverted.
+        static constexpr auto later = [](const ReadyEntry& a, const ReadyEntry& b)
+        {
+            if (a.deadline != b.deadline) return a.deadline > b.deadline;
+            if (a.rank != b.rank)         return a.rank > b.rank;
+            return a.order > b.order;
+        };
+
+        const bool edf =
+            ready_policy_.load(std::memory_order_relaxed) == ReadyPolicy::EarliestDeadline;
+
+        std::lock_guard<std::mutex> lock(ready_heap_mutex_);
+
+        // Move everything published since the last call into the heap.
+        SubscriberBase* batch[64];
+        size_t n;
+        bool   token = false;
+        while ((n = ready_queue_.try_dequeue_bulk(batch, std::size(batch))) > 0)
+        {
+            for (size_t i = 0; i < n; ++i)
+            {
+                SubscriberBase* sub = batch[i];
+                if (!sub)
+                {
+                    token = true; // wakeup() token
+                    continue;
+                }
+
+                ReadyEntry e;
+                e.sub   = sub;
+                e.order = ready_order_++;
+                // A subscriber queued just before its group died keeps its own.
+                const auto* group = sub->callbackGroup();
+                e.rank  = -static_cast<int64_t>(
+                    group ? std::max(sub->priority(), group->priority()) : sub->priority());
+                e.deadline = (edf && sub->relativeDeadlineNs() > 0)
+                                 ? sub->ready_since_ns_ + sub->relativeDeadlineNs()
+                                 : UINT64_MAX;
+                ready_heap_.push_back(e);
+                std::push_heap(ready_heap_.begin(), ready_heap_.end(), later);
+            }
+        }
+
+        if (ready_heap_.empty())
+        {
+            // A wake-up token still ends the caller's wait.
+            out = nullptr;
+            return token;
+        }
+
+        std::pop_heap(ready_heap_.begin(), ready_heap_.end(), later);
+        out = ready_heap_.back().sub;
+        ready_heap_.pop_back();
+        ready_heap_size_.store(ready_heap_.size(), std::memory_order_relaxed);
+        return true;
     }
 
 } // namespace lux::communication
@@ -0,0 +1,218 @@
+#include "lux/communication/FieldFilter.hpp"
+
+#include <charconv>
+
+namespace lux::communication
+{
+    namespace
+    {
+        // Type codes after the offset, as in Python's struct module.
+        constexpr char kTypeCodes[] = {'b', 'B', 'h', 'H', 'i', 'I', 'q', 'Q', 'f', 'd'};
+
+        const char *opText(CompareOp op)
+        {
+            switch (op)
+            {
+            case CompareOp::Eq: return "==";
+            case CompareOp::Ne: return "!=";
+            case CompareOp::Lt: return "<";
+            case CompareOp::Le: return "<=";
+            case CompareOp::Gt: return ">";
+            case CompareOp::Ge: return ">=";
+            }
+            return "==";
+        }
+
+        bool isNameChar(char c)
+        {
+            return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') ||
+                   (c >= '0' && c <= '9') || c == '_' || c == '.';
+        }
+
+        /// Consume a comparison operator from the front of `s`.
+        bool parseOp(std::string_view &s, CompareOp &op)
+        {
+            if (s.size() >= 2 && s[1] == '=')
+            {
+                switch (s[0])
+                {
+                case '=': op = CompareOp::Eq; break;
+                case '!': op = CompareOp::Ne; break;
+                case '<': op = CompareOp::Le; break;
+                case '>': op = CompareOp::Ge; break;
+                default:  return false;
+                }
+                s.remove_prefix(2);
+                return true;
+            }
+            if (s.empty() || (s[0] != '<' && s[0] != '>'))
+                return false;
+            op = s[0] == '<' ? CompareOp::Lt : CompareOp::Gt;
+            s.remove_prefix(1);
+            return true;
+        }
+
+        /// Parse all of `s` as a number.
+        template <typename V>
+        bool parseNumber(std::string_view s, V &out)
+        {
+            const auto [end, ec] = std::from_chars(s.data(), s.data() + s.size(), out);
+            return ec == std::errc{} && end == s.data() + s.size();
+        }
+
+        template <typename V>
+        void appendNumber(std::string &out, V value)
+        {
+            char buf[32];
+            const auto [end, ec] = std::to_chars(buf, buf + sizeof(buf), value);
+            out.append(buf, ec == std::errc{} ? end : buf);
+        }
+
+        bool parsePredicate(std::string_view s, FieldFilter::Predicate &p)
+        {
+            if (s.front() != '@')
+            {
+                size_t n = 0;
+                while (n < s.size() && isNameChar(s[n]))
+                    ++n;
+                if (n == 0)
+                    return false;
+                p.name = std::string(s.substr(0, n));
+                s.remove_prefix(n);
+                return parseOp(s, p.op) && parseNumber(s, p.real_value);
+            }
+
+            s.remove_prefix(1);
+            size_t n = 0;
+            while (n < s.size() && s[n] >= '0' && s[n] <= '9')
+                ++n;
+            if (!parseNumber(s.substr(0, n), p.offset) || n == s.size())
+                return false;
+            const char code = s[n];
+            s.remove_prefix(n + 1);
+
+            size_t t = 0;
+            while (t < sizeof(kTypeCodes) && kTypeCodes[t] != code)
+                ++t;
+            if (t == sizeof(kTypeCodes))
+                return false;
+            p.type = static_cast<FieldType>(t);
+
+            if (!parseOp(s, p.op))
+                return false;
+            switch (p.type)
+            {
+            case FieldType::F32:
+            {
+                float f = 0;
+                if (!parseNumber(s, f))
+                    return false;
+                p.real_value = f;
+                return true;
+            }
+            case FieldType::F64:
+                return parseNumber(s, p.real_value);
+            case FieldType::U8:
+            case FieldType::U16:
+            case FieldType::U32:
+            case FieldType::U64:
+                return parseNumber(s, p.uint_value);
+            default:
+                return parseNumber(s, p.int_value);
+            }
+        }
+    } // namespace
+
+    FieldFilter &FieldFilter::where(std::string name, CompareOp op, double value)
+    {
+        Predicate p;
+        p.name = std::move(name);
+        p.op = op;
+        p.real_value = value;
+        predicates_.push_back(std::move(p));
+        return *this;
+    }
+
+    std::string FieldFilter::encode() const
+    {
+        std::string out;
+        for (const auto &p : predicates_)
+        {
+            if (!out.empty())
+                out += ',';
+            if (p.name.empty())
+            {
+                out += '@';
+                appendNumber(out, p.offset);
+                out += kTypeCodes[static_cast<size_t>(p.type)];
+                out += opText(p.op);
+                switch (p.type)
+                {
+                case FieldType::F32:
+                    appendNumber(out, static_cast<float>(p.real_value));
+                    break;
+                case FieldType::F64:
+                    appendNumber(out, p.real_value);
+                    break;
+                case FieldType::U8:
+                case FieldType::U16:
+                case FieldType::U32:
+                case FieldType::U64:
+                    appendNumber(out, p.uint_value);
+                    break;
+                default:
+                    appendNumber(out, p.int_value);
+                    break;
+                }
+            }
+            else
+            {
+                for (char c : p.name)
+                {
+                    if (!isNameChar(c))
+                        return {};
+                }
+                out += p.name;
+                out += opText(p.op);
+                appendNumber(out, p.real_value);
+            }
+        }
+        if (interval_ns_ != 0)
+        {
+            if (!out.empty())
+                out += ',';
+            out += '~';
+            appendNumber(out, interval_ns_);
+        }
+        if (out.size() > kMaxEncodedSize)
+            return {};
+        return out;
+    }
+
+    bool FieldFilter::decode(std::string_view text, FieldFilter &out)
+    {
+        FieldFilter filter;
+        while (!text.empty())
+        {
+            const size_t comma = text.find(',');
+            const std::string_view item = text.substr(0, comma);
+            text = comma == std::string_view::npos ? std::string_view{} : text.substr(comma + 1);
+
+            if (item.empty())
+                return false;
+            if (item.front() == '~')
+            {
+                if (!parseNumber(item.substr(1), filter.interval_ns_))
+                    return false;
+                continue;
+            }
+            Predicate p;
+            if (!parsePredicate(item, p))
+                return false;
+            filter.predicates_.push_back(std::move(p));
+        }
+        out = std::move(filter);
+        return true;
+    }
+
+} // namespace lux::communication
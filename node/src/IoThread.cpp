@@ -1,4 +1,7 @@
 #include "lux/communication/IoThread.hpp"
+#include "lux/communication/platform/PlatformDefs.hpp"
+
+#include <cstdio>
 
 namespace lux::communication
 {
@@ -57,6 +60,17 @@ namespace lux::communication
     {
         using namespace std::chrono;
 
+        if (!opts_.io_thread.empty())
+        {
+            std::string error;
+            if (!platform::applyThreadOptions(opts_.io_thread, 0, 1, &error))
+            {
+                thread_opts_failed_.store(true, std::memory_order_relaxed);
+                std::fprintf(stderr, "[IoThread WARNING] thread options not fully applied: %s\n",
+                             error.c_str());
+            }
+        }
+
         while (running_.load(std::memory_order_relaxed))
         {
             // 1. Drive the network reactor (non-blocking or short timeout).
@@ -2,6 +2,7 @@
 #include "lux/communication/CallbackGroupBase.hpp"
 #include "lux/communication/TopicBase.hpp"
 #include "lux/communication/NodeBase.hpp"
+#include "lux/communication/ExecutorBase.hpp"
 
 namespace lux::communication 
 {
@@ -10,13 +11,47 @@ namespace lux::communication
     {
         node_->addSubscriber(this);
         if (topic_) topic_->addSubscriber(this);
-        callback_group_->addSubscriber(this);
+        cgb->addSubscriber(this);
     }
 
     SubscriberBase::~SubscriberBase()
     {
-        callback_group_->removeSubscriber(this);
+        // callback_group_ is null once the group was destroyed first.
+        if (auto* prof = profiler())
+            prof->forget(this);
+        if (auto* group = callbackGroup())
+            group->removeSubscriber(this);
         if (topic_) topic_->removeSubscriber(this);
         node_->removeSubscriber(this);
     }
+
+    ExecutorBase* SubscriberBase::executor() const
+    {
+        auto* group = callback_group_.load(std::memory_order_acquire);
+        return group ? group->executor() : nullptr;
+    }
+
+    CallbackProfiler* SubscriberBase::profiler() const
+    {
+        auto* ex = executor();
+        return ex ? ex->profiler() : nullptr;
+    }
+
+    void SubscriberBase::notifyReady()
+    {
+        if (auto* group = callback_group_.load(std::memory_order_acquire))
+            group->notify(this);
+    }
+
+    void SubscriberBase::setSchedulingHints(int32_t priority, uint64_t relative_deadline_ns,
+                                            uint64_t latency_budget_ns)
+    {
+        priority_             = priority;
+        relative_deadline_ns_ = relative_deadline_ns;
+        latency_budget_ns_    = latency_budget_ns;
+        // Subscribers created later than addNode(); the others are reported
+        // when their group is attached.
+        if (auto* ex = executor())
+            ex->noteLatencyBudget(latency_budget_ns);
+    }
 } // namespace lux::communication
@@ -0,0 +1,172 @@
+#include "lux/communication/TimeMergeQueue.hpp"
+#include "lux/communication/platform/PlatformDefs.hpp"
+
+#include <algorithm>
+
+namespace lux::communication
+{
+    namespace
+    {
+        // Min-heap on (head timestamp, origin) (std heap functions build
+        // max-heaps).
+        struct LaterHead
+        {
+            template<typename S>
+            bool operator()(const S* a, const S* b) const
+            {
+                if (a->headTs() != b->headTs())
+                    return a->headTs() > b->headTs();
+                return a->origin > b->origin;
+            }
+        };
+    }
+
+    TimeMergeQueue::TimeMergeQueue(std::chrono::nanoseconds idle_timeout)
+        : idle_timeout_(idle_timeout)
+    {
+    }
+
+    // ── Sources ──
+
+    TimeMergeQueue::Source& TimeMergeQueue::sourceFor(SubscriberBase* sub, uint64_t origin)
+    {
+        // Few sources per merge: a linear scan beats hashing.
+        for (auto& s : sources_)
+        {
+            if (s->sub == sub && s->origin == origin)
+                return *s;
+        }
+        const uint64_t now = platform::steadyNowNs();
+        if (now - last_prune_ns_ >= kSourceExpiryNs)
+            pruneSources(now);
+        sources_.push_back(std::make_unique<Source>());
+        sources_.back()->sub    = sub;
+        sources_.back()->origin = origin;
+        return *sources_.back();
+    }
+
+    TimeMergeQueue::Source& TimeMergeQueue::runFor(SubscriberBase* sub, uint64_t origin)
+    {
+        Source& src = sourceFor(sub, origin);
+
+        // Reclaim the consumed prefix before appending.
+        if (src.empty())
+        {
+            src.run.clear();
+            src.head = 0;
+        }
+        else if (src.head > src.run.size() / 2)
+        {
+            src.run.erase(src.run.begin(), src.run.begin() + static_cast<std::ptrdiff_t>(src.head));
+            src.head = 0;
+        }
+        return src;
+    }
+
+    void TimeMergeQueue::pruneSources(uint64_t now)
+    {
+        last_prune_ns_ = now;
+        std::erase_if(sources_, [now](const std::unique_ptr<Source>& s)
+        {
+            return s->empty() && now - s->last_arrival_ns >= kSourceExpiryNs;
+        });
+    }
+
+    void TimeMergeQueue::append(SubscriberBase* sub, std::vector<TimeExecEntry>& entries)
+    {
+        if (entries.empty())
+            return;
+
+        const uint64_t now = platform::steadyNowNs();
+        Source* src = nullptr;
+        for (auto& e : entries)
+        {
+            if (!src || src->origin != e.exec.origin)
+            {
+                src = &runFor(sub, e.exec.origin);
+                src->last_arrival_ns = now;
+            }
+
+            // A subscriber fed by several publishers can interleave slightly;
+            // clamp so the run stays sorted while keeping arrival order.
+            if (e.timestamp_ns < src->last_ts)
+                e.timestamp_ns = src->last_ts;
+            else
+                src->last_ts = e.timestamp_ns;
+            src->run.push_back(std::move(e));
+        }
+        pending_ += entries.size();
+    }
+
+    // ── Merge ──
+
+    uint64_t TimeMergeQueue::release()
+    {
+        if (pending_ == 0)
+            return 0;
+
+        const uint64_t now = platform::steadyNowNs();
+        const auto idle_ns = static_cast<uint64_t>(idle_timeout_.count());
+        auto active = [now, idle_ns](const Source& s)
+        {
+            return now - s.last_arrival_ns < idle_ns;
+        };
+
+        // Watermark: nothing newer than the oldest position of an empty but
+        // still active source may run yet.
+        uint64_t hold = UINT64_MAX;
+        merge_heap_.clear();
+        for (auto& sp : sources_)
+        {
+            Source& s = *sp;
+            if (!s.empty())
+                merge_heap_.push_back(&s);
+            else if (active(s))
+                hold = std::min(hold, s.last_ts);
+        }
+        std::make_heap(merge_heap_.begin(), merge_heap_.end(), LaterHead{});
+
+        while (!merge_heap_.empty())
+        {
+            Source* s = merge_heap_.front();
+            const uint64_t ts = s->headTs();
+            if (ts > hold)
+                break;
+
+            std::pop_heap(merge_heap_.begin(), merge_heap_.end(), LaterHead{});
+            merge_heap_.pop_back();
+
+            if (ts < last_released_ts_)
+                ++late_count_;
+            else
+                last_released_ts_ = ts;
+
+            s->run[s->head].exec.execute();
+            ++s->head;
+            --pending_;
+
+            if (!s->empty())
+            {
+                merge_heap_.push_back(s);
+                std::push_heap(merge_heap_.begin(), merge_heap_.end(), LaterHead{});
+            }
+            else if (active(*s))
+            {
+                hold = std::min(hold, s->last_ts);
+            }
+        }
+
+        if (pending_ == 0)
+            return 0;
+
+        // Entries are held back: wake up when the first waiting source idles.
+        uint64_t wake_at = UINT64_MAX;
+        for (auto& sp : sources_)
+        {
+            if (sp->empty() && active(*sp))
+                wake_at = std::min(wake_at, sp->last_arrival_ns + idle_ns);
+        }
+        return wake_at == UINT64_MAX ? 0 : wake_at;
+    }
+
+} // namespace lux::communication
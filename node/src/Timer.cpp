@@ -0,0 +1,107 @@
+#include "lux/communication/Timer.hpp"
+#include "lux/communication/CallbackGroupBase.hpp"
+#include "lux/communication/ExecutorBase.hpp"
+
+namespace lux::communication
+{
+    Timer::Timer(NodeBase* node, std::chrono::nanoseconds period, Callback callback,
+                 CallbackGroupBase* cbg)
+        : SubscriberBase(nullptr, node, cbg),
+          period_(period.count() > 0 ? period : std::chrono::nanoseconds(1)),
+          callback_(std::move(callback))
+    {
+        wheel_entry_.owner = this;
+        // Groups already attached to an executor start the timer now; the
+        // others start it when their node is added (executorChanged()).
+        if (auto* ex = executor())
+            ex->addTimer(this);
+    }
+
+    Timer::~Timer()
+    {
+        canceled_.store(true, std::memory_order_relaxed);
+        if (auto* ex = executor())
+            ex->removeTimer(this);
+    }
+
+    void Timer::cancel()
+    {
+        canceled_.store(true, std::memory_order_relaxed);
+        if (auto* ex = executor())
+            ex->removeTimer(this);
+        pending_.store(0, std::memory_order_relaxed);
+    }
+
+    void Timer::reset()
+    {
+        canceled_.store(false, std::memory_order_relaxed);
+        if (auto* ex = executor())
+            ex->addTimer(this);
+    }
+
+    void Timer::executorChanged(ExecutorBase* old_executor, ExecutorBase* new_executor)
+    {
+        if (old_executor)
+            old_executor->removeTimer(this);
+        if (new_executor)
+            new_executor->addTimer(this);
+    }
+
+    void Timer::expire(uint64_t expiry_ns, uint64_t now_ns)
+    {
+        const auto period = static_cast<uint64_t>(period_.count());
+
+        // Keep the original phase; periods that passed entirely while the
+        // executor was busy are skipped rather than replayed.
+        uint64_t due = expiry_ns;
+        if (now_ns >= due + period)
+        {
+            const uint64_t missed = (now_ns - due) / period;
+            overruns_.fetch_add(missed, std::memory_order_relaxed);
+            due += missed * period;
+        }
+        wheel_entry_.expiry_ns = due + period;
+
+        due_ns_.store(due, std::memory_order_relaxed);
+        pending_.fetch_add(1, std::memory_order_release);
+        notifyReady();
+    }
+
+    void Timer::takeAll()
+    {
+        const uint64_t n = pending_.exchange(0, std::memory_order_acquire);
+        if (n > 0 && !canceled_.load(std::memory_order_relaxed))
+        {
+            if (n > 1)
+                overruns_.fetch_add(n - 1, std::memory_order_relaxed);
+            const uint64_t due = due_ns_.load(std::memory_order_relaxed);
+            scheduled_ns_.store(due, std::memory_order_relaxed);
+            // Queue wait of a timer: due time to callback start.
+            CallbackProfiler::Scope scope(callback_ ? profiler() : nullptr, this, due);
+            if (callback_)
+                callback_();
+        }
+
+        clearReady();
+        // An expiry that raced with the clear above must not be lost.
+        if (pending_.load(std::memory_order_acquire) > 0)
+            notifyReady();
+    }
+
+    void Timer::drainAll(std::vector<TimeExecEntry>& /*out*/)
+    {
+        takeAll();
+    }
+
+    void Timer::drainAllExec(std::vector<ExecEntry>& /*out*/)
+    {
+        takeAll();
+    }
+
+    size_t Timer::drainExecSome(std::vector<ExecEntry>& /*out*/, size_t /*max_count*/)
+    {
+        takeAll();
+        return 0;
+    }
+
+} // namespace lux::communication
@@ -0,0 +1,200 @@
+#include "lux/communication/TimerWheel.hpp"
+
+#include <algorithm>
+#include <bit>
+
+namespace lux::communication
+{
+    namespace
+    {
+        constexpr uint64_t kSlotMask = TimerWheel::kSlots - 1;
+
+        constexpr uint32_t levelShift(uint32_t level)
+        {
+            return TimerWheel::kSlotBits * level;
+        }
+    }
+
+    TimerWheel::TimerWheel(uint64_t now_ns)
+        : current_tick_(now_ns >> kTickShift)
+    {
+    }
+
+    // ── Links ──
+
+    void TimerWheel::link(Entry& e, uint8_t level, uint8_t slot)
+    {
+        Entry*& head = slots_[level][slot];
+        e.prev_  = nullptr;
+        e.next_  = head;
+        if (head)
+            head->prev_ = &e;
+        head     = &e;
+        e.level_ = level;
+        e.slot_  = slot;
+        occupied_[level] |= uint64_t{1} << slot;
+        ++size_;
+    }
+
+    void TimerWheel::unlink(Entry& e)
+    {
+        if (e.prev_)
+            e.prev_->next_ = e.next_;
+        else
+            slots_[e.level_][e.slot_] = e.next_;
+        if (e.next_)
+            e.next_->prev_ = e.prev_;
+        if (!slots_[e.level_][e.slot_])
+            occupied_[e.level_] &= ~(uint64_t{1} << e.slot_);
+        e.prev_  = nullptr;
+        e.next_  = nullptr;
+        e.level_ = kUnlinked;
+        --size_;
+    }
+
+    void TimerWheel::place(Entry& e)
+    {
+        // Already expired entries run on the current tick.
+        uint64_t tick = std::max(e.expiry_ns >> kTickShift, current_tick_);
+        uint64_t delta = tick - current_tick_;
+
+        uint32_t level = 0;
+        while (level + 1 < kLevels && delta >= (uint64_t{1} << levelShift(level + 1)))
+            ++level;
+
+        // Beyond the top wheel: park in its farthest slot and re-place on cascade.
+        constexpr uint64_t kSpan = uint64_t{1} << levelShift(kLevels);
+        if (delta >= kSpan)
+            tick = current_tick_ + kSpan - 1;
+
+        link(e, static_cast<uint8_t>(level),
+             static_cast<uint8_t>((tick >> levelShift(level)) & kSlotMask));
+    }
+
+    void TimerWheel::insert(Entry& e)
+    {
+        if (e.linked())
+            unlink(e);
+        place(e);
+    }
+
+    void TimerWheel::remove(Entry& e)
+    {
+        if (e.linked())
+            unlink(e);
+    }
+
+    // ── Advance ──
+
+    void TimerWheel::cascade(uint32_t level, uint32_t slot)
+    {
+        Entry* list = slots_[level][slot];
+        if (!list)
+            return;
+        slots_[level][slot] = nullptr;
+        occupied_[level] &= ~(uint64_t{1} << slot);
+
+        while (list)
+        {
+            Entry* e = list;
+            list = e->next_;
+            e->level_ = kUnlinked;
+            --size_;
+            place(*e);
+        }
+    }
+
+    void TimerWheel::advance(uint64_t now_ns, std::vector<Entry*>& expired)
+    {
+        const uint64_t target = now_ns >> kTickShift;
+        if (size_ == 0)
+        {
+            current_tick_ = std::max(current_tick_, target);
+            return;
+        }
+
+        for (;;)
+        {
+            // Fire the current slot.  Before the target tick every entry in
+            // it has expired; on the target tick some may still be pending.
+            const uint32_t idx = static_cast<uint32_t>(current_tick_ & kSlotMask);
+            if (Entry* list = slots_[0][idx])
+            {
+                slots_[0][idx] = nullptr;
+                occupied_[0] &= ~(uint64_t{1} << idx);
+                while (list)
+                {
+                    Entry* e = list;
+                    list = e->next_;
+                    e->prev_  = nullptr;
+                    e->next_  = nullptr;
+                    e->level_ = kUnlinked;
+                    --size_;
+                    if (e->expiry_ns <= now_ns)
+                        expired.push_back(e);
+                    else
+                        place(*e);
+                }
+            }
+
+            if (current_tick_ >= target)
+                break;
+            if (size_ == 0)
+            {
+                current_tick_ = target;
+                break;
+            }
+
+            // Skip to the next occupied slot of this rotation, or to the
+            // wheel boundary where the upper levels cascade.
+            const uint64_t later = idx + 1 < kSlots ? occupied_[0] & (~uint64_t{0} << (idx + 1)) : 0;
+            uint64_t next = later
+                ? (current_tick_ & ~kSlotMask) + static_cast<uint64_t>(std::countr_zero(later))
+                : (current_tick_ | kSlotMask) + 1;
+            current_tick_ = std::min(next, target);
+
+            if ((current_tick_ & kSlotMask) == 0)
+            {
+                for (uint32_t level = 1; level < kLevels; ++level)
+                {
+                    const auto slot = static_cast<uint32_t>((current_tick_ >> levelShift(level)) & kSlotMask);
+                    cascade(level, slot);
+                    if (slot != 0)
+                        break;
+                }
+            }
+        }
+    }
+
+    uint64_t TimerWheel::nextExpiry() const
+    {
+        if (size_ == 0)
+            return UINT64_MAX;
+
+        uint64_t best = UINT64_MAX;
+
+        // Lowest wheel: exact expiry of the first occupied slot from now.
+        if (occupied_[0])
+        {
+            const auto idx = static_cast<int>(current_tick_ & kSlotMask);
+            const int dist = std::countr_zero(std::rotr(occupied_[0], idx));
+            for (const Entry* e = slots_[0][(idx + dist) & kSlotMask]; e; e = e->next_)
+                best = std::min(best, e->expiry_ns);
+        }
+
+        // Upper wheels: the next cascade of an occupied slot.  The slot at
+        // the current index cascades one full rotation later.
+        for (uint32_t level = 1; level < kLevels; ++level)
+        {
+            if (!occupied_[level])
+                continue;
+            const uint64_t pos = current_tick_ >> levelShift(level);
+            const auto start = static_cast<int>((pos + 1) & kSlotMask);
+            const uint64_t dist = static_cast<uint64_t>(std::countr_zero(std::rotr(occupied_[level], start))) + 1;
+            const uint64_t tick = (pos + dist) << levelShift(level);
+            best = std::min(best, tick << kTickShift);
+        }
+        return best;
+    }
+
+} // namespace lux::communication
@@ -16,6 +16,14 @@
 
 namespace lux::communication::discovery
 {
+    /// Encoded subscriber filters go out only whole; one that does not fit
+    /// stays unadvertised (announceSubscriber already dropped it).
+    static void copyFilter(DiscoveryPacket &pkt, const std::string &filter)
+    {
+        if (filter.size() < sizeof(pkt.content_filter))
+            std::memcpy(pkt.content_filter, filter.data(), filter.size());
+    }
+
     // ════════════════════════════════════════════════════════════════════════════
     //  Impl
     // ════════════════════════════════════════════════════════════════════════════
@@ -52,14 +60,18 @@ namespace lux::communication::discovery
         uint64_t next_listener_id = 1;
 
         // ── known remote endpoints (from multicast) ──
+        // One entry per remote publisher / subscriber, not per process, so
+        // that each of them is discovered and lost on its own.
         struct RemoteKey
         {
             std::string topic_name;
             uint32_t pid;
             uint8_t role;
+            uint32_t endpoint_id;
             bool operator==(const RemoteKey &o) const
             {
-                return topic_name == o.topic_name && pid == o.pid && role == o.role;
+                return topic_name == o.topic_name && pid == o.pid && role == o.role &&
+                       endpoint_id == o.endpoint_id;
             }
         };
         struct RemoteKeyHash
@@ -69,6 +81,7 @@ namespace lux::communication::discovery
                 size_t h = std::hash<std::string>{}(k.topic_name);
                 h ^= std::hash<uint32_t>{}(k.pid) + 0x9e3779b9 + (h << 6) + (h >> 2);
                 h ^= std::hash<uint8_t>{}(k.role) + 0x9e3779b9 + (h << 6) + (h >> 2);
+                h ^= std::hash<uint32_t>{}(k.endpoint_id) + 0x9e3779b9 + (h << 6) + (h >> 2);
                 return h;
             }
         };
@@ -141,11 +154,13 @@ namespace lux::communication::discovery
                 pkt.topic_name_hash = fnv1a_64(le.info.topic_name);
                 pkt.type_hash = le.info.type_hash;
                 pkt.pid = my_pid;
+                pkt.endpoint_id = le.info.endpoint_id;
                 pkt.timestamp_ns = platform::steadyNowNs();
                 std::strncpy(pkt.topic_name, le.info.topic_name.c_str(), sizeof(pkt.topic_name) - 1);
                 std::strncpy(pkt.net_endpoint, le.info.net_endpoint.c_str(), sizeof(pkt.net_endpoint) - 1);
                 auto hn = platform::currentHostname();
                 std::strncpy(pkt.hostname, hn.c_str(), sizeof(pkt.hostname) - 1);
+                copyFilter(pkt, le.info.content_filter);
                 multicast.withdraw(pkt); // single-send (same as withdraw)
             }
         }
@@ -203,12 +218,15 @@ namespace lux::communication::discovery
                 ep.type_hash = pkt.type_hash;
                 ep.domain_id = pkt.domain_id;
                 ep.pid = pkt.pid;
+                ep.endpoint_id = pkt.endpoint_id;
                 ep.hostname = pkt.hostname;
                 ep.role = (pkt.role == 1) ? TopicEndpoint::Role::Publisher
                                           : TopicEndpoint::Role::Subscriber;
                 ep.net_endpoint = pkt.net_endpoint;
+                ep.content_filter.assign(pkt.content_filter,
+                                         strnlen(pkt.content_filter, sizeof(pkt.content_filter)));
 
-                RemoteKey key{ep.topic_name, ep.pid, pkt.role};
+                RemoteKey key{ep.topic_name, ep.pid, pkt.role, ep.endpoint_id};
 
                 bool is_new = false;
                 {
@@ -227,7 +245,7 @@ namespace lux::communication::discovery
             else if (ptype == PacketType::Heartbeat)
             {
                 // Heartbeat: just refresh the last_seen timestamp for this remote.
-                RemoteKey key{std::string(pkt.topic_name), pkt.pid, pkt.role};
+                RemoteKey key{std::string(pkt.topic_name), pkt.pid, pkt.role, pkt.endpoint_id};
                 bool is_new_via_heartbeat = false;
                 TopicEndpoint new_ep;
 
@@ -245,10 +263,13 @@ namespace lux::communication::discovery
                         new_ep.type_hash = pkt.type_hash;
                         new_ep.domain_id = pkt.domain_id;
                         new_ep.pid = pkt.pid;
+                        new_ep.endpoint_id = pkt.endpoint_id;
                         new_ep.hostname = pkt.hostname;
                         new_ep.role = (pkt.role == 1) ? TopicEndpoint::Role::Publisher
                                                       : TopicEndpoint::Role::Subscriber;
                         new_ep.net_endpoint = pkt.net_endpoint;
+                        new_ep.content_filter.assign(pkt.content_filter,
+                                                     strnlen(pkt.content_filter, sizeof(pkt.content_filter)));
 
                         known_remotes[key] = new_ep;
                         remote_last_seen[key] = std::chrono::steady_clock::now();
@@ -264,7 +285,7 @@ namespace lux::communication::discovery
             }
             else if (ptype == PacketType::Withdraw)
             {
-                RemoteKey key{std::string(pkt.topic_name), pkt.pid, pkt.role};
+                RemoteKey key{std::string(pkt.topic_name), pkt.pid, pkt.role, pkt.endpoint_id};
                 TopicEndpoint ep;
                 bool removed = false;
                 {
@@ -302,11 +323,13 @@ namespace lux::communication::discovery
                     reply.topic_name_hash = fnv1a_64(le.info.topic_name);
                     reply.type_hash = le.info.type_hash;
                     reply.pid = my_pid;
+                    reply.endpoint_id = le.info.endpoint_id;
                     reply.timestamp_ns = platform::steadyNowNs();
                     std::strncpy(reply.topic_name, le.info.topic_name.c_str(), sizeof(reply.topic_name) - 1);
                     std::strncpy(reply.net_endpoint, le.info.net_endpoint.c_str(), sizeof(reply.net_endpoint) - 1);
                     auto hn = platform::currentHostname();
                     std::strncpy(reply.hostname, hn.c_str(), sizeof(reply.hostname) - 1);
+                    copyFilter(reply, le.info.content_filter);
 
                     multicast.withdraw(reply); // single-send (reuse withdraw helper)
                 }
@@ -361,7 +384,8 @@ namespace lux::communication::discovery
     static DiscoveryPacket buildPacket(
         PacketType pt, uint8_t role, uint64_t domain_id,
         const std::string &topic_name, uint64_t type_hash,
-        const std::string &net_endpoint)
+        const std::string &net_endpoint, uint32_t endpoint_id,
+        const std::string &content_filter = "")
     {
         DiscoveryPacket pkt{};
         pkt.type = static_cast<uint8_t>(pt);
@@ -370,11 +394,13 @@ namespace lux::communication::discovery
         pkt.topic_name_hash = fnv1a_64(topic_name);
         pkt.type_hash = type_hash;
         pkt.pid = platform::currentPid();
+        pkt.endpoint_id = endpoint_id;
         pkt.timestamp_ns = platform::steadyNowNs();
         std::strncpy(pkt.topic_name, topic_name.c_str(), sizeof(pkt.topic_name) - 1);
         std::strncpy(pkt.net_endpoint, net_endpoint.c_str(), sizeof(pkt.net_endpoint) - 1);
         auto hn = platform::currentHostname();
         std::strncpy(pkt.hostname, hn.c_str(), sizeof(pkt.hostname) - 1);
+        copyFilter(pkt, content_filter);
         return pkt;
     }
 
@@ -400,18 +426,24 @@ namespace lux::communication::discovery
         info.net_endpoint = net_endpoint;
         info.hostname = hn;
 
-        int32_t slot = impl_->registry.announce(info);
-
         uint64_t handle;
         {
             std::lock_guard<std::mutex> lck(impl_->local_mutex);
             handle = impl_->next_handle++;
+        }
+        info.endpoint_id = static_cast<uint32_t>(handle);
+
+        int32_t slot = impl_->registry.announce(info);
+
+        {
+            std::lock_guard<std::mutex> lck(impl_->local_mutex);
             TopicEndpoint ep;
             ep.topic_name = topic_name;
             ep.type_name = type_name;
             ep.type_hash = type_hash;
             ep.domain_id = impl_->domain_id;
             ep.pid = my_pid;
+            ep.endpoint_id = info.endpoint_id;
             ep.hostname = hn;
             ep.role = TopicEndpoint::Role::Publisher;
             ep.shm_segment_name = shm_name;
@@ -422,7 +454,8 @@ namespace lux::communication::discovery
         if (impl_->running.load(std::memory_order_relaxed))
         {
             auto pkt = buildPacket(PacketType::Announce, 1,
-                                   impl_->domain_id, topic_name, type_hash, net_endpoint);
+                                   impl_->domain_id, topic_name, type_hash, net_endpoint,
+                                   info.endpoint_id);
             impl_->multicast.announce(pkt);
         }
 
@@ -434,11 +467,16 @@ namespace lux::communication::discovery
         const std::string &type_name,
         uint64_t type_hash,
         const std::string &shm_name,
-        const std::string &net_endpoint)
+        const std::string &net_endpoint,
+        const std::string &content_filter)
     {
         uint32_t my_pid = platform::currentPid();
         auto hn = platform::currentHostname();
 
+        // Too long for the registry entry and the multicast packet:
+        // publishers send everything and the subscriber filters alone.
+        const std::string filter = content_filter.size() < kMaxFilterLen ? content_filter : std::string();
+
         TopicEndpointInfo info;
         info.pid = my_pid;
         info.domain_id = impl_->domain_id;
@@ -450,30 +488,39 @@ namespace lux::communication::discovery
         info.shm_segment_name = shm_name;
         info.net_endpoint = net_endpoint;
         info.hostname = hn;
-
-        int32_t slot = impl_->registry.announce(info);
+        info.content_filter = filter;
 
         uint64_t handle;
         {
             std::lock_guard<std::mutex> lck(impl_->local_mutex);
             handle = impl_->next_handle++;
+        }
+        info.endpoint_id = static_cast<uint32_t>(handle);
+
+        int32_t slot = impl_->registry.announce(info);
+
+        {
+            std::lock_guard<std::mutex> lck(impl_->local_mutex);
             TopicEndpoint ep;
             ep.topic_name = topic_name;
             ep.type_name = type_name;
             ep.type_hash = type_hash;
             ep.domain_id = impl_->domain_id;
             ep.pid = my_pid;
+            ep.endpoint_id = info.endpoint_id;
             ep.hostname = hn;
             ep.role = TopicEndpoint::Role::Subscriber;
             ep.shm_segment_name = shm_name;
             ep.net_endpoint = net_endpoint;
+            ep.content_filter = filter;
             impl_->local_endpoints.push_back({handle, slot, ep});
         }
 
         if (impl_->running.load(std::memory_order_relaxed))
         {
             auto pkt = buildPacket(PacketType::Announce, 2,
-                                   impl_->domain_id, topic_name, type_hash, net_endpoint);
+                                   impl_->domain_id, topic_name, type_hash, net_endpoint,
+                                   info.endpoint_id, filter);
             impl_->multicast.announce(pkt);
         }
 
@@ -497,7 +544,8 @@ namespace lux::communication::discovery
                 uint8_t role_val = (it->info.role == TopicEndpoint::Role::Publisher) ? 1 : 2;
                 auto pkt = buildPacket(PacketType::Withdraw, role_val,
                                        impl_->domain_id, it->info.topic_name,
-                                       it->info.type_hash, it->info.net_endpoint);
+                                       it->info.type_hash, it->info.net_endpoint,
+                                       it->info.endpoint_id);
                 impl_->multicast.withdraw(pkt);
             }
 
@@ -540,10 +588,12 @@ namespace lux::communication::discovery
             ep.type_hash = r.type_hash;
             ep.domain_id = r.domain_id;
             ep.pid = r.pid;
+            ep.endpoint_id = r.endpoint_id;
             ep.hostname = std::move(r.hostname);
             ep.role = role;
             ep.shm_segment_name = std::move(r.shm_segment_name);
             ep.net_endpoint = std::move(r.net_endpoint);
+            ep.content_filter = std::move(r.content_filter);
             results.push_back(std::move(ep));
         }
 
@@ -560,7 +610,7 @@ namespace lux::communication::discovery
                 bool dup = false;
                 for (auto &existing : results)
                 {
-                    if (existing.pid == ep.pid)
+                    if (existing.pid == ep.pid && existing.endpoint_id == ep.endpoint_id)
                     {
                         dup = true;
                         break;
@@ -664,7 +714,8 @@ namespace lux::communication::discovery
                 uint8_t role_val = (le.info.role == TopicEndpoint::Role::Publisher) ? 1 : 2;
                 auto pkt = buildPacket(PacketType::Withdraw, role_val,
                                        impl_->domain_id, le.info.topic_name,
-                                       le.info.type_hash, le.info.net_endpoint);
+                                       le.info.type_hash, le.info.net_endpoint,
+                                       le.info.endpoint_id);
                 impl_->multicast.withdraw(pkt);
             }
         }
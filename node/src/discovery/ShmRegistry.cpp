@@ -171,7 +171,7 @@ namespace lux::communication::discovery
         e->type_hash = info.type_hash;
         e->role = static_cast<uint8_t>(info.role);
         e->reserved1[0] = e->reserved1[1] = e->reserved1[2] = 0;
-        e->reserved2 = 0;
+        e->endpoint_id = info.endpoint_id;
 
         std::memset(e->topic_name, 0, kMaxTopicNameLen);
         std::strncpy(e->topic_name, info.topic_name.c_str(), kMaxTopicNameLen - 1);
@@ -188,6 +188,11 @@ namespace lux::communication::discovery
         std::memset(e->hostname, 0, kMaxHostnameLen);
         std::strncpy(e->hostname, info.hostname.c_str(), kMaxHostnameLen - 1);
 
+        // Never truncated: a cut filter would drop what the subscriber wants.
+        std::memset(e->content_filter, 0, kMaxFilterLen);
+        if (info.content_filter.size() < kMaxFilterLen)
+            std::memcpy(e->content_filter, info.content_filter.data(), info.content_filter.size());
+
         e->heartbeat_ns.store(platform::steadyNowNs(), std::memory_order_relaxed);
 
         // Mark active last – makes the entry visible to readers.
@@ -282,6 +287,7 @@ namespace lux::communication::discovery
 
             LookupResult r;
             r.pid = e->pid;
+            r.endpoint_id = e->endpoint_id;
             r.domain_id = e->domain_id;
             r.topic_name = e->topic_name;
             r.type_name = e->type_name;
@@ -290,6 +296,8 @@ namespace lux::communication::discovery
             r.shm_segment_name = e->shm_segment_name;
             r.net_endpoint = e->net_endpoint;
             r.hostname = e->hostname;
+            r.content_filter.assign(e->content_filter,
+                                    strnlen(e->content_filter, kMaxFilterLen));
             results.push_back(std::move(r));
         }
 
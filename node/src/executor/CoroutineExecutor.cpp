@@ -0,0 +1,128 @@
+#include "lux/communication/executor/CoroutineExecutor.hpp"
+#include "lux/communication/SubscriberBase.hpp"
+
+#include <cstdio>
+
+namespace lux::communication
+{
+    // ── Task ─────────────────────────────────────────────────────────
+
+    void Task::finish(handle_type handle) noexcept
+    {
+        if (auto* exec = handle.promise().executor)
+            exec->finishTask(handle);
+        else
+            handle.destroy();
+    }
+
+    void Task::reportException() noexcept
+    {
+        std::fprintf(stderr, "[CoroutineExecutor WARNING] task ended with an unhandled exception\n");
+    }
+
+    // ── CoroutineExecutor ────────────────────────────────────────────
+
+    CoroutineExecutor::~CoroutineExecutor()
+    {
+        stop();
+
+        // Frames still suspended (awaiting a message, or posted and never
+        // run) die with the executor; their awaiters disarm themselves.
+        std::coroutine_handle<> handle;
+        while (posted_.try_dequeue(handle)) {}
+
+        std::unordered_set<void*> tasks;
+        {
+            std::lock_guard<std::mutex> lock(tasks_mutex_);
+            tasks.swap(tasks_);
+        }
+        for (void* frame : tasks)
+            std::coroutine_handle<>::from_address(frame).destroy();
+    }
+
+    void CoroutineExecutor::spin()
+    {
+        if (spinning_.exchange(true))
+            return;
+        applyThreadOptions(0, 1);
+
+        while (spinning_)
+        {
+            runPosted();
+            auto sub = waitOneReady();
+            if (!spinning_)
+            {
+                requeueReady(sub);
+                break;
+            }
+            if (sub)
+                handleSubscriber(sub);
+        }
+    }
+
+    void CoroutineExecutor::spinSome()
+    {
+        pollTimers();
+        runPosted();
+
+        SubscriberBase* sub = nullptr;
+        while (tryDequeueReady(sub))
+        {
+            if (sub)
+                handleSubscriber(sub);
+        }
+        runPosted();
+    }
+
+    void CoroutineExecutor::handleSubscriber(SubscriberBase* sub)
+    {
+        // Awaiting coroutines resume inside the subscriber's take.
+        takeReady(sub);
+    }
+
+    void CoroutineExecutor::spawn(Task task)
+    {
+        auto handle = task.release();
+        if (!handle)
+            return;
+        handle.promise().executor = this;
+        {
+            std::lock_guard<std::mutex> lock(tasks_mutex_);
+            tasks_.insert(handle.address());
+        }
+        post(handle);
+    }
+
+    size_t CoroutineExecutor::taskCount() const
+    {
+        std::lock_guard<std::mutex> lock(tasks_mutex_);
+        return tasks_.size();
+    }
+
+    void CoroutineExecutor::post(std::coroutine_handle<> handle)
+    {
+        posted_.enqueue(handle);
+        // A null ready entry makes waitOneReady() return, spinning or parked.
+        wakeup();
+    }
+
+    void CoroutineExecutor::runPosted()
+    {
+        // Only what was posted before this call: a coroutine that schedules
+        // itself again runs on the next round, after ready subscribers.
+        size_t n = posted_.size_approx();
+        std::coroutine_handle<> handle;
+        while (n-- > 0 && posted_.try_dequeue(handle))
+            handle.resume();
+    }
+
+    void CoroutineExecutor::finishTask(std::coroutine_handle<> handle)
+    {
+        {
+            std::lock_guard<std::mutex> lock(tasks_mutex_);
+            tasks_.erase(handle.address());
+        }
+        handle.destroy();
+    }
+
+} // namespace lux::communication
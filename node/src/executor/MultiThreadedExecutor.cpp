@@ -2,54 +2,218 @@
 #include "lux/communication/SubscriberBase.hpp"
 #include "lux/communication/CallbackGroupBase.hpp"
 
-namespace lux::communication 
+namespace lux::communication
 {
+    namespace
+    {
+        // Worker identity of the current thread (nullptr outside spin()).
+        thread_local const MultiThreadedExecutor* tls_executor = nullptr;
+        thread_local void*                        tls_worker   = nullptr;
+    }
+
     MultiThreadedExecutor::MultiThreadedExecutor(size_t threadNum)
-        : thread_pool_(threadNum)
     {
+        if (threadNum == 0)
+            threadNum = 1;
+        workers_.reserve(threadNum);
+        for (size_t i = 0; i < threadNum; ++i)
+            workers_.push_back(std::make_unique<Worker>(i));
     }
 
     MultiThreadedExecutor::~MultiThreadedExecutor()
     {
         stop();
+        // spin() may still be joining its helpers on another thread.
+        while (in_spin_.load(std::memory_order_acquire))
+            std::this_thread::yield();
+    }
+
+    void MultiThreadedExecutor::spin()
+    {
+        spinning_ = true;
+        in_spin_.store(true, std::memory_order_release);
+
+        for (size_t i = 1; i < workers_.size(); ++i)
+        {
+            auto* w = workers_[i].get();
+            w->thread = std::thread([this, w] { workerLoop(*w); });
+        }
+        workerLoop(*workers_[0]);
+
+        for (size_t i = 1; i < workers_.size(); ++i)
+        {
+            if (workers_[i]->thread.joinable())
+                workers_[i]->thread.join();
+        }
+        in_spin_.store(false, std::memory_order_release);
     }
 
     void MultiThreadedExecutor::spinSome()
     {
-        // Drain all currently ready subscribers (non-blocking).
+        // Drain all currently ready subscribers on the calling thread
+        // (non-blocking), including work a previous spin() left in the deques.
+        pollTimers();
         SubscriberBase* sub = nullptr;
-        while (ready_queue_.try_dequeue(sub))
+        for (auto& w : workers_)
+        {
+            while (w->deque.steal(sub))
+                runReady(sub);
+        }
+        while (tryDequeueReady(sub))
         {
-            (void)ready_sem_.try_acquire_for(std::chrono::milliseconds(0));
             if (sub)
-                handleSubscriber(sub);
+                runReady(sub);
         }
     }
 
     void MultiThreadedExecutor::handleSubscriber(SubscriberBase* sub)
     {
-        if (!sub)
-            return;
+        if (sub)
+            runReady(sub);
+    }
 
-        auto group = sub->callbackGroup();
-        if (group->type() == CallbackGroupType::MutuallyExclusive)
+    void MultiThreadedExecutor::enqueueReady(SubscriberBase* sub)
+    {
+        // Readiness raised by a callback on one of our workers stays local,
+        // unless a ReadyPolicy needs every entry in the shared priority heap.
+        if (tls_executor == this && readyPolicy() == ReadyPolicy::Fifo)
         {
-            sub->takeAll();
+            auto* self = static_cast<Worker*>(tls_worker);
+            if (!self->deque.push(sub))
+                ready_queue_.enqueue(sub); // deque full — overflow to shared queue
         }
         else
         {
-            thread_pool_.submit([sub] { sub->takeAll(); });
+            stampReady(sub);
+            ready_queue_.enqueue(sub);
         }
+        notifyIdle();
+    }
+
+    void MultiThreadedExecutor::notifyIdle()
+    {
+        // A fence and a load unless a worker is parked (see workerLoop()).
+        idle_ec_.notifyOne();
+    }
+
+    void MultiThreadedExecutor::wakeForTimers()
+    {
+        notifyIdle();
     }
 
     void MultiThreadedExecutor::stop()
     {
         if (spinning_.exchange(false))
         {
-            ready_sem_.release();
+            idle_ec_.notifyAll();
+            ready_ec_.notifyAll();
             notifyCondition();
         }
-        thread_pool_.close();
+    }
+
+    // ── Worker ───────────────────────────────────────────────────────
+
+    void MultiThreadedExecutor::workerLoop(Worker& self)
+    {
+        tls_executor = this;
+        tls_worker   = &self;
+        applyThreadOptions(self.index, workers_.size());
+
+        while (spinning_.load(std::memory_order_relaxed))
+        {
+            pollTimers();
+            SubscriberBase* sub = findWork(self);
+
+            // User-space spin for the WaitPolicy's window, then park.
+            const uint64_t wait_start = sub ? 0 : platform::steadyNowNs();
+            if (!sub && !spinWait([&] { return (sub = findWork(self)) != nullptr; }, wait_start))
+            {
+                const EventCount::Key key = idle_ec_.prepareWait();
+                sub = findWork(self);
+                if (sub || !spinning_.load(std::memory_order_relaxed))
+                {
+                    idle_ec_.cancelWait();
+                }
+                else
+                {
+                    (void)waitUntil(idle_ec_, key, UINT64_MAX); // or the next timer
+                    sub = findWork(self);
+                    if (sub)
+                        recordWait(platform::steadyNowNs() - wait_start);
+                }
+            }
+
+            if (sub)
+                runReady(sub);
+        }
+
+        tls_executor = nullptr;
+        tls_worker   = nullptr;
+    }
+
+    SubscriberBase* MultiThreadedExecutor::findWork(Worker& self)
+    {
+        SubscriberBase* sub = nullptr;
+        if (self.deque.pop(sub))
+            return sub;
+        if (tryDequeueReady(sub) && sub)
+            return sub;
+
+        // Steal, starting from a random victim to spread contention.
+        const size_t n = workers_.size();
+        if (n > 1)
+        {
+            self.rng ^= self.rng << 13;
+            self.rng ^= self.rng >> 7;
+            self.rng ^= self.rng << 17;
+            const size_t start = static_cast<size_t>(self.rng % n);
+            for (size_t k = 0; k < n; ++k)
+            {
+                auto& victim = *workers_[(start + k) % n];
+                if (&victim != &self && victim.deque.steal(sub))
+                    return sub;
+            }
+        }
+        return nullptr;
+    }
+
+    // ── Group scheduling ─────────────────────────────────────────────
+
+    void MultiThreadedExecutor::runReady(SubscriberBase* sub)
+    {
+        auto* group = sub->callbackGroup();
+        if (!group || group->type() == CallbackGroupType::Reentrant)
+        {
+            takeReady(sub);
+            return;
+        }
+
+        if (group->tryAcquireExclusive())
+        {
+            runExclusive(group, sub);
+            return;
+        }
+
+        // Another worker owns the group: hand the subscriber over.  The owner
+        // may have released in between, so try once more to take it ourselves.
+        group->deferReady(sub);
+        if (group->tryAcquireExclusive())
+            runExclusive(group, nullptr);
+    }
+
+    void MultiThreadedExecutor::runExclusive(CallbackGroupBase* group, SubscriberBase* sub)
+    {
+        // Caller owns the group.
+        do
+        {
+            if (sub)
+                takeReady(sub);
+            while ((sub = group->takeDeferred()) != nullptr)
+                takeReady(sub);
+            group->releaseExclusive();
+            // A subscriber deferred after the last takeDeferred() found the
+            // group still owned; pick it up unless another worker already has.
+        } while (group->hasDeferred() && group->tryAcquireExclusive());
     }
 
 } // namespace lux::communication
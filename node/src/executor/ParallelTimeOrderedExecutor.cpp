@@ -0,0 +1,328 @@
+#include "lux/communication/executor/ParallelTimeOrderedExecutor.hpp"
+#include "lux/communication/SubscriberBase.hpp"
+#include "lux/communication/CallbackGroupBase.hpp"
+#include "lux/communication/platform/PlatformDefs.hpp"
+
+#include <algorithm>
+#include <mutex>
+
+namespace lux::communication
+{
+    ParallelTimeOrderedExecutor::ParallelTimeOrderedExecutor(size_t threadNum,
+                                                             std::chrono::nanoseconds idle_timeout)
+        : thread_count_(threadNum ? threadNum : 1)
+        , idle_timeout_ns_(idle_timeout.count())
+    {
+        needs_timestamps_ = true;
+    }
+
+    ParallelTimeOrderedExecutor::~ParallelTimeOrderedExecutor()
+    {
+        stop();
+        // spin() may still be joining its helpers on another thread.
+        while (in_spin_.load(std::memory_order_acquire))
+            std::this_thread::yield();
+    }
+
+    void ParallelTimeOrderedExecutor::spin()
+    {
+        spinning_ = true;
+        in_spin_.store(true, std::memory_order_release);
+
+        threads_.reserve(thread_count_ - 1);
+        for (size_t i = 1; i < thread_count_; ++i)
+            threads_.emplace_back([this, i] { workerLoop(i); });
+        workerLoop(0);
+
+        for (auto& t : threads_)
+        {
+            if (t.joinable())
+                t.join();
+        }
+        threads_.clear();
+        in_spin_.store(false, std::memory_order_release);
+    }
+
+    void ParallelTimeOrderedExecutor::spinSome()
+    {
+        // Drain all currently ready subscribers on the calling thread
+        // (non-blocking), then release domains whose waiting source idled.
+        pollTimers();
+        SubscriberBase* batch[kMaxReadyBatch];
+        size_t n;
+        while ((n = collectReady(batch, 0)) > 0)
+            dispatch(batch, n);
+        runDueLanes();
+    }
+
+    void ParallelTimeOrderedExecutor::stop()
+    {
+        if (spinning_.exchange(false))
+        {
+            idle_ec_.notifyAll();
+            ready_ec_.notifyAll();
+            notifyCondition();
+        }
+    }
+
+    void ParallelTimeOrderedExecutor::handleSubscriber(SubscriberBase* sub)
+    {
+        if (sub)
+            dispatch(&sub, 1);
+    }
+
+    size_t ParallelTimeOrderedExecutor::collectReady(SubscriberBase** batch, size_t n)
+    {
+        SubscriberBase* sub = nullptr;
+        while (n < kMaxReadyBatch && tryDequeueReady(sub))
+        {
+            if (sub)
+                batch[n++] = sub;
+        }
+        return n;
+    }
+
+    void ParallelTimeOrderedExecutor::dispatch(SubscriberBase* const* subs, size_t n)
+    {
+        // Post every subscriber before merging, so each domain sees all of
+        // its ready sources at once (as TimeOrderedExecutor does).
+        Lane*  touched[kMaxReadyBatch];
+        size_t lanes = 0;
+        for (size_t i = 0; i < n; ++i)
+        {
+            Lane& lane = laneFor(subs[i]->callbackGroup());
+            {
+                std::lock_guard lock(lane.inbox_mutex);
+                lane.inbox.push_back(subs[i]);
+            }
+            if (std::find(touched, touched + lanes, &lane) == touched + lanes)
+                touched[lanes++] = &lane;
+        }
+        for (size_t i = 0; i < lanes; ++i)
+            runLane(*touched[i]);
+    }
+
+    void ParallelTimeOrderedExecutor::enqueueReady(SubscriberBase* sub)
+    {
+        stampReady(sub);
+        ready_queue_.enqueue(sub);
+        notifyIdle();
+    }
+
+    void ParallelTimeOrderedExecutor::wakeForTimers()
+    {
+        notifyIdle();
+    }
+
+    void ParallelTimeOrderedExecutor::notifyIdle()
+    {
+        // A fence and a load unless a worker is parked (see workerLoop()).
+        idle_ec_.notifyOne();
+    }
+
+    bool ParallelTimeOrderedExecutor::checkRunnable()
+    {
+        if (hasReady())
+            return true;
+        std::shared_lock lock(lanes_mutex_);
+        for (auto& lane : lanes_)
+        {
+            if (lane->pending.load(std::memory_order_relaxed) > 0)
+                return true;
+        }
+        return false;
+    }
+
+    // ── Ordering domains ─────────────────────────────────────────────
+
+    ParallelTimeOrderedExecutor::Lane* ParallelTimeOrderedExecutor::newLane()
+    {
+        lanes_.push_back(std::make_unique<Lane>(
+            std::chrono::nanoseconds(idle_timeout_ns_.load(std::memory_order_relaxed))));
+        return lanes_.back().get();
+    }
+
+    ParallelTimeOrderedExecutor::Lane& ParallelTimeOrderedExecutor::laneFor(CallbackGroupBase* group)
+    {
+        {
+            std::shared_lock lock(lanes_mutex_);
+            auto it = group_lanes_.find(group);
+            if (it != group_lanes_.end())
+                return *it->second;
+        }
+        std::unique_lock lock(lanes_mutex_);
+        auto [it, inserted] = group_lanes_.try_emplace(group, nullptr);
+        if (inserted)
+            it->second = newLane();
+        return *it->second;
+    }
+
+    void ParallelTimeOrderedExecutor::setOrderingDomain(CallbackGroupBase* group, uint32_t domain)
+    {
+        std::unique_lock lock(lanes_mutex_);
+        auto [it, inserted] = domain_lanes_.try_emplace(domain, nullptr);
+        if (inserted)
+            it->second = newLane();
+        group_lanes_[group] = it->second;
+    }
+
+    void ParallelTimeOrderedExecutor::setIdleTimeout(std::chrono::nanoseconds timeout)
+    {
+        std::unique_lock lock(lanes_mutex_);
+        idle_timeout_ns_.store(timeout.count(), std::memory_order_relaxed);
+        for (auto& lane : lanes_)
+            lane->merge.setIdleTimeout(timeout);
+    }
+
+    std::chrono::nanoseconds ParallelTimeOrderedExecutor::idleTimeout() const
+    {
+        return std::chrono::nanoseconds(idle_timeout_ns_.load(std::memory_order_relaxed));
+    }
+
+    uint64_t ParallelTimeOrderedExecutor::lateCount() const
+    {
+        std::shared_lock lock(lanes_mutex_);
+        uint64_t total = 0;
+        for (auto& lane : lanes_)
+            total += lane->late.load(std::memory_order_relaxed);
+        return total;
+    }
+
+    size_t ParallelTimeOrderedExecutor::domainCount() const
+    {
+        std::shared_lock lock(lanes_mutex_);
+        return lanes_.size();
+    }
+
+    // ── Lane scheduling ──────────────────────────────────────────────
+
+    void ParallelTimeOrderedExecutor::runLane(Lane& lane)
+    {
+        // Another worker owns the lane: it picks up our inbox entry before
+        // letting go (see the re-check below).
+        if (lane.owned.exchange(true, std::memory_order_acquire))
+            return;
+
+        for (;;)
+        {
+            {
+                std::lock_guard lock(lane.inbox_mutex);
+                lane.batch.swap(lane.inbox);
+            }
+            for (SubscriberBase* sub : lane.batch)
+            {
+                if (lane.merge.canBypass(sub))
+                {
+                    sub->takeAll();
+                    continue;
+                }
+                lane.drain_buffer.clear();
+                sub->drainAll(lane.drain_buffer);
+                lane.merge.append(sub, lane.drain_buffer);
+            }
+            lane.batch.clear();
+
+            const uint64_t wake_at = lane.merge.release();
+            lane.late.store(lane.merge.lateCount(), std::memory_order_relaxed);
+            lane.pending.store(lane.merge.pendingSize(), std::memory_order_relaxed);
+            lane.wake_at.store(wake_at, std::memory_order_relaxed);
+            if (wake_at)
+                noteWake(wake_at);
+
+            lane.owned.store(false, std::memory_order_release);
+
+            // A subscriber posted after the swap found the lane still owned.
+            // The inbox mutex orders that post against this check.
+            bool more;
+            {
+                std::lock_guard lock(lane.inbox_mutex);
+                more = !lane.inbox.empty();
+            }
+            if (!more || lane.owned.exchange(true, std::memory_order_acquire))
+                return;
+        }
+    }
+
+    void ParallelTimeOrderedExecutor::noteWake(uint64_t wake_at)
+    {
+        uint64_t cur = next_wake_ns_.load(std::memory_order_relaxed);
+        while ((cur == 0 || wake_at < cur) &&
+               !next_wake_ns_.compare_exchange_weak(cur, wake_at, std::memory_order_relaxed))
+        {
+        }
+    }
+
+    void ParallelTimeOrderedExecutor::runDueLanes()
+    {
+        uint64_t wake = next_wake_ns_.load(std::memory_order_relaxed);
+        if (wake == 0)
+            return;
+        const uint64_t now = platform::steadyNowNs();
+        if (now < wake || !next_wake_ns_.compare_exchange_strong(wake, 0, std::memory_order_relaxed))
+            return;
+
+        // Collect first: callbacks may create groups, which needs the lock.
+        std::vector<Lane*> due;
+        {
+            std::shared_lock lock(lanes_mutex_);
+            for (auto& lane : lanes_)
+            {
+                const uint64_t at = lane->wake_at.load(std::memory_order_relaxed);
+                if (at == 0)
+                    continue;
+                if (at <= now)
+                    due.push_back(lane.get());
+                else
+                    noteWake(at);
+            }
+        }
+        for (Lane* lane : due)
+            runLane(*lane);
+    }
+
+    // ── Worker ───────────────────────────────────────────────────────
+
+    void ParallelTimeOrderedExecutor::workerLoop(size_t index)
+    {
+        applyThreadOptions(index, thread_count_);
+
+        SubscriberBase* batch[kMaxReadyBatch];
+        while (spinning_.load(std::memory_order_relaxed))
+        {
+            pollTimers();
+            size_t n = collectReady(batch, 0);
+
+            // User-space spin for the WaitPolicy's window, then park; a
+            // held-back domain due meanwhile ends the spin early.
+            const uint64_t wait_start = n ? 0 : platform::steadyNowNs();
+            const uint64_t due_at     = next_wake_ns_.load(std::memory_order_relaxed);
+            if (n == 0 && !spinWait([&] { return (n = collectReady(batch, 0)) > 0; }, wait_start,
+                                    due_at == 0 ? UINT64_MAX : due_at))
+            {
+                runDueLanes();
+
+                const EventCount::Key key = idle_ec_.prepareWait();
+                n = collectReady(batch, 0);
+                if (n > 0 || !spinning_.load(std::memory_order_relaxed))
+                {
+                    idle_ec_.cancelWait();
+                }
+                else
+                {
+                    // Sleep until new readiness, the next held-back domain
+                    // may be released, or the next timer expires.
+                    const uint64_t wake = next_wake_ns_.load(std::memory_order_relaxed);
+                    (void)waitUntil(idle_ec_, key, wake == 0 ? UINT64_MAX : wake);
+                    n = collectReady(batch, 0);
+                    if (n > 0)
+                        recordWait(platform::steadyNowNs() - wait_start);
+                }
+            }
+
+            if (n > 0)
+                dispatch(batch, n);
+            runDueLanes();
+        }
+    }
+
+} // namespace lux::communication
@@ -1,8 +1,18 @@
 #include "lux/communication/executor/SeqOrderedExecutor.hpp"
 #include "lux/communication/SubscriberBase.hpp"
+#include "lux/communication/platform/PlatformDefs.hpp"
+
+#include <algorithm>
 
 namespace lux::communication 
 {
+    SeqOrderedExecutor::SeqOrderedExecutor(const SeqOrderedOptions& opts)
+        : opts_(opts), buffer_(opts.ring_capacity), remote_(opts.remote_idle_timeout)
+    {
+        if (opts_.max_window == 0)
+            opts_.max_window = 1;
+    }
+
     SeqOrderedExecutor::~SeqOrderedExecutor()
     {
         stop();
@@ -10,27 +20,122 @@ namespace lux::communication
 
     bool SeqOrderedExecutor::checkRunnable()
     {
-        return buffer_.pending_size() > 0 || ready_queue_.size_approx() > 0;
+        return buffer_.pending_size() > 0 || remote_.pendingSize() > 0 || hasReady();
     }
 
     void SeqOrderedExecutor::stop()
     {
         if (spinning_.exchange(false))
         {
-            ready_sem_.release();
+            ready_ec_.notifyAll();
             notifyCondition();
         }
     }
 
+    void SeqOrderedExecutor::seqConsumed(uint64_t seq)
+    {
+        consumed_.enqueue(seq);
+        // The head may be waiting on exactly this seq: wake a blocked spin(),
+        // once per batch of drops until absorbConsumed() picks them up.
+        if (!consumed_pending_.exchange(true, std::memory_order_acq_rel))
+            wakeup();
+    }
+
     // ── Helpers ──
 
+    void SeqOrderedExecutor::absorbConsumed()
+    {
+        // Clear before draining: a drop enqueued after this point wakes again.
+        if (!consumed_pending_.exchange(false, std::memory_order_acq_rel))
+            return;
+
+        uint64_t seqs[64];
+        size_t n;
+        while ((n = consumed_.try_dequeue_bulk(seqs, std::size(seqs))) > 0)
+        {
+            for (size_t i = 0; i < n; ++i)
+            {
+                ExecEntry marker;
+                marker.seq = seqs[i];
+                bufferEntry(marker);
+            }
+        }
+    }
+
+    void SeqOrderedExecutor::bufferEntry(ExecEntry& e)
+    {
+        for (;;)
+        {
+            switch (buffer_.put(e))
+            {
+            case ReorderBuffer::PutResult::Buffered:
+                return;
+            case ReorderBuffer::PutResult::Late:
+                // Its gap was already skipped: deliver now rather than drop.
+                e.execute();
+                return;
+            case ReorderBuffer::PutResult::Full:
+                // Bounded stall: the ring cannot hold the window any more,
+                // so give up on the missing head and run what follows it.
+                buffer_.skip_gap();
+                executeConsecutive();
+                break;
+            }
+        }
+    }
+
+    uint64_t SeqOrderedExecutor::bufferDrained(SubscriberBase* sub)
+    {
+        uint64_t max_seq = 0;
+        for (auto& e : drain_buffer_)
+        {
+            if (e.origin)
+            {
+                const uint64_t stamp = e.seq;
+                remote_buffer_.push_back(TimeExecEntry{stamp, std::move(e)});
+                continue;
+            }
+            max_seq = e.seq;
+            bufferEntry(e);
+        }
+        if (!remote_buffer_.empty())
+        {
+            remote_.append(sub, remote_buffer_);
+            remote_buffer_.clear();
+        }
+        return max_seq;
+    }
+
+    uint64_t SeqOrderedExecutor::checkGapTimeout()
+    {
+        if (opts_.gap_timeout.count() <= 0 || !buffer_.blocked())
+        {
+            gap_since_ns_ = 0;
+            return 0;
+        }
+
+        const uint64_t now = platform::steadyNowNs();
+        if (gap_since_ns_ == 0 || gap_seq_ != buffer_.next_seq())
+        {
+            gap_seq_      = buffer_.next_seq();
+            gap_since_ns_ = now;
+        }
+
+        const auto timeout = static_cast<uint64_t>(opts_.gap_timeout.count());
+        if (now - gap_since_ns_ < timeout)
+            return gap_since_ns_ + timeout - now;
+
+        buffer_.skip_gap();
+        gap_since_ns_ = 0;
+        return 0;
+    }
+
     size_t SeqOrderedExecutor::collectUniqueReady()
     {
         size_t n = 0;
         SubscriberBase* sub = nullptr;
-        while (n < kMaxReadyBatch && ready_queue_.try_dequeue(sub))
+        while (n < kMaxReadyBatch && tryDequeueReady(sub))
         {
-            (void)ready_sem_.try_acquire_for(std::chrono::milliseconds(0));
             if (!sub) continue;
 
             // Linear-scan dedup (batch is tiny, typically 2-4 subscribers)
@@ -62,7 +167,7 @@ namespace lux::communication
                 // so the gap-filling subscriber(s) can catch up.
                 size_t count = kMaxDrainPerSubscriber;
                 if (sub_max_seq[i] > next &&
-                    (sub_max_seq[i] - next) >= kMaxWindow)
+                    (sub_max_seq[i] - next) >= opts_.max_window)
                 {
                     count = 1;
                 }
@@ -73,10 +178,8 @@ namespace lux::communication
                 if (n > 0)
                 {
                     any_drained = true;
-                    if (!drain_buffer_.empty())
-                        sub_max_seq[i] = drain_buffer_.back().seq;
-                    for (auto& e : drain_buffer_)
-                        buffer_.put(std::move(e));
+                    if (const uint64_t max_seq = bufferDrained(ready_batch_[i]))
+                        sub_max_seq[i] = max_seq;
                 }
             }
             executeConsecutive();
@@ -85,10 +188,8 @@ namespace lux::communication
             // a subscriber is notified after we started this loop).
             SubscriberBase* sub = nullptr;
             while (batch_count < kMaxReadyBatch &&
-                   ready_queue_.try_dequeue(sub))
+                   tryDequeueReady(sub))
             {
-                (void)ready_sem_.try_acquire_for(
-                    std::chrono::milliseconds(0));
                 if (!sub) continue;
                 bool dup = false;
                 for (size_t j = 0; j < batch_count; ++j)
@@ -110,11 +211,14 @@ namespace lux::communication
     {
         if (spinning_.exchange(true))
             return;
+        applyThreadOptions(0, 1);
 
         drain_buffer_.reserve(kMaxDrainPerSubscriber * 2);
 
         while (spinning_)
         {
+            pollTimers();
+
             // Execute consecutive entries first
             if (executeConsecutive() > 0)
                 continue;
@@ -127,8 +231,23 @@ namespace lux::communication
                 continue;
             }
             
-            // No ready subscribers available, block-wait for one
-            auto sub = waitOneReady();
+            // No ready subscribers available: block-wait for one, or only
+            // until a missing head times out or held remote entries may run.
+            uint64_t wait_ns = checkGapTimeout();
+            if (wait_ns == 0 && !buffer_.blocked() && buffer_.pending_size() > 0)
+                continue; // head was just skipped
+            if (remote_wake_ns_ != 0)
+            {
+                const uint64_t now = platform::steadyNowNs();
+                if (remote_wake_ns_ <= now)
+                    continue; // the silent sender has gone idle
+                const uint64_t remote_wait_ns = remote_wake_ns_ - now;
+                wait_ns = wait_ns > 0 ? std::min(wait_ns, remote_wait_ns) : remote_wait_ns;
+            }
+
+            auto sub = wait_ns > 0
+                ? waitOneReadyTimeout(std::chrono::nanoseconds(wait_ns))
+                : waitOneReady();
             if (sub)
                 drainOneSubscriber(sub);
         }
@@ -136,6 +255,7 @@ namespace lux::communication
 
     void SeqOrderedExecutor::spinSome()
     {
+        pollTimers();
         for (;;)
         {
             // Collect unique ready subscribers (deduped)
@@ -147,9 +267,14 @@ namespace lux::communication
                 continue;
             }
 
-            // No more ready subscribers — execute any remaining entries
+            // No more ready subscribers — execute any remaining entries,
+            // skipping a head that has been missing for too long.
             if (executeConsecutive() == 0)
-                break;
+            {
+                (void)checkGapTimeout();
+                if (executeConsecutive() == 0)
+                    break;
+            }
         }
     }
 
@@ -165,23 +290,31 @@ namespace lux::communication
 
         drain_buffer_.clear();
         size_t drained = sub->drainExecSome(drain_buffer_, kMaxDrainPerSubscriber);
-        
-        for (auto& e : drain_buffer_)
-            buffer_.put(std::move(e));
-        
+        (void)bufferDrained(sub);
         return drained > 0;
     }
 
     size_t SeqOrderedExecutor::executeConsecutive()
     {
+        absorbConsumed();
+
         size_t executed = 0;
         ExecEntry entry;
         
         while (buffer_.try_pop_next(entry))
         {
-            entry.invoke(entry.obj, std::move(entry.msg));
+            if (!entry)
+                continue; // consumed marker
+            entry.execute();
             ++executed;
         }
+
+        if (remote_.pendingSize() > 0)
+        {
+            const size_t held = remote_.pendingSize();
+            remote_wake_ns_ = remote_.release();
+            executed += held - remote_.pendingSize();
+        }
         
         return executed;
     }
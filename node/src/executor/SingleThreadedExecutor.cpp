@@ -11,12 +11,11 @@ namespace lux::communication
     void SingleThreadedExecutor::spinSome()
     {
         // Drain all currently ready subscribers (non-blocking).
-        // Fast path: try_dequeue is a cheap CAS on the lock-free queue.
-        // Consume semaphore token only after successful dequeue to stay balanced.
+        // Fast path (ReadyPolicy::Fifo): a cheap CAS on the lock-free queue.
+        pollTimers();
         SubscriberBase* sub = nullptr;
-        while (ready_queue_.try_dequeue(sub))
+        while (tryDequeueReady(sub))
         {
-            (void)ready_sem_.try_acquire_for(std::chrono::milliseconds(0));
             if (sub)
                 handleSubscriber(sub);
         }
@@ -24,7 +23,7 @@ namespace lux::communication
 
     void SingleThreadedExecutor::handleSubscriber(SubscriberBase* sub)
     {
-        sub->takeAll();
+        takeReady(sub);
     }
 
 } // namespace lux::communication
@@ -1,12 +1,14 @@
 #include "lux/communication/executor/TimeOrderedExecutor.hpp"
 #include "lux/communication/SubscriberBase.hpp"
+#include "lux/communication/platform/PlatformDefs.hpp"
 
 namespace lux::communication 
 {
-    TimeOrderedExecutor::TimeOrderedExecutor(std::chrono::nanoseconds time_offset)
-        : time_offset_(time_offset)
+    TimeOrderedExecutor::TimeOrderedExecutor(const TimeOrderedOptions& opts)
+        : merge_(opts.idle_timeout)
     {
         spinning_.store(false);
+        needs_timestamps_ = true;
         drain_buffer_.reserve(64);
     }
 
@@ -17,33 +19,31 @@ namespace lux::communication
 
     void TimeOrderedExecutor::spinSome()
     {
-        // Drain all currently ready subscribers (non-blocking).
+        // Drain all currently ready subscribers (non-blocking), then merge.
+        pollTimers();
         SubscriberBase* sub = nullptr;
-        while (ready_queue_.try_dequeue(sub))
+        while (tryDequeueReady(sub))
         {
-            (void)ready_sem_.try_acquire_for(std::chrono::milliseconds(0));
             if (sub)
                 handleSubscriber(sub);
         }
-        processReadyEntries();
+        merge_.release();
     }
 
     void TimeOrderedExecutor::spin()
     {
         if (spinning_.exchange(true))
             return;
+        applyThreadOptions(0, 1);
 
         while (spinning_)
         {
-            // Execute any buffered entries that are ready
-            processReadyEntries();
-
-            // Try to drain ready subscribers without blocking
+            // Drain every ready subscriber first so the merge sees all sources.
+            pollTimers();
             SubscriberBase* sub = nullptr;
             bool got_work = false;
-            while (ready_queue_.try_dequeue(sub))
+            while (tryDequeueReady(sub))
             {
-                (void)ready_sem_.try_acquire_for(std::chrono::milliseconds(0));
                 if (sub)
                 {
                     handleSubscriber(sub);
@@ -51,14 +51,28 @@ namespace lux::communication
                 }
             }
 
+            const uint64_t wake_at = merge_.release();
             if (got_work)
                 continue;
 
-            // No work available — block-wait for the next ready subscriber.
-            // This avoids 100% CPU polling when idle.
-            sub = waitOneReady();
+            // No work available — block until a subscriber is ready or, if
+            // entries are held back, until the waiting source turns idle.
+            if (wake_at == 0)
+            {
+                sub = waitOneReady();
+            }
+            else
+            {
+                const uint64_t now = platform::steadyNowNs();
+                sub = wake_at > now
+                    ? waitOneReadyTimeout(std::chrono::nanoseconds(wake_at - now))
+                    : nullptr;
+            }
             if (!spinning_)
+            {
+                requeueReady(sub);
                 break;
+            }
             if (sub)
                 handleSubscriber(sub);
         }
@@ -68,24 +82,24 @@ namespace lux::communication
     {
         if (spinning_.exchange(false))
         {
-            ready_sem_.release();
+            ready_ec_.notifyAll();
             notifyCondition();
         }
     }
 
-    void TimeOrderedExecutor::setTimeOffset(std::chrono::nanoseconds offset)
+    void TimeOrderedExecutor::setIdleTimeout(std::chrono::nanoseconds timeout)
     {
-        time_offset_ = offset;
+        merge_.setIdleTimeout(timeout);
     }
 
-    std::chrono::nanoseconds TimeOrderedExecutor::getTimeOffset() const
+    std::chrono::nanoseconds TimeOrderedExecutor::idleTimeout() const
     {
-        return time_offset_;
+        return merge_.idleTimeout();
     }
 
     bool TimeOrderedExecutor::checkRunnable()
     {
-        return !buffer_.empty();
+        return merge_.pendingSize() > 0;
     }
 
     void TimeOrderedExecutor::handleSubscriber(SubscriberBase* sub)
@@ -93,9 +107,8 @@ namespace lux::communication
         if (!sub)
             return;
 
-        // offset=0 fast path: invoke callbacks directly, no reorder needed.
-        // This avoids std::function allocation overhead from drainAll().
-        if (time_offset_.count() == 0)
+        // Sole source with nothing buffered: run it directly.
+        if (merge_.canBypass(sub))
         {
             sub->takeAll();
             return;
@@ -103,30 +116,7 @@ namespace lux::communication
 
         drain_buffer_.clear();
         sub->drainAll(drain_buffer_);
-
-        for (auto& e : drain_buffer_)
-        {
-            if (e.timestamp_ns > max_timestamp_seen_)
-                max_timestamp_seen_ = e.timestamp_ns;
-            buffer_.push(std::move(e));
-        }
-    }
-
-    void TimeOrderedExecutor::processReadyEntries()
-    {
-        if (time_offset_.count() == 0)
-            return;  // offset=0 path executes directly in handleSubscriber
-
-        uint64_t cutoff = 0;
-        if (max_timestamp_seen_ > static_cast<uint64_t>(time_offset_.count()))
-            cutoff = max_timestamp_seen_ - static_cast<uint64_t>(time_offset_.count());
-
-        while (!buffer_.empty() && buffer_.top().timestamp_ns <= cutoff)
-        {
-            TimeExecEntry entry = std::move(const_cast<TimeExecEntry&>(buffer_.top()));
-            buffer_.pop();
-            if (entry.invoker) entry.invoker();
-        }
+        merge_.append(sub, drain_buffer_);
     }
 
 } // namespace lux::communication
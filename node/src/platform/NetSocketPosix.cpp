@@ -11,6 +11,11 @@
 #include <netinet/tcp.h>
 #include <arpa/inet.h>
 
+#if defined(__linux__)
+#include <linux/net_tstamp.h>
+#include <time.h>
+#endif
+
 namespace lux::communication::platform
 {
     // ── netInit / netCleanup — no-op on POSIX ────────────────────────────────────
@@ -60,14 +65,21 @@ namespace lux::communication::platform
     UdpSocket::UdpSocket() = default;
     UdpSocket::~UdpSocket() { close(); }
 
-    UdpSocket::UdpSocket(UdpSocket &&o) noexcept : sock_(o.sock_) { o.sock_ = kInvalidSocket; }
+    UdpSocket::UdpSocket(UdpSocket &&o) noexcept
+        : sock_(o.sock_), txtime_enabled_(o.txtime_enabled_)
+    {
+        o.sock_ = kInvalidSocket;
+        o.txtime_enabled_ = false;
+    }
     UdpSocket &UdpSocket::operator=(UdpSocket &&o) noexcept
     {
         if (this != &o)
         {
             close();
             sock_ = o.sock_;
+            txtime_enabled_ = o.txtime_enabled_;
             o.sock_ = kInvalidSocket;
+            o.txtime_enabled_ = false;
         }
         return *this;
     }
@@ -144,13 +156,11 @@ namespace lux::communication::platform
                      reinterpret_cast<const sockaddr *>(&sa), sizeof(sa)));
     }
 
-    int UdpSocket::sendToV(const IoVec *iov, int iovcnt,
-                           const std::string &dest_addr, uint16_t dest_port)
+    /// sendmsg() with an optional SCM_TXTIME control message.
+    static int sendMsgImpl(int fd, const IoVec *iov, int iovcnt,
+                           const std::string &dest_addr, uint16_t dest_port,
+                           const uint64_t *txtime_ns)
     {
-        if (!ensureSocket())
-            return -1;
-
-        // Use sendmsg for scatter-gather
         auto sa = makeAddr(dest_addr, dest_port);
 
         // iovec and IoVec have identical layout on most platforms,
@@ -170,10 +180,58 @@ namespace lux::communication::platform
         msg.msg_iov = vecs;
         msg.msg_iovlen = cnt;
 
-        ssize_t n = ::sendmsg(sock_, &msg, 0);
+#if defined(SCM_TXTIME)
+        alignas(cmsghdr) char ctrl[CMSG_SPACE(sizeof(uint64_t))]{};
+        if (txtime_ns)
+        {
+            msg.msg_control = ctrl;
+            msg.msg_controllen = sizeof(ctrl);
+            cmsghdr *cm = CMSG_FIRSTHDR(&msg);
+            cm->cmsg_level = SOL_SOCKET;
+            cm->cmsg_type = SCM_TXTIME;
+            cm->cmsg_len = CMSG_LEN(sizeof(uint64_t));
+            std::memcpy(CMSG_DATA(cm), txtime_ns, sizeof(uint64_t));
+        }
+#else
+        (void)txtime_ns;
+#endif
+
+        ssize_t n = ::sendmsg(fd, &msg, 0);
         return static_cast<int>(n);
     }
 
+    int UdpSocket::sendToV(const IoVec *iov, int iovcnt,
+                           const std::string &dest_addr, uint16_t dest_port)
+    {
+        if (!ensureSocket())
+            return -1;
+        // Use sendmsg for scatter-gather
+        return sendMsgImpl(sock_, iov, iovcnt, dest_addr, dest_port, nullptr);
+    }
+
+    int UdpSocket::sendToVAt(const IoVec *iov, int iovcnt,
+                             const std::string &dest_addr, uint16_t dest_port,
+                             uint64_t txtime_ns)
+    {
+        if (!ensureSocket())
+            return -1;
+        return sendMsgImpl(sock_, iov, iovcnt, dest_addr, dest_port,
+                           txtime_enabled_ ? &txtime_ns : nullptr);
+    }
+
+    bool UdpSocket::enableTxTime()
+    {
+        if (!ensureSocket())
+            return false;
+#if defined(__linux__) && defined(SO_TXTIME)
+        sock_txtime cfg{};
+        cfg.clockid = CLOCK_MONOTONIC; // same clock as platform::steadyNowNs()
+        cfg.flags = 0;
+        txtime_enabled_ = ::setsockopt(sock_, SOL_SOCKET, SO_TXTIME, &cfg, sizeof(cfg)) == 0;
+#endif
+        return txtime_enabled_;
+    }
+
     int UdpSocket::recvFrom(void *buf, size_t max_len,
                             std::string &src_addr, uint16_t &src_port)
     {
@@ -196,6 +254,28 @@ namespace lux::communication::platform
         return static_cast<int>(n);
     }
 
+    int UdpSocket::tryRecvFrom(void *buf, size_t max_len,
+                               std::string &src_addr, uint16_t &src_port)
+    {
+        if (sock_ == kInvalidSocket)
+            return -1;
+        sockaddr_in sa{};
+        socklen_t sa_len = sizeof(sa);
+        ssize_t n = ::recvfrom(sock_, buf, max_len, MSG_DONTWAIT,
+                               reinterpret_cast<sockaddr *>(&sa), &sa_len);
+        if (n < 0)
+        {
+            if (errno == EAGAIN || errno == EWOULDBLOCK)
+                return 0;
+            return -1;
+        }
+        char ip_str[INET_ADDRSTRLEN]{};
+        ::inet_ntop(AF_INET, &sa.sin_addr, ip_str, sizeof(ip_str));
+        src_addr = ip_str;
+        src_port = ntohs(sa.sin_port);
+        return static_cast<int>(n);
+    }
+
     uint16_t UdpSocket::localPort() const
     {
         if (sock_ == kInvalidSocket)
@@ -210,6 +290,7 @@ namespace lux::communication::platform
             ::close(sock_);
             sock_ = kInvalidSocket;
         }
+        txtime_enabled_ = false;
     }
 
     // ═════════════════════════════════════════════════════════════════════════════
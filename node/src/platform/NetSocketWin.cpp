@@ -197,6 +197,19 @@ namespace lux::communication::platform
         return (rc == 0) ? static_cast<int>(bytesSent) : -1;
     }
 
+    int UdpSocket::sendToVAt(const IoVec *iov, int iovcnt,
+                             const std::string &dest_addr, uint16_t dest_port,
+                             uint64_t /*txtime_ns*/)
+    {
+        // No per-datagram departure time on Winsock — caller paces in software.
+        return sendToV(iov, iovcnt, dest_addr, dest_port);
+    }
+
+    bool UdpSocket::enableTxTime()
+    {
+        return false;
+    }
+
     int UdpSocket::recvFrom(void *buf, size_t max_len,
                             std::string &src_addr, uint16_t &src_port)
     {
@@ -221,6 +234,21 @@ namespace lux::communication::platform
         return n;
     }
 
+    int UdpSocket::tryRecvFrom(void *buf, size_t max_len,
+                               std::string &src_addr, uint16_t &src_port)
+    {
+        if (sock_ == kInvalidSocket)
+            return -1;
+        // Winsock has no per-call MSG_DONTWAIT; peek at the pending byte
+        // count so a blocking socket never stalls here.
+        u_long pending = 0;
+        if (::ioctlsocket(static_cast<SOCKET>(sock_), FIONREAD, &pending) != 0)
+            return -1;
+        if (pending == 0)
+            return 0;
+        return recvFrom(buf, max_len, src_addr, src_port);
+    }
+
     uint16_t UdpSocket::localPort() const
     {
         if (sock_ == kInvalidSocket)
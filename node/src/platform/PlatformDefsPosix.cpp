@@ -1,7 +1,16 @@
 #include "lux/communication/platform/PlatformDefs.hpp"
 #include <unistd.h>
 #include <time.h>
+#include <pthread.h>
+#include <sched.h>
+#include <algorithm>
+#include <cerrno>
 #include <climits>
+#include <cstring>
+#ifdef __linux__
+#  include <linux/futex.h>
+#  include <sys/syscall.h>
+#endif
 
 namespace lux::communication::platform
 {
@@ -27,4 +36,133 @@ namespace lux::communication::platform
         clock_gettime(CLOCK_MONOTONIC, &ts);
         return static_cast<uint64_t>(ts.tv_sec) * 1000000000ULL + static_cast<uint64_t>(ts.tv_nsec);
     }
+
+    static_assert(sizeof(std::atomic<uint32_t>) == sizeof(uint32_t) &&
+                  std::atomic<uint32_t>::is_always_lock_free,
+                  "futex word must be a plain 32-bit integer");
+
+    bool futexWait(std::atomic<uint32_t> &word, uint32_t expected, uint64_t timeout_ns)
+    {
+#ifdef __linux__
+        struct timespec ts{};
+        struct timespec *rel = nullptr;
+        if (timeout_ns != UINT64_MAX)
+        {
+            ts.tv_sec  = static_cast<time_t>(timeout_ns / 1000000000ULL);
+            ts.tv_nsec = static_cast<long>(timeout_ns % 1000000000ULL);
+            rel        = &ts;
+        }
+        const long rc = syscall(SYS_futex, reinterpret_cast<uint32_t *>(&word),
+                                FUTEX_WAIT_PRIVATE, expected, rel, nullptr, 0);
+        return !(rc == -1 && errno == ETIMEDOUT);
+#else
+        // No futex: poll the word at a coarse interval.
+        const uint64_t deadline = timeout_ns == UINT64_MAX ? UINT64_MAX : steadyNowNs() + timeout_ns;
+        while (word.load(std::memory_order_acquire) == expected)
+        {
+            if (steadyNowNs() >= deadline)
+                return false;
+            struct timespec nap{0, 50000};
+            nanosleep(&nap, nullptr);
+        }
+        return true;
+#endif
+    }
+
+    void futexWake(std::atomic<uint32_t> &word, uint32_t count)
+    {
+#ifdef __linux__
+        syscall(SYS_futex, reinterpret_cast<uint32_t *>(&word), FUTEX_WAKE_PRIVATE,
+                static_cast<int>(std::min<uint32_t>(count, INT_MAX)), nullptr, nullptr, 0);
+#else
+        (void)word;
+        (void)count;
+#endif
+    }
+
+    bool applyThreadOptions(const ThreadOptions &opts, size_t index, size_t count, std::string *error)
+    {
+        bool ok = true;
+        auto fail = [&](const std::string &what, int err)
+        {
+            ok = false;
+            if (!error)
+                return;
+            if (!error->empty())
+                *error += "; ";
+            *error += what + ": " + std::strerror(err);
+        };
+
+        const pthread_t self = pthread_self();
+
+        if (!opts.cpus.empty())
+        {
+#ifdef __linux__
+            cpu_set_t set;
+            CPU_ZERO(&set);
+            if (opts.pin_per_worker)
+            {
+                const uint32_t cpu = opts.cpus[index % opts.cpus.size()];
+                if (cpu < CPU_SETSIZE)
+                    CPU_SET(cpu, &set);
+            }
+            else
+            {
+                for (uint32_t cpu : opts.cpus)
+                {
+                    if (cpu < CPU_SETSIZE)
+                        CPU_SET(cpu, &set);
+                }
+            }
+            if (int rc = pthread_setaffinity_np(self, sizeof(set), &set))
+                fail("cpu affinity", rc);
+#else
+            fail("cpu affinity", ENOTSUP);
+#endif
+        }
+
+        if (opts.sched_policy != SchedPolicy::Inherit)
+        {
+            int policy = SCHED_OTHER;
+            const char *label = "SCHED_OTHER";
+            sched_param param{};
+            if (opts.sched_policy == SchedPolicy::Fifo)
+            {
+                policy = SCHED_FIFO;
+                label = "SCHED_FIFO";
+                param.sched_priority = opts.sched_priority;
+            }
+            else if (opts.sched_policy == SchedPolicy::RoundRobin)
+            {
+                policy = SCHED_RR;
+                label = "SCHED_RR";
+                param.sched_priority = opts.sched_priority;
+            }
+            if (int rc = pthread_setschedparam(self, policy, &param))
+            {
+                std::string what = std::string(label) + " priority " + std::to_string(param.sched_priority);
+                if (rc == EPERM)
+                    what += " (needs CAP_SYS_NICE or RLIMIT_RTPRIO)";
+                fail(what, rc);
+            }
+        }
+
+        if (!opts.name.empty())
+        {
+#if defined(__linux__)
+            const std::string name = workerThreadName(opts.name, index, count, 15);
+            if (int rc = pthread_setname_np(self, name.c_str()))
+                fail("thread name", rc);
+#elif defined(__APPLE__)
+            const std::string name = workerThreadName(opts.name, index, count, 63);
+            if (int rc = pthread_setname_np(name.c_str()))
+                fail("thread name", rc);
+#else
+            (void)count;
+            fail("thread name", ENOTSUP);
+#endif
+        }
+
+        return ok;
+    }
 } // namespace lux::communication::platform
@@ -5,6 +5,8 @@
 #endif
 #include <Windows.h>
 
+#include <algorithm>
+
 namespace lux::communication::platform
 {
     uint32_t currentPid()
@@ -37,4 +39,81 @@ namespace lux::communication::platform
         return static_cast<uint64_t>(now.QuadPart) * 1000000000ULL / static_cast<uint64_t>(freq.QuadPart);
     }
 
+    bool futexWait(std::atomic<uint32_t> &word, uint32_t expected, uint64_t timeout_ns)
+    {
+        DWORD ms = INFINITE;
+        if (timeout_ns != UINT64_MAX)
+            ms = static_cast<DWORD>((std::min)(timeout_ns / 1000000ULL + 1, uint64_t{INFINITE - 1}));
+        if (WaitOnAddress(&word, &expected, sizeof(expected), ms))
+            return true;
+        return GetLastError() != ERROR_TIMEOUT;
+    }
+
+    void futexWake(std::atomic<uint32_t> &word, uint32_t count)
+    {
+        if (count == 1)
+            WakeByAddressSingle(&word);
+        else
+            WakeByAddressAll(&word);
+    }
+
+    bool applyThreadOptions(const ThreadOptions &opts, size_t index, size_t count, std::string *error)
+    {
+        bool ok = true;
+        auto fail = [&](const std::string &what, DWORD err)
+        {
+            ok = false;
+            if (!error)
+                return;
+            if (!error->empty())
+                *error += "; ";
+            *error += what + ": error " + std::to_string(err);
+        };
+
+        const HANDLE self = GetCurrentThread();
+
+        if (!opts.cpus.empty())
+        {
+            // Processor group 0 only (first 64 logical CPUs).
+            DWORD_PTR mask = 0;
+            if (opts.pin_per_worker)
+            {
+                const uint32_t cpu = opts.cpus[index % opts.cpus.size()];
+                if (cpu < 64)
+                    mask = DWORD_PTR{1} << cpu;
+            }
+            else
+            {
+                for (uint32_t cpu : opts.cpus)
+                {
+                    if (cpu < 64)
+                        mask |= DWORD_PTR{1} << cpu;
+                }
+            }
+            if (!mask || !SetThreadAffinityMask(self, mask))
+                fail("cpu affinity", mask ? GetLastError() : ERROR_INVALID_PARAMETER);
+        }
+
+        if (opts.sched_policy != SchedPolicy::Inherit)
+        {
+            // No real-time classes per thread: map Fifo / RR onto the
+            // highest priority of the process class.
+            const int prio = opts.sched_policy == SchedPolicy::Other
+                                 ? THREAD_PRIORITY_NORMAL
+                                 : THREAD_PRIORITY_TIME_CRITICAL;
+            if (!SetThreadPriority(self, prio))
+                fail("thread priority", GetLastError());
+        }
+
+        if (!opts.name.empty())
+        {
+            const std::string name = workerThreadName(opts.name, index, count, 63);
+            const std::wstring wname(name.begin(), name.end());
+            if (FAILED(SetThreadDescription(self, wname.c_str())))
+                fail("thread name", ERROR_INVALID_PARAMETER);
+        }
+
+        return ok;
+    }
+
 } // namespace lux::communication::platform
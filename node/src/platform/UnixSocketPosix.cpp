@@ -0,0 +1,372 @@
+#include "lux/communication/platform/UnixSocket.hpp"
+
+#include <cerrno>
+#include <cstring>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#if !defined(__linux__)
+#include <atomic>
+#include <string>
+#endif
+
+namespace lux::communication::platform
+{
+    bool unixSocketsSupported() { return true; }
+
+    void closeFd(int fd)
+    {
+        if (fd >= 0)
+            ::close(fd);
+    }
+
+    // ── helpers ──────────────────────────────────────────────────────────────────
+
+    static bool makeUnixAddr(const std::string &path, sockaddr_un &sa)
+    {
+        if (path.size() >= sizeof(sa.sun_path))
+            return false;
+        std::memset(&sa, 0, sizeof(sa));
+        sa.sun_family = AF_UNIX;
+        std::memcpy(sa.sun_path, path.c_str(), path.size() + 1);
+        return true;
+    }
+
+    static int newSeqPacketSocket()
+    {
+#if defined(SOCK_CLOEXEC)
+        return ::socket(AF_UNIX, SOCK_SEQPACKET | SOCK_CLOEXEC, 0);
+#else
+        return ::socket(AF_UNIX, SOCK_SEQPACKET, 0);
+#endif
+    }
+
+    // ── UnixSocket ───────────────────────────────────────────────────────────────
+
+    UnixSocket::~UnixSocket() { close(); }
+
+    UnixSocket::UnixSocket(UnixSocket &&o) noexcept : fd_(o.fd_) { o.fd_ = -1; }
+
+    UnixSocket &UnixSocket::operator=(UnixSocket &&o) noexcept
+    {
+        if (this != &o)
+        {
+            close();
+            fd_ = o.fd_;
+            o.fd_ = -1;
+        }
+        return *this;
+    }
+
+    bool UnixSocket::connect(const std::string &path)
+    {
+        sockaddr_un sa;
+        if (!makeUnixAddr(path, sa))
+            return false;
+        close();
+        fd_ = newSeqPacketSocket();
+        if (fd_ < 0)
+            return false;
+        if (::connect(fd_, reinterpret_cast<sockaddr *>(&sa), sizeof(sa)) != 0)
+        {
+            close();
+            return false;
+        }
+        return true;
+    }
+
+    bool UnixSocket::setNonBlocking(bool on)
+    {
+        int flags = ::fcntl(fd_, F_GETFL, 0);
+        if (flags < 0)
+            return false;
+        flags = on ? (flags | O_NONBLOCK) : (flags & ~O_NONBLOCK);
+        return ::fcntl(fd_, F_SETFL, flags) == 0;
+    }
+
+    bool UnixSocket::setSendBufferSize(int bytes)
+    {
+        return ::setsockopt(fd_, SOL_SOCKET, SO_SNDBUF, &bytes, sizeof(bytes)) == 0;
+    }
+
+    bool UnixSocket::setRecvBufferSize(int bytes)
+    {
+        return ::setsockopt(fd_, SOL_SOCKET, SO_RCVBUF, &bytes, sizeof(bytes)) == 0;
+    }
+
+    int UnixSocket::sendV(const IoVec *iov, int iovcnt, int pass_fd)
+    {
+        constexpr int kMaxIov = 8;
+        struct iovec vecs[kMaxIov];
+        int cnt = (iovcnt < kMaxIov) ? iovcnt : kMaxIov;
+        for (int i = 0; i < cnt; ++i)
+        {
+            vecs[i].iov_base = const_cast<void *>(iov[i].base);
+            vecs[i].iov_len = iov[i].len;
+        }
+
+        msghdr msg{};
+        msg.msg_iov = vecs;
+        msg.msg_iovlen = cnt;
+
+        alignas(cmsghdr) char ctrl[CMSG_SPACE(sizeof(int))]{};
+        if (pass_fd >= 0)
+        {
+            msg.msg_control = ctrl;
+            msg.msg_controllen = sizeof(ctrl);
+            cmsghdr *cm = CMSG_FIRSTHDR(&msg);
+            cm->cmsg_level = SOL_SOCKET;
+            cm->cmsg_type = SCM_RIGHTS;
+            cm->cmsg_len = CMSG_LEN(sizeof(int));
+            std::memcpy(CMSG_DATA(cm), &pass_fd, sizeof(int));
+        }
+
+#if defined(MSG_NOSIGNAL)
+        ssize_t n = ::sendmsg(fd_, &msg, MSG_NOSIGNAL);
+#else
+        ssize_t n = ::sendmsg(fd_, &msg, 0);
+#endif
+        if (n < 0)
+            return (errno == EAGAIN || errno == EWOULDBLOCK || errno == ENOBUFS) ? 0 : -1;
+        return static_cast<int>(n);
+    }
+
+    bool UnixSocket::sendAll(const void *data, size_t len)
+    {
+        IoVec iov{data, len};
+        return sendV(&iov, 1) == static_cast<int>(len);
+    }
+
+    int UnixSocket::recv(void *buf, size_t max_len, int &received_fd)
+    {
+        received_fd = -1;
+
+        struct iovec vec{buf, max_len};
+        alignas(cmsghdr) char ctrl[CMSG_SPACE(sizeof(int))]{};
+        msghdr msg{};
+        msg.msg_iov = &vec;
+        msg.msg_iovlen = 1;
+        msg.msg_control = ctrl;
+        msg.msg_controllen = sizeof(ctrl);
+
+#if defined(MSG_CMSG_CLOEXEC)
+        ssize_t n = ::recvmsg(fd_, &msg, MSG_CMSG_CLOEXEC);
+#else
+        ssize_t n = ::recvmsg(fd_, &msg, 0);
+#endif
+        if (n < 0)
+            return -1;
+
+        for (cmsghdr *cm = CMSG_FIRSTHDR(&msg); cm; cm = CMSG_NXTHDR(&msg, cm))
+        {
+            if (cm->cmsg_level == SOL_SOCKET && cm->cmsg_type == SCM_RIGHTS)
+                std::memcpy(&received_fd, CMSG_DATA(cm), sizeof(int));
+        }
+        if (msg.msg_flags & MSG_TRUNC)
+        {
+            // Oversized message: drop it (and any descriptor it carried).
+            closeFd(received_fd);
+            received_fd = -1;
+            errno = EMSGSIZE;
+            return -1;
+        }
+        return static_cast<int>(n);
+    }
+
+    bool UnixSocket::recvExact(void *buf, size_t len)
+    {
+        int fd = -1;
+        int n = recv(buf, len, fd);
+        closeFd(fd);
+        return n == static_cast<int>(len);
+    }
+
+    void UnixSocket::close()
+    {
+        if (fd_ >= 0)
+        {
+            ::close(fd_);
+            fd_ = -1;
+        }
+    }
+
+    // ── UnixListener ─────────────────────────────────────────────────────────────
+
+    UnixListener::~UnixListener() { close(); }
+
+    UnixListener::UnixListener(UnixListener &&o) noexcept
+        : fd_(o.fd_), path_(std::move(o.path_))
+    {
+        o.fd_ = -1;
+        o.path_.clear();
+    }
+
+    UnixListener &UnixListener::operator=(UnixListener &&o) noexcept
+    {
+        if (this != &o)
+        {
+            close();
+            fd_ = o.fd_;
+            path_ = std::move(o.path_);
+            o.fd_ = -1;
+            o.path_.clear();
+        }
+        return *this;
+    }
+
+    bool UnixListener::listen(const std::string &path, int backlog)
+    {
+        sockaddr_un sa;
+        if (!makeUnixAddr(path, sa))
+            return false;
+        close();
+        fd_ = newSeqPacketSocket();
+        if (fd_ < 0)
+            return false;
+
+        ::unlink(path.c_str()); // stale socket from a crashed process
+        if (::bind(fd_, reinterpret_cast<sockaddr *>(&sa), sizeof(sa)) != 0 ||
+            ::listen(fd_, backlog) != 0)
+        {
+            ::close(fd_);
+            fd_ = -1;
+            return false;
+        }
+        path_ = path;
+        return true;
+    }
+
+    UnixSocket UnixListener::accept()
+    {
+#if defined(__linux__)
+        int fd = ::accept4(fd_, nullptr, nullptr, SOCK_CLOEXEC);
+#else
+        int fd = ::accept(fd_, nullptr, nullptr);
+#endif
+        return UnixSocket(fd);
+    }
+
+    void UnixListener::close()
+    {
+        if (fd_ >= 0)
+        {
+            ::close(fd_);
+            fd_ = -1;
+        }
+        if (!path_.empty())
+        {
+            ::unlink(path_.c_str());
+            path_.clear();
+        }
+    }
+
+    // ── MemFdRegion ──────────────────────────────────────────────────────────────
+
+    MemFdRegion::~MemFdRegion() { reset(); }
+
+    MemFdRegion::MemFdRegion(MemFdRegion &&o) noexcept
+        : fd_(o.fd_), data_(o.data_), size_(o.size_)
+    {
+        o.fd_ = -1;
+        o.data_ = nullptr;
+        o.size_ = 0;
+    }
+
+    MemFdRegion &MemFdRegion::operator=(MemFdRegion &&o) noexcept
+    {
+        if (this != &o)
+        {
+            reset();
+            fd_ = o.fd_;
+            data_ = o.data_;
+            size_ = o.size_;
+            o.fd_ = -1;
+            o.data_ = nullptr;
+            o.size_ = 0;
+        }
+        return *this;
+    }
+
+    static int createAnonymousFile()
+    {
+#if defined(__linux__)
+        return ::memfd_create("lux-payload", MFD_CLOEXEC);
+#else
+        // POSIX fallback: a shm object unlinked right away.
+        static std::atomic<uint32_t> counter{0};
+        std::string name = "/lux-payload-" + std::to_string(::getpid()) + "-" +
+                           std::to_string(counter.fetch_add(1));
+        int fd = ::shm_open(name.c_str(), O_RDWR | O_CREAT | O_EXCL, 0600);
+        if (fd >= 0)
+            ::shm_unlink(name.c_str());
+        return fd;
+#endif
+    }
+
+    MemFdRegion MemFdRegion::create(size_t size)
+    {
+        MemFdRegion r;
+        if (size == 0)
+            return r;
+        int fd = createAnonymousFile();
+        if (fd < 0)
+            return r;
+        if (::ftruncate(fd, static_cast<off_t>(size)) != 0)
+        {
+            ::close(fd);
+            return r;
+        }
+        void *p = ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        if (p == MAP_FAILED)
+        {
+            ::close(fd);
+            return r;
+        }
+        r.fd_ = fd;
+        r.data_ = static_cast<uint8_t *>(p);
+        r.size_ = size;
+        return r;
+    }
+
+    MemFdRegion MemFdRegion::mapReadOnly(int fd, size_t size)
+    {
+        MemFdRegion r;
+        if (fd < 0)
+            return r;
+
+        // Never map past the end of what the sender actually created.
+        struct stat st{};
+        if (size == 0 || ::fstat(fd, &st) != 0 || static_cast<size_t>(st.st_size) < size)
+        {
+            ::close(fd);
+            return r;
+        }
+        void *p = ::mmap(nullptr, size, PROT_READ, MAP_SHARED, fd, 0);
+        if (p == MAP_FAILED)
+        {
+            ::close(fd);
+            return r;
+        }
+        r.fd_ = fd;
+        r.data_ = static_cast<uint8_t *>(p);
+        r.size_ = size;
+        return r;
+    }
+
+    void MemFdRegion::reset()
+    {
+        if (data_)
+            ::munmap(data_, size_);
+        if (fd_ >= 0)
+            ::close(fd_);
+        fd_ = -1;
+        data_ = nullptr;
+        size_ = 0;
+    }
+
+} // namespace lux::communication::platform
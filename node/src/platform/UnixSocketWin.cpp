@@ -0,0 +1,56 @@
+#include "lux/communication/platform/UnixSocket.hpp"
+
+// Windows has AF_UNIX stream sockets but neither SOCK_SEQPACKET nor
+// descriptor passing, so the Unix domain socket transport is unavailable;
+// TransportSelector falls back to loopback UDP / TCP.
+
+namespace lux::communication::platform
+{
+    bool unixSocketsSupported() { return false; }
+
+    void closeFd(int) {}
+
+    UnixSocket::~UnixSocket() = default;
+    UnixSocket::UnixSocket(UnixSocket &&o) noexcept : fd_(o.fd_) { o.fd_ = -1; }
+    UnixSocket &UnixSocket::operator=(UnixSocket &&o) noexcept
+    {
+        fd_ = o.fd_;
+        o.fd_ = -1;
+        return *this;
+    }
+
+    bool UnixSocket::connect(const std::string &) { return false; }
+    bool UnixSocket::setNonBlocking(bool) { return false; }
+    bool UnixSocket::setSendBufferSize(int) { return false; }
+    bool UnixSocket::setRecvBufferSize(int) { return false; }
+    int UnixSocket::sendV(const IoVec *, int, int) { return -1; }
+    bool UnixSocket::sendAll(const void *, size_t) { return false; }
+    int UnixSocket::recv(void *, size_t, int &received_fd)
+    {
+        received_fd = -1;
+        return -1;
+    }
+    bool UnixSocket::recvExact(void *, size_t) { return false; }
+    void UnixSocket::close() { fd_ = -1; }
+
+    UnixListener::~UnixListener() = default;
+    UnixListener::UnixListener(UnixListener &&o) noexcept : fd_(o.fd_) { o.fd_ = -1; }
+    UnixListener &UnixListener::operator=(UnixListener &&o) noexcept
+    {
+        fd_ = o.fd_;
+        o.fd_ = -1;
+        return *this;
+    }
+
+    bool UnixListener::listen(const std::string &, int) { return false; }
+    UnixSocket UnixListener::accept() { return UnixSocket(); }
+    void UnixListener::close() { fd_ = -1; }
+
+    MemFdRegion::~MemFdRegion() = default;
+    MemFdRegion::MemFdRegion(MemFdRegion &&) noexcept {}
+    MemFdRegion &MemFdRegion::operator=(MemFdRegion &&) noexcept { return *this; }
+    MemFdRegion MemFdRegion::create(size_t) { return MemFdRegion(); }
+    MemFdRegion MemFdRegion::mapReadOnly(int, size_t) { return MemFdRegion(); }
+    void MemFdRegion::reset() {}
+
+} // namespace lux::communication::platform
@@ -6,10 +6,46 @@
 
 namespace lux::communication::transport
 {
-    FragmentAssembler::FragmentAssembler(std::chrono::milliseconds timeout)
-        : timeout_(timeout) {}
+    FragmentAssembler::FragmentAssembler(std::chrono::milliseconds timeout, size_t max_slots)
+        : slots_(std::max<size_t>(max_slots, 1)), timeout_(timeout) {}
 
-    FragmentAssembler::~FragmentAssembler() = default;
+    // Slots (and the buffers they hold) must go before the pool.
+    FragmentAssembler::~FragmentAssembler() { slots_.clear(); }
+
+    FragmentAssembler::Slot *FragmentAssembler::findSlot(uint64_t topic_hash, uint32_t group_id)
+    {
+        if (in_use_ == 0)
+            return nullptr;
+        for (auto &s : slots_)
+        {
+            if (s.in_use && s.group_id == group_id && s.topic_hash == topic_hash)
+                return &s;
+        }
+        return nullptr;
+    }
+
+    FragmentAssembler::Slot *FragmentAssembler::claimSlot()
+    {
+        Slot *oldest = nullptr;
+        for (auto &s : slots_)
+        {
+            if (!s.in_use)
+                return &s;
+            if (!oldest || s.created_at < oldest->created_at)
+                oldest = &s;
+        }
+        // Table full — the oldest group is the least likely to complete.
+        ++stat_evicted_;
+        freeSlot(*oldest);
+        return oldest;
+    }
+
+    void FragmentAssembler::freeSlot(Slot &slot)
+    {
+        slot.buffer.release();
+        slot.in_use = false;
+        --in_use_;
+    }
 
     std::optional<FragmentAssembler::CompleteMessage>
     FragmentAssembler::feed(const FragmentHeader &fh, const void *payload, size_t len)
@@ -21,35 +57,39 @@ namespace lux::communication::transport
         if (fh.total_msg_size > kMaxFragmentedMsgSize)
             return std::nullopt;
 
-        GroupKey key{fh.topic_hash, fh.group_id};
-        auto it = groups_.find(key);
+        Slot *slot = findSlot(fh.topic_hash, fh.group_id);
 
-        if (it == groups_.end())
+        if (!slot)
         {
             // First fragment of a new group
-            FragmentGroup grp;
-            grp.total_fragments = fh.total_fragments;
-            grp.total_msg_size = fh.total_msg_size;
-            grp.topic_hash = fh.topic_hash;
-            grp.received_count = 0;
-            grp.buffer.resize(fh.total_msg_size, 0);
-            grp.received.resize(fh.total_fragments, false);
-            grp.created_at = std::chrono::steady_clock::now();
-            auto [ins, _] = groups_.emplace(key, std::move(grp));
-            it = ins;
+            auto buffer = pool_.acquire(fh.total_msg_size);
+            if (!buffer)
+                return std::nullopt;
+
+            slot = claimSlot();
+            slot->in_use = true;
+            ++in_use_;
+            slot->topic_hash = fh.topic_hash;
+            slot->group_id = fh.group_id;
+            slot->total_fragments = fh.total_fragments;
+            slot->total_msg_size = fh.total_msg_size;
+            slot->received_count = 0;
+            slot->created_at = std::chrono::steady_clock::now();
+            slot->buffer = std::move(buffer);
+            slot->received.assign((fh.total_fragments + 63u) / 64u, 0);
         }
 
-        auto &grp = it->second;
-
         // Validate consistency
-        if (fh.total_fragments != grp.total_fragments ||
-            fh.total_msg_size != grp.total_msg_size)
+        if (fh.total_fragments != slot->total_fragments ||
+            fh.total_msg_size != slot->total_msg_size)
         {
             return std::nullopt; // inconsistent header — drop
         }
 
         // Check for duplicate
-        if (grp.received[fh.seq_in_group])
+        const uint64_t bit = uint64_t{1} << (fh.seq_in_group & 63u);
+        uint64_t &word = slot->received[fh.seq_in_group >> 6];
+        if (word & bit)
         {
             ++stat_duplicates_;
             return std::nullopt;
@@ -57,19 +97,22 @@ namespace lux::communication::transport
 
         // Copy fragment payload into the correct position
         size_t offset = static_cast<size_t>(fh.seq_in_group) * kMaxFragPayload;
-        size_t copy_len = std::min<size_t>(len, grp.buffer.size() - offset);
-        std::memcpy(grp.buffer.data() + offset, payload, copy_len);
+        if (offset >= slot->total_msg_size)
+            return std::nullopt;
+        size_t copy_len = std::min<size_t>(len, slot->total_msg_size - offset);
+        std::memcpy(slot->buffer.data() + offset, payload, copy_len);
 
-        grp.received[fh.seq_in_group] = true;
-        ++grp.received_count;
+        word |= bit;
+        ++slot->received_count;
 
         // Check if complete
-        if (grp.received_count == grp.total_fragments)
+        if (slot->received_count == slot->total_fragments)
         {
             CompleteMessage msg;
-            msg.data = std::move(grp.buffer);
-            msg.topic_hash = grp.topic_hash;
-            groups_.erase(it);
+            msg.buffer = std::move(slot->buffer);
+            msg.length = slot->total_msg_size;
+            msg.topic_hash = slot->topic_hash;
+            freeSlot(*slot);
             ++stat_complete_;
             return msg;
         }
@@ -79,17 +122,15 @@ namespace lux::communication::transport
 
     void FragmentAssembler::gc()
     {
+        if (in_use_ == 0)
+            return;
         auto now = std::chrono::steady_clock::now();
-        for (auto it = groups_.begin(); it != groups_.end();)
+        for (auto &s : slots_)
         {
-            if (now - it->second.created_at > timeout_)
+            if (s.in_use && now - s.created_at > timeout_)
             {
                 ++stat_timed_out_;
-                it = groups_.erase(it);
-            }
-            else
-            {
-                ++it;
+                freeSlot(s);
             }
         }
     }
@@ -100,15 +141,22 @@ namespace lux::communication::transport
             stat_complete_,
             stat_timed_out_,
             stat_duplicates_,
-            groups_.size()};
+            in_use_,
+            stat_evicted_,
+            pool_.stats().heap_allocations};
     }
 
     void FragmentAssembler::reset()
     {
-        groups_.clear();
+        for (auto &s : slots_)
+        {
+            if (s.in_use)
+                freeSlot(s);
+        }
         stat_complete_ = 0;
         stat_timed_out_ = 0;
         stat_duplicates_ = 0;
+        stat_evicted_ = 0;
     }
 
 } // namespace lux::communication::transport
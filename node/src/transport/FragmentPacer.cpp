@@ -0,0 +1,98 @@
+#include "lux/communication/transport/FragmentPacer.hpp"
+#include "lux/communication/transport/CpuRelax.hpp"
+#include "lux/communication/platform/PlatformDefs.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <thread>
+
+namespace lux::communication::transport
+{
+    namespace
+    {
+        /// Below this, sleeping overshoots more than it saves — spin instead.
+        constexpr uint64_t kSpinThresholdNs = 100'000; // 100 µs
+    } // namespace
+
+    FragmentPacer::FragmentPacer(const PacingConfig &cfg)
+        : cfg_(cfg), rate_(static_cast<double>(cfg.rate_bytes_per_sec))
+    {
+        if (cfg_.max_rate_bytes_per_sec < cfg_.min_rate_bytes_per_sec)
+            cfg_.max_rate_bytes_per_sec = cfg_.min_rate_bytes_per_sec;
+    }
+
+    uint64_t FragmentPacer::reserve(size_t bytes, uint64_t now_ns)
+    {
+        if (!enabled())
+            return now_ns;
+
+        std::lock_guard lock(mutex_);
+        const double ns_per_byte = 1e9 / rate_;
+        const auto burst_ns = static_cast<uint64_t>(cfg_.burst_bytes * ns_per_byte);
+
+        // Idle credit is capped at one burst.
+        if (next_tx_ns_ + burst_ns < now_ns)
+            next_tx_ns_ = now_ns - burst_ns;
+
+        const uint64_t depart = std::max(next_tx_ns_, now_ns);
+        next_tx_ns_ += static_cast<uint64_t>(static_cast<double>(bytes) * ns_per_byte);
+        paced_bytes_ += bytes;
+        return depart;
+    }
+
+    void FragmentPacer::waitUntil(uint64_t t_ns)
+    {
+        uint64_t now = platform::steadyNowNs();
+        if (t_ns > now + kSpinThresholdNs)
+            std::this_thread::sleep_for(std::chrono::nanoseconds(t_ns - now - kSpinThresholdNs));
+        while (platform::steadyNowNs() < t_ns)
+            detail::cpuRelax();
+    }
+
+    void FragmentPacer::onFeedback(uint64_t lost_groups, uint64_t complete_groups, uint64_t srtt_ns)
+    {
+        if (!enabled() || cfg_.congestion == CongestionControl::None)
+            return;
+
+        std::lock_guard lock(mutex_);
+        if (srtt_ns && (min_rtt_ns_ == 0 || srtt_ns < min_rtt_ns_))
+            min_rtt_ns_ = srtt_ns;
+
+        // Queueing delay: SRTT 50 % (and ≥ 1 ms) above the path minimum.
+        const bool delay_signal =
+            cfg_.congestion == CongestionControl::DelayBased && srtt_ns && min_rtt_ns_ &&
+            srtt_ns > min_rtt_ns_ + std::max<uint64_t>(min_rtt_ns_ / 2, 1'000'000);
+
+        const double lo = static_cast<double>(cfg_.min_rate_bytes_per_sec);
+        const double hi = static_cast<double>(cfg_.max_rate_bytes_per_sec);
+
+        if (lost_groups > 0)
+        {
+            rate_ = std::max(lo, rate_ * 0.7);
+            ++decreases_;
+        }
+        else if (delay_signal)
+        {
+            rate_ = std::max(lo, rate_ * 0.85);
+            ++decreases_;
+        }
+        else if (complete_groups > 0 && rate_ < hi)
+        {
+            rate_ = std::min(hi, rate_ + rate_ / 8.0);
+            ++increases_;
+        }
+    }
+
+    uint64_t FragmentPacer::rate() const
+    {
+        std::lock_guard lock(mutex_);
+        return static_cast<uint64_t>(rate_);
+    }
+
+    FragmentPacer::Stats FragmentPacer::stats() const
+    {
+        std::lock_guard lock(mutex_);
+        return Stats{static_cast<uint64_t>(rate_), paced_bytes_, decreases_, increases_};
+    }
+
+} // namespace lux::communication::transport
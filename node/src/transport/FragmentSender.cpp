@@ -1,6 +1,8 @@
 #include "lux/communication/transport/FragmentSender.hpp"
 #include "lux/communication/transport/FragmentHeader.hpp"
 #include "lux/communication/transport/NetConstants.hpp"
+#include "lux/communication/transport/FragmentPacer.hpp"
+#include "lux/communication/platform/PlatformDefs.hpp"
 
 #include <algorithm>
 #include <cstring>
@@ -12,7 +14,8 @@ namespace lux::communication::transport
     bool FragmentSender::send(uint32_t group_id,
                               const void *data, size_t len,
                               uint64_t topic_hash,
-                              const std::string &dest_addr, uint16_t dest_port)
+                              const std::string &dest_addr, uint16_t dest_port,
+                              FragmentPacer *pacer)
     {
         if (len == 0 || len > kMaxFragmentedMsgSize)
             return false;
@@ -21,6 +24,8 @@ namespace lux::communication::transport
             (len + kMaxFragPayload - 1) / kMaxFragPayload);
         const auto *src = static_cast<const uint8_t *>(data);
         size_t offset = 0;
+        const bool paced = pacer && pacer->enabled();
+        const bool kernel_paced = paced && pacer->kernelPacing() && sock_.txTimeEnabled();
 
         for (uint16_t i = 0; i < total_frags; ++i)
         {
@@ -40,7 +45,26 @@ namespace lux::communication::transport
             platform::IoVec iov[2] = {
                 {&fh, sizeof(fh)},
                 {src + offset, frag_size}};
-            int sent = sock_.sendToV(iov, 2, dest_addr, dest_port);
+            int sent;
+            if (paced)
+            {
+                // On-wire size, so the rate matches what the link carries.
+                const uint64_t depart = pacer->reserve(
+                    sizeof(fh) + frag_size + kIpUdpOverhead, platform::steadyNowNs());
+                if (kernel_paced)
+                {
+                    sent = sock_.sendToVAt(iov, 2, dest_addr, dest_port, depart);
+                }
+                else
+                {
+                    FragmentPacer::waitUntil(depart);
+                    sent = sock_.sendToV(iov, 2, dest_addr, dest_port);
+                }
+            }
+            else
+            {
+                sent = sock_.sendToV(iov, 2, dest_addr, dest_port);
+            }
             if (sent < 0)
                 return false;
 
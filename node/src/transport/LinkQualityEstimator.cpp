@@ -0,0 +1,158 @@
+#include "lux/communication/transport/LinkQualityEstimator.hpp"
+#include "lux/communication/transport/NetConstants.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace lux::communication::transport
+{
+    namespace
+    {
+        constexpr uint64_t toNs(std::chrono::milliseconds ms)
+        {
+            return static_cast<uint64_t>(ms.count()) * 1'000'000ull;
+        }
+    } // namespace
+
+    LinkQualityEstimator::LinkQualityEstimator(const LinkQualityConfig &cfg)
+        : cfg_(cfg)
+    {
+        cfg_.min_udp_threshold = std::max<uint32_t>(cfg_.min_udp_threshold, 1);
+        cfg_.max_udp_threshold = std::max(cfg_.max_udp_threshold, cfg_.min_udp_threshold);
+        cfg_.hysteresis = std::max(cfg_.hysteresis, 1.0);
+    }
+
+    void LinkQualityEstimator::onGroupSent(uint32_t fragments)
+    {
+        if (fragments == 0)
+            return;
+        // Slow EWMA — only used to convert group loss into fragment loss.
+        avg_frags_per_group_ += (static_cast<double>(fragments) - avg_frags_per_group_) / 16.0;
+        avg_frags_per_group_ = std::max(avg_frags_per_group_, 1.0);
+    }
+
+    void LinkQualityEstimator::onReport(const LinkReport &rep, uint64_t now_ns)
+    {
+        // Counters are cumulative: a decrease means a reordered (older) report.
+        if (rep.complete_groups < last_complete_ || rep.lost_groups < last_lost_)
+            return;
+
+        ++reports_;
+        last_report_ns_ = now_ns;
+
+        // ── Loss ──
+        const uint64_t dc = rep.complete_groups - last_complete_;
+        const uint64_t dt = rep.lost_groups - last_lost_;
+        last_complete_ = rep.complete_groups;
+        last_lost_ = rep.lost_groups;
+
+        const bool have_loss_sample = (dc + dt) > 0;
+        if (have_loss_sample)
+        {
+            // P(group ok) = (1 - p)^n  →  p = 1 - (1 - L)^(1/n)
+            const double group_loss = static_cast<double>(dt) / static_cast<double>(dc + dt);
+            const double p = group_loss >= 1.0
+                                 ? 1.0
+                                 : 1.0 - std::pow(1.0 - group_loss, 1.0 / avg_frags_per_group_);
+
+            frag_loss_ = has_loss_sample_ ? frag_loss_ + cfg_.loss_alpha * (p - frag_loss_) : p;
+            has_loss_sample_ = true;
+            last_loss_sample_ns_ = now_ns;
+        }
+
+        // ── RTT ──
+        if (rep.echo_timestamp_ns != 0 && rep.echo_timestamp_ns != last_echo_ts_ &&
+            now_ns > rep.echo_timestamp_ns + rep.echo_delay_ns)
+        {
+            last_echo_ts_ = rep.echo_timestamp_ns;
+            const uint64_t sample = now_ns - rep.echo_timestamp_ns - rep.echo_delay_ns;
+            if (srtt_ns_ == 0)
+                srtt_ns_ = sample;
+            else
+                srtt_ns_ = static_cast<uint64_t>(
+                    static_cast<double>(srtt_ns_) +
+                    cfg_.rtt_alpha * (static_cast<double>(sample) - static_cast<double>(srtt_ns_)));
+        }
+
+        if (has_loss_sample_)
+            updateThreshold(have_loss_sample, now_ns);
+    }
+
+    void LinkQualityEstimator::updateThreshold(bool have_loss_sample, uint64_t now_ns)
+    {
+        // Largest fragment count n with (1 - p)^n ≥ 1 - target.
+        double candidate_bytes;
+        if (frag_loss_ <= 1e-9)
+            candidate_bytes = cfg_.max_udp_threshold;
+        else if (frag_loss_ >= 1.0)
+            candidate_bytes = cfg_.min_udp_threshold;
+        else
+            candidate_bytes = std::log(1.0 - cfg_.target_msg_loss) /
+                              std::log(1.0 - frag_loss_) * kMaxFragPayload;
+
+        const auto candidate = static_cast<uint32_t>(std::clamp<double>(
+            candidate_bytes, cfg_.min_udp_threshold, cfg_.max_udp_threshold));
+
+        auto apply = [&](uint32_t v)
+        {
+            if (v == threshold_)
+                return;
+            threshold_ = v;
+            last_change_ns_ = now_ns;
+            ++threshold_changes_;
+        };
+
+        if (threshold_ == 0)
+        {
+            apply(candidate);
+            return;
+        }
+
+        const double cur = threshold_;
+        if (candidate * cfg_.hysteresis < cur)
+        {
+            // Loss went up: shrink immediately.
+            apply(candidate);
+        }
+        else if (candidate > cur * cfg_.hysteresis &&
+                 now_ns - last_change_ns_ >= toNs(cfg_.min_dwell))
+        {
+            // Loss went down: grow at most ×2 per dwell period.
+            apply(std::min<uint32_t>(candidate, static_cast<uint32_t>(
+                                                    std::min<double>(cur * 2.0, cfg_.max_udp_threshold))));
+        }
+        else if (!have_loss_sample &&
+                 now_ns - last_loss_sample_ns_ >= toNs(cfg_.probe_interval) &&
+                 now_ns - last_change_ns_ >= toNs(cfg_.probe_interval))
+        {
+            // Nothing fragmented has crossed UDP for a while (it all went to
+            // TCP): forget some of the old loss and probe a larger size.
+            frag_loss_ *= (1.0 - cfg_.loss_alpha);
+            apply(static_cast<uint32_t>(std::min<double>(cur * 2.0, cfg_.max_udp_threshold)));
+        }
+    }
+
+    bool LinkQualityEstimator::hasEstimate(uint64_t now_ns) const
+    {
+        if (!has_loss_sample_ || threshold_ == 0)
+            return false;
+        const uint64_t stale = std::max(toNs(cfg_.stale_timeout), srtt_ns_ * 8);
+        return now_ns - last_report_ns_ <= stale;
+    }
+
+    uint32_t LinkQualityEstimator::udpThreshold(uint32_t fallback, uint64_t now_ns) const
+    {
+        return hasEstimate(now_ns) ? threshold_ : fallback;
+    }
+
+    LinkQualityEstimator::Stats LinkQualityEstimator::stats() const
+    {
+        return Stats{frag_loss_, srtt_ns_, threshold_, reports_, threshold_changes_};
+    }
+
+    void LinkQualityEstimator::reset()
+    {
+        *this = LinkQualityEstimator(cfg_);
+    }
+
+} // namespace lux::communication::transport
@@ -0,0 +1,91 @@
+#include "lux/communication/transport/ReassemblyBufferPool.hpp"
+
+#include <algorithm>
+#include <bit>
+
+namespace lux::communication::transport
+{
+    namespace
+    {
+        constexpr size_t kPageSize = 4096;
+    } // namespace
+
+    ReassemblyBufferPool::ReassemblyBufferPool(size_t max_retained_bytes)
+        : max_retained_bytes_(max_retained_bytes)
+    {
+    }
+
+    ReassemblyBufferPool::~ReassemblyBufferPool()
+    {
+        for (auto &list : free_)
+            for (uint8_t *p : list)
+                delete[] p;
+    }
+
+    int ReassemblyBufferPool::classFor(size_t size)
+    {
+        if (size > classSize(kNumClasses - 1))
+            return -1;
+        const size_t rounded = std::bit_ceil(std::max<size_t>(size, size_t{1} << kMinClassShift));
+        return static_cast<int>(std::countr_zero(rounded)) - static_cast<int>(kMinClassShift);
+    }
+
+    uint8_t *ReassemblyBufferPool::allocateTouched(size_t bytes)
+    {
+        auto *p = new uint8_t[bytes];
+        // Fault every page in now rather than during the first reassembly.
+        for (size_t off = 0; off < bytes; off += kPageSize)
+            p[off] = 0;
+        return p;
+    }
+
+    PooledBuffer ReassemblyBufferPool::acquire(size_t size)
+    {
+        const int cls = classFor(size);
+        if (cls < 0)
+            return {};
+
+        auto &list = free_[cls];
+        const size_t cap = classSize(cls);
+        if (!list.empty())
+        {
+            uint8_t *p = list.back();
+            list.pop_back();
+            retained_bytes_ -= cap;
+            ++reuses_;
+            return PooledBuffer(this, p, cap, static_cast<uint8_t>(cls));
+        }
+
+        ++heap_allocations_;
+        return PooledBuffer(this, allocateTouched(cap), cap, static_cast<uint8_t>(cls));
+    }
+
+    void ReassemblyBufferPool::prewarm(size_t size, size_t count)
+    {
+        const int cls = classFor(size);
+        if (cls < 0)
+            return;
+        const size_t cap = classSize(cls);
+        auto &list = free_[cls];
+        list.reserve(list.size() + count);
+        for (size_t i = 0; i < count && retained_bytes_ + cap <= max_retained_bytes_; ++i)
+        {
+            list.push_back(allocateTouched(cap));
+            retained_bytes_ += cap;
+            ++heap_allocations_;
+        }
+    }
+
+    void ReassemblyBufferPool::giveBack(uint8_t *data, uint8_t size_class)
+    {
+        const size_t cap = classSize(size_class);
+        if (retained_bytes_ + cap > max_retained_bytes_)
+        {
+            delete[] data;
+            return;
+        }
+        free_[size_class].push_back(data);
+        retained_bytes_ += cap;
+    }
+
+} // namespace lux::communication::transport
@@ -76,7 +76,7 @@ namespace lux::communication::transport
     }
 
     ShmRingWriter::ShmRingWriter(ShmRingWriter &&other) noexcept
-        : shm_(other.shm_), header_(other.header_), slot_count_(other.slot_count_), slot_size_(other.slot_size_), cached_read_seq_(other.cached_read_seq_), shm_name_(std::move(other.shm_name_)), notifier_(std::move(other.notifier_))
+        : shm_(other.shm_), header_(other.header_), slot_count_(other.slot_count_), slot_size_(other.slot_size_), cached_read_seq_(other.cached_read_seq_), reserve_seq_(other.reserve_seq_), last_slot_(other.last_slot_), shm_name_(std::move(other.shm_name_)), notifier_(std::move(other.notifier_))
     {
         other.shm_ = nullptr;
         other.header_ = nullptr;
@@ -98,6 +98,8 @@ namespace lux::communication::transport
             slot_count_ = other.slot_count_;
             slot_size_ = other.slot_size_;
             cached_read_seq_ = other.cached_read_seq_;
+            reserve_seq_ = other.reserve_seq_;
+            last_slot_ = other.last_slot_;
             shm_name_ = std::move(other.shm_name_);
             notifier_ = std::move(other.notifier_);
 
@@ -109,7 +111,7 @@ namespace lux::communication::transport
 
     void *ShmRingWriter::acquireSlot()
     {
-        const uint64_t wseq = header_->writer.write_seq.load(std::memory_order_relaxed);
+        const uint64_t wseq = reserve_seq_;
 
         // Check if ring is full (using cached read_seq first to avoid cross-process load).
         if (wseq - cached_read_seq_ >= slot_count_)
@@ -123,17 +125,24 @@ namespace lux::communication::transport
         const uint32_t idx = static_cast<uint32_t>(wseq & (slot_count_ - 1));
         auto *slot = static_cast<SlotHeader *>(slotAt(header_, idx, slot_size_));
 
-        // Mark as Writing (informational; the SPSC invariant already protects us).
+        // Writing until committed: advanceWriteSeq() stops at this slot.
         slot->state.store(static_cast<uint32_t>(SlotState::Writing),
                           std::memory_order_relaxed);
 
-        return slotPayload(slot);
+        reserve_seq_ = wseq + 1;
+        last_slot_ = slotPayload(slot);
+        return last_slot_;
     }
 
     void ShmRingWriter::commitSlot(uint32_t payload_size)
     {
-        const uint64_t wseq = header_->writer.write_seq.load(std::memory_order_relaxed);
-        const uint32_t idx = static_cast<uint32_t>(wseq & (slot_count_ - 1));
+        commitSlot(last_slot_, payload_size);
+    }
+
+    void ShmRingWriter::commitSlot(const void *payload, uint32_t payload_size)
+    {
+        const uint64_t seq = reservedSeq(payload);
+        const uint32_t idx = static_cast<uint32_t>(seq & (slot_count_ - 1));
         auto *slot = static_cast<SlotHeader *>(slotAt(header_, idx, slot_size_));
 
         slot->payload_size = payload_size;
@@ -141,23 +150,69 @@ namespace lux::communication::transport
         slot->state.store(static_cast<uint32_t>(SlotState::Ready),
                           std::memory_order_release);
 
-        // Advance write_seq (release so reader sees it after slot state).
-        header_->writer.write_seq.store(wseq + 1, std::memory_order_release);
-
-        // Bump futex word (so waiters can detect change) and wake reader.
-        header_->notify.futex_word.fetch_add(1, std::memory_order_release);
-        notifier_->wake();
+        advanceWriteSeq();
     }
 
     void ShmRingWriter::cancelSlot()
     {
-        const uint64_t wseq = header_->writer.write_seq.load(std::memory_order_relaxed);
-        const uint32_t idx = static_cast<uint32_t>(wseq & (slot_count_ - 1));
+        cancelSlot(last_slot_);
+    }
+
+    void ShmRingWriter::cancelSlot(const void *payload)
+    {
+        const uint64_t seq = reservedSeq(payload);
+        const uint32_t idx = static_cast<uint32_t>(seq & (slot_count_ - 1));
         auto *slot = static_cast<SlotHeader *>(slotAt(header_, idx, slot_size_));
 
-        // Reset slot to Free WITHOUT advancing write_seq.
-        slot->state.store(static_cast<uint32_t>(SlotState::Free),
+        if (seq + 1 == reserve_seq_)
+        {
+            // Newest reservation: hand the slot out again, write_seq untouched.
+            reserve_seq_ = seq;
+            slot->state.store(static_cast<uint32_t>(SlotState::Free),
+                              std::memory_order_release);
+            return;
+        }
+
+        // Slots behind it are reserved: commit it empty so they can be read.
+        slot->payload_size = 0;
+        slot->state.store(static_cast<uint32_t>(SlotState::Ready),
                           std::memory_order_release);
+        advanceWriteSeq();
+    }
+
+    uint64_t ShmRingWriter::reservedSeq(const void *payload) const
+    {
+        const auto *base = reinterpret_cast<const char *>(slotAt(header_, 0, slot_size_));
+        const auto idx = static_cast<uint64_t>(
+            (static_cast<const char *>(payload) - sizeof(SlotHeader) - base) / slot_size_);
+        // Reservations span less than one lap, so the index names one seq.
+        const uint64_t wseq = header_->writer.write_seq.load(std::memory_order_relaxed);
+        const uint64_t seq = wseq + ((idx - wseq) & (slot_count_ - 1));
+        assert(seq < reserve_seq_);
+        return seq;
+    }
+
+    void ShmRingWriter::advanceWriteSeq()
+    {
+        const uint64_t old_seq = header_->writer.write_seq.load(std::memory_order_relaxed);
+        uint64_t wseq = old_seq;
+        while (wseq < reserve_seq_)
+        {
+            const uint32_t idx = static_cast<uint32_t>(wseq & (slot_count_ - 1));
+            auto *slot = static_cast<SlotHeader *>(slotAt(header_, idx, slot_size_));
+            if (slot->state.load(std::memory_order_relaxed) != static_cast<uint32_t>(SlotState::Ready))
+                break; // still loaned out
+            ++wseq;
+        }
+        if (wseq == old_seq)
+            return;
+
+        // Advance write_seq (release so reader sees it after slot state).
+        header_->writer.write_seq.store(wseq, std::memory_order_release);
+
+        // Bump futex word (so waiters can detect change) and wake reader.
+        header_->notify.futex_word.fetch_add(1, std::memory_order_release);
+        notifier_->wake();
     }
 
     bool ShmRingWriter::write(const void *data, uint32_t size)
@@ -167,15 +222,8 @@ namespace lux::communication::transport
             return false;
         if (size > maxPayloadSize())
         {
-            // Can't fit; roll back by not committing. The slot will stay in
-            // Writing state and be reclaimed on next acquireSlot for the same
-            // index — but since SPSC, the writer never re-visits a slot that
-            // wasn't committed unless the ring wraps.  Mark it Free explicitly.
-            const uint64_t wseq = header_->writer.write_seq.load(std::memory_order_relaxed);
-            const uint32_t idx = static_cast<uint32_t>(wseq & (slot_count_ - 1));
-            auto *slot = static_cast<SlotHeader *>(slotAt(header_, idx, slot_size_));
-            slot->state.store(static_cast<uint32_t>(SlotState::Free),
-                              std::memory_order_relaxed);
+            // Can't fit; give the reservation back.
+            cancelSlot(payload);
             return false;
         }
         std::memcpy(payload, data, size);
@@ -185,9 +233,8 @@ namespace lux::communication::transport
 
     bool ShmRingWriter::isFull() const
     {
-        const uint64_t wseq = header_->writer.write_seq.load(std::memory_order_relaxed);
         const uint64_t rseq = header_->reader.read_seq.load(std::memory_order_acquire);
-        return (wseq - rseq) >= slot_count_;
+        return (reserve_seq_ - rseq) >= slot_count_;
     }
 
     uint32_t ShmRingWriter::maxPayloadSize() const
@@ -169,6 +169,25 @@ namespace lux::communication::transport
         return ok_count;
     }
 
+    uint32_t TcpTransportWriter::sendFrames(const void *frames, size_t size)
+    {
+        std::lock_guard lock(conn_mutex_);
+        uint32_t ok_count = 0;
+
+        for (auto it = connections_.begin(); it != connections_.end();)
+        {
+            if (!(*it)->sock.sendAll(frames, size))
+            {
+                // Connection broken — remove
+                it = connections_.erase(it);
+                continue;
+            }
+            ++ok_count;
+            ++it;
+        }
+        return ok_count;
+    }
+
     platform::socket_t TcpTransportWriter::listenFd() const
     {
         return listener_.nativeFd();
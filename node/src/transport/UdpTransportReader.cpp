@@ -1,13 +1,17 @@
 #include "lux/communication/transport/UdpTransportReader.hpp"
 #include "lux/communication/transport/NetConstants.hpp"
 #include "lux/communication/transport/FragmentHeader.hpp"
+#include "lux/communication/transport/LinkReport.hpp"
+#include "lux/communication/transport/CompactFrameHeader.hpp"
+#include "lux/communication/platform/PlatformDefs.hpp"
 
 #include <cstring>
 
 namespace lux::communication::transport
 {
     UdpTransportReader::UdpTransportReader(uint16_t bind_port)
-        : recv_buf_(kMaxUdpPayload + 64) // a little extra for safety
+        : assembler_(std::make_unique<FragmentAssembler>()),
+          recv_buf_(kMaxUdpPayload + 64) // a little extra for safety
     {
         sock_.setReuseAddr(true);
         sock_.bindAny(bind_port);
@@ -34,6 +38,14 @@ namespace lux::communication::transport
         const auto recv_len = static_cast<size_t>(n);
         const auto *raw = recv_buf_.data();
 
+        // Remember the sender so LinkReports can be returned to it (and so
+        // compact frames resolve against that sender's bindings).
+        if (src_port != report_port_ || src_addr != report_addr_)
+        {
+            report_addr_ = std::move(src_addr);
+            report_port_ = src_port;
+        }
+
         // ── Check if this is a fragment ──
         if (recv_len >= sizeof(FragmentHeader) && isFragment(raw, recv_len))
         {
@@ -42,37 +54,67 @@ namespace lux::communication::transport
             const void *frag_payload = raw + sizeof(FragmentHeader);
             size_t frag_payload_len = recv_len - sizeof(FragmentHeader);
 
-            auto result = assembler_.feed(fh, frag_payload, frag_payload_len);
+            auto result = assembler_->feed(fh, frag_payload, frag_payload_len);
             if (result && cb)
             {
-                // Reassembled: data contains FrameHeader + payload
-                if (result->data.size() >= sizeof(FrameHeader))
+                // Reassembled: data contains FrameHeader + payload.  The pooled
+                // buffer is lent to the callback and returns to the pool on scope exit.
+                if (result->size() >= sizeof(FrameHeader))
                 {
                     FrameHeader hdr;
-                    std::memcpy(&hdr, result->data.data(), sizeof(FrameHeader));
-                    const void *payload = result->data.data() + sizeof(FrameHeader);
+                    std::memcpy(&hdr, result->data(), sizeof(FrameHeader));
+                    const void *payload = result->data() + sizeof(FrameHeader);
                     uint32_t payload_sz = static_cast<uint32_t>(
-                        result->data.size() - sizeof(FrameHeader));
+                        result->size() - sizeof(FrameHeader));
 
                     // Mark as reassembled (bit 6)
                     hdr.flags |= 0x40; // kFlagReassembled
 
+                    noteFrame(hdr);
                     cb(hdr, payload, payload_sz);
                 }
             }
             return true;
         }
 
+        // ── Compact-header frame (negotiated) ──
+        if (isCompactFrame(raw, recv_len))
+        {
+            CompactFields f;
+            const size_t hdr_len = parseCompactHeader(raw, recv_len, f);
+            if (hdr_len == 0)
+                return true;
+            const SenderBinding *b = findBinding(f.topic_id);
+            if (!b || (b->base.epoch & 0x0F) != f.epoch)
+            {
+                ++compact_unbound_; // binding frame lost or reordered — drop
+                return true;
+            }
+            ++compact_received_;
+            const FrameHeader hdr = expandCompactHeader(
+                f, b->base, static_cast<uint32_t>(recv_len - hdr_len));
+            noteFrame(hdr);
+            if (cb)
+                cb(hdr, raw + hdr_len, hdr.payload_size);
+            return true;
+        }
+
         // ── Single-datagram frame ──
         if (recv_len >= sizeof(FrameHeader))
         {
             FrameHeader hdr;
             std::memcpy(&hdr, raw, sizeof(FrameHeader));
-            if (isValidFrame(hdr) && cb)
+            if (isValidFrame(hdr))
             {
-                const void *payload = raw + sizeof(FrameHeader);
-                uint32_t payload_sz = static_cast<uint32_t>(recv_len - sizeof(FrameHeader));
-                cb(hdr, payload, payload_sz);
+                if (isCompactBinding(hdr))
+                    bindCompact(hdr);
+                noteFrame(hdr);
+                if (cb)
+                {
+                    const void *payload = raw + sizeof(FrameHeader);
+                    uint32_t payload_sz = static_cast<uint32_t>(recv_len - sizeof(FrameHeader));
+                    cb(hdr, payload, payload_sz);
+                }
             }
             return true;
         }
@@ -82,7 +124,80 @@ namespace lux::communication::transport
 
     void UdpTransportReader::gc()
     {
-        assembler_.gc();
+        if (assembler_)
+            assembler_->gc();
+    }
+
+    void UdpTransportReader::bindCompact(const FrameHeader &hdr)
+    {
+        const uint16_t topic_id = compactBindTopicId(hdr);
+        SenderBinding *slot = nullptr;
+        for (auto &b : bindings_)
+        {
+            if (b.topic_id == topic_id && b.port == report_port_ && b.addr == report_addr_)
+            {
+                slot = &b;
+                break;
+            }
+        }
+        if (!slot)
+        {
+            // Bounded: a reader normally hears from a handful of writers.
+            if (bindings_.size() >= 64)
+                bindings_.erase(bindings_.begin());
+            slot = &bindings_.emplace_back();
+            slot->addr = report_addr_;
+            slot->port = report_port_;
+            slot->topic_id = topic_id;
+        }
+        slot->base.topic_hash = hdr.topic_hash;
+        slot->base.base_seq = hdr.seq_num;
+        slot->base.base_timestamp_ns = hdr.timestamp_ns;
+        slot->base.publisher_id = hdr.publisher_id;
+        slot->base.flags = hdr.flags;
+        slot->base.epoch = compactBindEpoch(hdr);
+    }
+
+    const UdpTransportReader::SenderBinding *UdpTransportReader::findBinding(uint16_t topic_id) const
+    {
+        for (const auto &b : bindings_)
+        {
+            if (b.topic_id == topic_id && b.port == report_port_ && b.addr == report_addr_)
+                return &b;
+        }
+        return nullptr;
+    }
+
+    void UdpTransportReader::noteFrame(const FrameHeader &hdr)
+    {
+        last_topic_hash_ = hdr.topic_hash;
+        last_echo_ts_ = hdr.timestamp_ns;
+        last_echo_recv_ns_ = platform::steadyNowNs();
+    }
+
+    bool UdpTransportReader::sendLinkReport()
+    {
+        if (!sock_.isValid() || report_port_ == 0)
+            return false;
+
+        const uint64_t now = platform::steadyNowNs();
+        if (now - last_report_ns_ < static_cast<uint64_t>(kLinkReportIntervalMs) * 1'000'000ull)
+            return false;
+        last_report_ns_ = now;
+
+        const auto st = assembler_->stats();
+        LinkReport rep;
+        rep.capabilities = kLinkCapCompactHeader;
+        rep.topic_hash = last_topic_hash_;
+        rep.complete_groups = st.complete_messages;
+        // An evicted group never completes either: under reassembly
+        // pressure it is loss just like a timeout.
+        rep.lost_groups = st.timed_out_groups + st.evicted_groups;
+        rep.echo_timestamp_ns = last_echo_ts_;
+        rep.echo_delay_ns = last_echo_ts_ ? now - last_echo_recv_ns_ : 0;
+
+        return sock_.sendTo(&rep, sizeof(rep), report_addr_, report_port_) ==
+               static_cast<int>(sizeof(rep));
     }
 
     void UdpTransportReader::close()
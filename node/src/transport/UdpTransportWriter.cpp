@@ -1,43 +1,69 @@
 #include "lux/communication/transport/UdpTransportWriter.hpp"
 #include "lux/communication/transport/NetConstants.hpp"
+#include "lux/communication/transport/LinkReport.hpp"
+#include "lux/communication/platform/PlatformDefs.hpp"
 
 #include <cstring>
 #include <vector>
 
 namespace lux::communication::transport
 {
-    UdpTransportWriter::UdpTransportWriter(const std::string &dest_addr, uint16_t dest_port)
-        : dest_addr_(dest_addr), dest_port_(dest_port)
+    UdpTransportWriter::UdpTransportWriter(const std::string &dest_addr, uint16_t dest_port,
+                                           const LinkQualityConfig &link_cfg)
+        : dest_addr_(dest_addr), dest_port_(dest_port), link_(link_cfg)
     {
         frag_sender_ = std::make_unique<FragmentSender>(sock_);
     }
 
     UdpTransportWriter::~UdpTransportWriter() { close(); }
 
-    UdpTransportWriter::UdpTransportWriter(UdpTransportWriter &&o) noexcept
-        : sock_(std::move(o.sock_)),
-          dest_addr_(std::move(o.dest_addr_)),
-          dest_port_(o.dest_port_),
-          frag_sender_(std::move(o.frag_sender_)),
-          next_group_id_(o.next_group_id_.load(std::memory_order_relaxed))
+    // The sender thread and FragmentSender refer to this object's socket, so a
+    // move drains the source's backlog and rebinds the FragmentSender.  Not
+    // noexcept: draining joins the source's sender thread.
+    UdpTransportWriter::UdpTransportWriter(UdpTransportWriter &&o)
+        : dest_port_(0)
     {
+        o.stopSender(true);
+        moveFrom(o);
     }
 
-    UdpTransportWriter &UdpTransportWriter::operator=(UdpTransportWriter &&o) noexcept
+    UdpTransportWriter &UdpTransportWriter::operator=(UdpTransportWriter &&o)
     {
         if (this != &o)
         {
             close();
-            sock_ = std::move(o.sock_);
-            dest_addr_ = std::move(o.dest_addr_);
-            dest_port_ = o.dest_port_;
-            frag_sender_ = std::move(o.frag_sender_);
-            next_group_id_.store(o.next_group_id_.load(std::memory_order_relaxed),
-                                 std::memory_order_relaxed);
+            o.stopSender(true);
+            moveFrom(o);
         }
         return *this;
     }
 
+    void UdpTransportWriter::moveFrom(UdpTransportWriter &o)
+    {
+        sock_ = std::move(o.sock_);
+        dest_addr_ = std::move(o.dest_addr_);
+        dest_port_ = o.dest_port_;
+        frag_sender_ = std::make_unique<FragmentSender>(sock_);
+        o.frag_sender_.reset();
+        next_group_id_.store(o.next_group_id_.load(std::memory_order_relaxed),
+                             std::memory_order_relaxed);
+        link_ = o.link_;
+        last_complete_groups_ = o.last_complete_groups_;
+        last_lost_groups_ = o.last_lost_groups_;
+        compact_allowed_ = o.compact_allowed_;
+        peer_compact_.store(o.peer_compact_.load(std::memory_order_relaxed),
+                            std::memory_order_relaxed);
+        bound_ = o.bound_;
+        binding_ = o.binding_;
+        topic_id_ = o.topic_id_;
+        frames_since_bind_ = o.frames_since_bind_;
+        compact_frames_ = o.compact_frames_;
+        pacer_ = std::move(o.pacer_);
+        queued_failures_.store(o.queued_failures_.load(std::memory_order_relaxed),
+                               std::memory_order_relaxed);
+        stop_sender_ = false;
+    }
+
     bool UdpTransportWriter::send(const FrameHeader &hdr,
                                   const void *payload, uint32_t payload_size)
     {
@@ -45,7 +71,29 @@ namespace lux::communication::transport
 
         if (total <= kMaxUdpPayload)
         {
+            if (queued())
+            {
+                // Behind any queued fragments, so frames stay in send() order.
+                // The header is encoded here: compact state is send()-side.
+                PendingFrame frame{{}, 0, hdr.topic_hash, false};
+                frame.data.resize(sizeof(FrameHeader) + payload_size);
+                size_t hdr_len = sizeof(FrameHeader);
+                if (compactActive())
+                    hdr_len = encodeCompact(hdr, frame.data.data());
+                else
+                    std::memcpy(frame.data.data(), &hdr, sizeof(FrameHeader));
+                if (payload_size > 0)
+                    std::memcpy(frame.data.data() + hdr_len, payload, payload_size);
+                frame.data.resize(hdr_len + payload_size);
+                return enqueue(std::move(frame));
+            }
+
             // ── Fast path: single datagram via scatter-gather ──
+            // Not delayed, but its bytes count against the pacing budget.
+            if (compactActive())
+                return sendCompact(hdr, payload, payload_size);
+            if (pacer_)
+                pacer_->reserve(total + kIpUdpOverhead, platform::steadyNowNs());
             platform::IoVec iov[2] = {
                 {&hdr, sizeof(FrameHeader)},
                 {payload, payload_size}};
@@ -61,8 +109,82 @@ namespace lux::communication::transport
             std::memcpy(buf.data() + sizeof(FrameHeader), payload, payload_size);
 
         uint32_t gid = next_group_id_.fetch_add(1, std::memory_order_relaxed);
+        link_.onGroupSent(static_cast<uint32_t>((total + kMaxFragPayload - 1) / kMaxFragPayload));
+
+        if (queued())
+        {
+            // Hand the frame to the sender thread (buffer moves, no copy).
+            return enqueue(PendingFrame{std::move(buf), gid, hdr.topic_hash, true});
+        }
+
         return frag_sender_->send(gid, buf.data(), total, hdr.topic_hash,
-                                  dest_addr_, dest_port_);
+                                  dest_addr_, dest_port_, pacer_.get());
+    }
+
+    bool UdpTransportWriter::enqueue(PendingFrame frame)
+    {
+        std::lock_guard lock(queue_mutex_);
+        const size_t size = frame.data.size();
+        if (queued_bytes_ + size > pacer_->config().max_queued_bytes)
+            return false; // backlog full — drop (BestEffort)
+        if (!sender_thread_.joinable())
+            sender_thread_ = std::thread([this]
+                                         { senderLoop(); });
+        queued_bytes_ += size;
+        queue_.push_back(std::move(frame));
+        queue_cv_.notify_one();
+        return true;
+    }
+
+    bool UdpTransportWriter::sendCompact(const FrameHeader &hdr,
+                                         const void *payload, uint32_t payload_size)
+    {
+        alignas(8) uint8_t header[sizeof(FrameHeader)];
+        const size_t hdr_len = encodeCompact(hdr, header);
+        if (pacer_)
+            pacer_->reserve(hdr_len + payload_size + kIpUdpOverhead, platform::steadyNowNs());
+        platform::IoVec iov[2] = {
+            {header, hdr_len},
+            {payload, payload_size}};
+        return sock_.sendToV(iov, 2, dest_addr_, dest_port_) >= 0;
+    }
+
+    size_t UdpTransportWriter::encodeCompact(const FrameHeader &hdr, uint8_t *out)
+    {
+        size_t hdr_len = 0;
+
+        // Rebind on a topic change, and periodically so that a lost binding
+        // frame only costs a bounded run of undecodable frames.
+        const bool rebind =
+            !bound_ || hdr.topic_hash != binding_.topic_hash ||
+            frames_since_bind_ >= kCompactRebindFrames ||
+            hdr.timestamp_ns - binding_.base_timestamp_ns > kCompactRebindIntervalNs;
+        if (!rebind)
+            hdr_len = encodeCompactHeader(out, hdr, topic_id_, binding_);
+
+        if (hdr_len == 0)
+        {
+            // ── Binding frame: full header carrying the new baseline ──
+            if (bound_ && hdr.topic_hash != binding_.topic_hash)
+                ++topic_id_;
+            binding_.topic_hash = hdr.topic_hash;
+            binding_.base_seq = hdr.seq_num;
+            binding_.base_timestamp_ns = hdr.timestamp_ns;
+            binding_.publisher_id = hdr.publisher_id;
+            binding_.flags = hdr.flags;
+            ++binding_.epoch;
+            bound_ = true;
+            frames_since_bind_ = 0;
+
+            FrameHeader bind_hdr = hdr;
+            bind_hdr.reserved = makeCompactBindTag(topic_id_, binding_.epoch & 0x0F);
+            std::memcpy(out, &bind_hdr, sizeof(FrameHeader));
+            return sizeof(FrameHeader);
+        }
+
+        ++frames_since_bind_;
+        ++compact_frames_;
+        return hdr_len;
     }
 
     int UdpTransportWriter::sendRaw(const void *data, size_t len)
@@ -70,8 +192,133 @@ namespace lux::communication::transport
         return sock_.sendTo(data, len, dest_addr_, dest_port_);
     }
 
+    size_t UdpTransportWriter::pollLinkReports()
+    {
+        size_t n_reports = 0;
+        alignas(8) uint8_t buf[64];
+        std::string src_addr;
+        uint16_t src_port = 0;
+
+        for (;;)
+        {
+            int n = sock_.tryRecvFrom(buf, sizeof(buf), src_addr, src_port);
+            if (n <= 0)
+                break;
+            if (src_port != dest_port_ || !isLinkReport(buf, static_cast<size_t>(n)))
+                continue;
+
+            LinkReport rep;
+            std::memcpy(&rep, buf, sizeof(rep));
+            link_.onReport(rep, platform::steadyNowNs());
+            ++n_reports;
+
+            // Capabilities are re-advertised in every report.
+            const bool compact = (rep.capabilities & kLinkCapCompactHeader) != 0;
+            if (compact != peer_compact_.load(std::memory_order_relaxed))
+            {
+                bound_ = false;
+                peer_compact_.store(compact, std::memory_order_relaxed);
+            }
+
+            // Congestion-control feedback for the pacer (new groups only).
+            if (rep.complete_groups >= last_complete_groups_ &&
+                rep.lost_groups >= last_lost_groups_)
+            {
+                if (pacer_)
+                    pacer_->onFeedback(rep.lost_groups - last_lost_groups_,
+                                       rep.complete_groups - last_complete_groups_,
+                                       link_.stats().srtt_ns);
+                last_complete_groups_ = rep.complete_groups;
+                last_lost_groups_ = rep.lost_groups;
+            }
+        }
+        return n_reports;
+    }
+
+    void UdpTransportWriter::setPacing(const PacingConfig &cfg)
+    {
+        stopSender(true);
+        pacer_ = std::make_unique<FragmentPacer>(cfg);
+        if (cfg.rate_bytes_per_sec != 0 && cfg.use_txtime)
+            pacer_->setKernelPacing(sock_.enableTxTime());
+    }
+
+    void UdpTransportWriter::flush()
+    {
+        std::unique_lock lock(queue_mutex_);
+        queue_cv_.wait(lock, [this]
+                       { return (queue_.empty() && !sending_) || !sender_thread_.joinable(); });
+    }
+
+    void UdpTransportWriter::senderLoop()
+    {
+        std::unique_lock lock(queue_mutex_);
+        for (;;)
+        {
+            queue_cv_.wait(lock, [this]
+                           { return stop_sender_ || !queue_.empty(); });
+            if (queue_.empty())
+                return; // stop requested and nothing left
+
+            PendingFrame frame = std::move(queue_.front());
+            queue_.pop_front();
+            sending_ = true;
+            lock.unlock();
+
+            bool ok;
+            if (frame.fragmented)
+            {
+                ok = frag_sender_->send(frame.group_id, frame.data.data(), frame.data.size(),
+                                        frame.topic_hash, dest_addr_, dest_port_, pacer_.get());
+            }
+            else
+            {
+                // Single datagram: paced like one fragment.
+                platform::IoVec iov[1] = {{frame.data.data(), frame.data.size()}};
+                const uint64_t depart = pacer_->reserve(frame.data.size() + kIpUdpOverhead,
+                                                        platform::steadyNowNs());
+                if (pacer_->kernelPacing() && sock_.txTimeEnabled())
+                {
+                    ok = sock_.sendToVAt(iov, 1, dest_addr_, dest_port_, depart) >= 0;
+                }
+                else
+                {
+                    FragmentPacer::waitUntil(depart);
+                    ok = sock_.sendToV(iov, 1, dest_addr_, dest_port_) >= 0;
+                }
+            }
+            if (!ok)
+                queued_failures_.fetch_add(1, std::memory_order_relaxed);
+
+            lock.lock();
+            sending_ = false;
+            queued_bytes_ -= frame.data.size();
+            queue_cv_.notify_all(); // wake flush()
+        }
+    }
+
+    void UdpTransportWriter::stopSender(bool drain)
+    {
+        {
+            std::lock_guard lock(queue_mutex_);
+            if (!drain)
+            {
+                for (const auto &f : queue_)
+                    queued_bytes_ -= f.data.size();
+                queue_.clear();
+            }
+            stop_sender_ = true;
+        }
+        queue_cv_.notify_all();
+        if (sender_thread_.joinable())
+            sender_thread_.join();
+        // The loop sends whatever is still queued before exiting.
+        stop_sender_ = false;
+    }
+
     void UdpTransportWriter::close()
     {
+        stopSender(false);
         sock_.close();
     }
 
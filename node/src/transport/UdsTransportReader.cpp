@@ -0,0 +1,120 @@
+#include "lux/communication/transport/UdsTransportReader.hpp"
+#include "lux/communication/transport/NetConstants.hpp"
+
+#include <cerrno>
+#include <cstring>
+
+namespace lux::communication::transport
+{
+    UdsTransportReader::UdsTransportReader(const std::string &path, uint64_t topic_hash,
+                                           uint64_t type_hash, uint32_t local_pid,
+                                           const std::string &hostname)
+        : path_(path), topic_hash_(topic_hash), type_hash_(type_hash),
+          local_pid_(local_pid), hostname_(hostname),
+          recv_buf_(sizeof(FrameHeader) + kUdsMaxInlinePayload)
+    {
+    }
+
+    UdsTransportReader::~UdsTransportReader() { close(); }
+
+    bool UdsTransportReader::connect()
+    {
+        if (!sock_.connect(path_))
+            return false;
+
+        sock_.setRecvBufferSize(kUdsBufferSize);
+
+        // ── Send handshake request ──
+        HandshakeRequest req{};
+        req.topic_hash = topic_hash_;
+        req.type_hash = type_hash_;
+        req.subscriber_pid = local_pid_;
+        req.setHostname(hostname_.c_str());
+        if (!sock_.sendAll(&req, sizeof(req)))
+        {
+            sock_.close();
+            return false;
+        }
+
+        // ── Receive handshake response ──
+        HandshakeResponse resp{};
+        if (!sock_.recvExact(&resp, sizeof(resp)) ||
+            resp.magic != kHandshakeMagic || resp.accepted != 1)
+        {
+            sock_.close();
+            return false;
+        }
+
+        sock_.setNonBlocking(true);
+        connected_ = true;
+        return true;
+    }
+
+    void UdsTransportReader::onDataReady(FrameCallback cb)
+    {
+        while (connected_)
+        {
+            int passed_fd = -1;
+            int n = sock_.recv(recv_buf_.data(), recv_buf_.size(), passed_fd);
+            if (n == 0)
+            {
+                connected_ = false; // publisher closed
+                break;
+            }
+            if (n < 0)
+            {
+                if (errno == EMSGSIZE)
+                    continue; // oversized message dropped by the socket layer
+                if (errno != EAGAIN && errno != EWOULDBLOCK)
+                    connected_ = false;
+                break;
+            }
+            if (static_cast<size_t>(n) < sizeof(FrameHeader))
+            {
+                platform::closeFd(passed_fd);
+                continue;
+            }
+
+            FrameHeader hdr;
+            std::memcpy(&hdr, recv_buf_.data(), sizeof(FrameHeader));
+            if (!isValidFrame(hdr))
+            {
+                platform::closeFd(passed_fd);
+                continue;
+            }
+
+            if (isMemFd(hdr))
+            {
+                // Zero-copy: deserialize straight out of the sender's memfd.
+                auto region = platform::MemFdRegion::mapReadOnly(passed_fd, hdr.payload_size);
+                if (region.isValid() && cb)
+                    cb(hdr, region.data(), hdr.payload_size);
+                continue;
+            }
+
+            platform::closeFd(passed_fd); // unexpected descriptor
+            const auto payload_sz = static_cast<uint32_t>(n - sizeof(FrameHeader));
+            if (cb)
+                cb(hdr, recv_buf_.data() + sizeof(FrameHeader), payload_sz);
+        }
+    }
+
+    bool UdsTransportReader::pollOnce(FrameCallback cb)
+    {
+        bool delivered = false;
+        onDataReady([&](const FrameHeader &hdr, const void *payload, uint32_t sz)
+                    {
+                        delivered = true;
+                        if (cb)
+                            cb(hdr, payload, sz);
+                    });
+        return delivered;
+    }
+
+    void UdsTransportReader::close()
+    {
+        sock_.close();
+        connected_ = false;
+    }
+
+} // namespace lux::communication::transport
@@ -0,0 +1,135 @@
+#include "lux/communication/transport/UdsTransportWriter.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+namespace lux::communication::transport
+{
+    UdsTransportWriter::UdsTransportWriter(const std::string &path, uint64_t topic_hash,
+                                           uint64_t type_hash, uint32_t memfd_threshold)
+        : path_(path), topic_hash_(topic_hash), type_hash_(type_hash),
+          memfd_threshold_(std::min(memfd_threshold, kUdsMaxInlinePayload))
+    {
+    }
+
+    UdsTransportWriter::~UdsTransportWriter() { close(); }
+
+    bool UdsTransportWriter::startListening()
+    {
+        return listener_.listen(path_);
+    }
+
+    void UdsTransportWriter::onAcceptReady()
+    {
+        auto client = listener_.accept();
+        if (!client.isValid())
+            return;
+
+        // ── Read handshake request (one message) ──
+        HandshakeRequest req{};
+        if (!client.recvExact(&req, sizeof(req)) || req.magic != kHandshakeMagic)
+            return;
+
+        // ── Validate ──
+        HandshakeResponse resp{};
+        if (req.topic_hash != topic_hash_)
+        {
+            resp.reject_reason = static_cast<uint8_t>(HandshakeRejectReason::TopicNotFound);
+            client.sendAll(&resp, sizeof(resp));
+            return;
+        }
+        if (req.type_hash != type_hash_)
+        {
+            resp.reject_reason = static_cast<uint8_t>(HandshakeRejectReason::TypeMismatch);
+            client.sendAll(&resp, sizeof(resp));
+            return;
+        }
+
+        resp.accepted = 1;
+        resp.publisher_seq = seq_supplier_ ? seq_supplier_() : 0;
+        if (!client.sendAll(&resp, sizeof(resp)))
+            return;
+
+        // ── Register connection ──
+        client.setSendBufferSize(kUdsBufferSize);
+        client.setNonBlocking(true); // a slow subscriber must not stall publish()
+
+        auto conn = std::make_unique<Connection>();
+        conn->sock = std::move(client);
+        conn->subscriber_pid = req.subscriber_pid;
+
+        std::lock_guard lock(conn_mutex_);
+        connections_.push_back(std::move(conn));
+    }
+
+    uint32_t UdsTransportWriter::send(const FrameHeader &hdr,
+                                      const void *payload, uint32_t payload_size)
+    {
+        std::lock_guard lock(conn_mutex_);
+        if (connections_.empty())
+            return 0;
+
+        // ── Large payload: one memfd, descriptor passed to every subscriber ──
+        platform::MemFdRegion region;
+        FrameHeader wire = hdr;
+        platform::IoVec iov[2] = {
+            {&wire, sizeof(FrameHeader)},
+            {payload, payload_size}};
+        int iovcnt = payload_size > 0 ? 2 : 1;
+
+        if (payload_size > memfd_threshold_)
+        {
+            region = platform::MemFdRegion::create(payload_size);
+            if (region.isValid())
+            {
+                std::memcpy(region.data(), payload, payload_size);
+                setMemFd(wire);
+                iovcnt = 1;
+            }
+            else if (payload_size > kUdsMaxInlinePayload)
+            {
+                return 0; // no memfd and too large to send inline
+            }
+        }
+
+        uint32_t ok_count = 0;
+        for (auto it = connections_.begin(); it != connections_.end();)
+        {
+            int n = (*it)->sock.sendV(iov, iovcnt, region.fd());
+            if (n < 0)
+            {
+                it = connections_.erase(it); // subscriber went away
+                continue;
+            }
+            if (n == 0)
+                ++dropped_; // socket buffer full — BestEffort drop
+            else
+                ++ok_count;
+            ++it;
+        }
+        // The region is unmapped here; subscribers hold their own descriptors.
+        return ok_count;
+    }
+
+    size_t UdsTransportWriter::connectionCount() const
+    {
+        std::lock_guard lock(conn_mutex_);
+        return connections_.size();
+    }
+
+    uint64_t UdsTransportWriter::droppedFrames() const
+    {
+        std::lock_guard lock(conn_mutex_);
+        return dropped_;
+    }
+
+    void UdsTransportWriter::close()
+    {
+        {
+            std::lock_guard lock(conn_mutex_);
+            connections_.clear();
+        }
+        listener_.close();
+    }
+
+} // namespace lux::communication::transport
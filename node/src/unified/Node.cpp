@@ -1,5 +1,6 @@
 #include "lux/communication/Node.hpp"
 #include "lux/communication/CallbackGroupBase.hpp"
+#include "lux/communication/Timer.hpp"
 #include "lux/communication/discovery/DiscoveryService.hpp"
 #include "lux/communication/executor/SingleThreadedExecutor.hpp"
 #include <thread>
@@ -39,9 +40,29 @@ namespace lux::communication
         return default_cbg_.get();
     }
 
+    std::shared_ptr<Timer> Node::createTimer(std::chrono::nanoseconds period,
+                                             std::function<void()> callback,
+                                             CallbackGroupBase *cbg)
+    {
+        auto timer = std::make_shared<Timer>(
+            this, period, std::move(callback), cbg ? cbg : defaultCallbackGroup());
+        {
+            std::lock_guard lock(endpoints_mutex_);
+            owned_endpoints_.push_back(timer);
+        }
+        {
+            std::lock_guard lock(stoppers_mutex_);
+            std::weak_ptr<Timer> weak = timer;
+            subscriber_stoppers_.push_back([weak]() {
+                if (auto t = weak.lock()) t->cancel();
+            });
+        }
+        return timer;
+    }
+
     void Node::stop()
     {
-        // 1. Stop all subscribers.
+        // 1. Stop all subscribers and timers.
         {
             std::lock_guard lock(stoppers_mutex_);
             for (auto &fn : subscriber_stoppers_)
@@ -0,0 +1,37 @@
+#pragma once
+/// Counting replacement for the global operator new / delete, shared by the
+/// allocation tests.  Include it from the test executable's one translation
+/// unit: the definitions below replace the library versions.
+///
+/// g_allocs counts operator new calls made while g_counting is set.
+
+#include <atomic>
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+
+// Kept out of line: inlined into a call site, GCC sees free() on a pointer
+// that came from `new` and warns (-Wmismatched-new-delete).
+#if defined(_MSC_VER)
+#define LUX_TEST_NOINLINE __declspec(noinline)
+#else
+#define LUX_TEST_NOINLINE __attribute__((noinline))
+#endif
+
+static std::atomic<bool>   g_counting{true};
+static std::atomic<size_t> g_allocs{0};
+
+LUX_TEST_NOINLINE void *operator new(std::size_t size)
+{
+    if (g_counting.load(std::memory_order_relaxed))
+        g_allocs.fetch_add(1, std::memory_order_relaxed);
+    if (void *p = std::malloc(size ? size : 1))
+        return p;
+    throw std::bad_alloc();
+}
+
+LUX_TEST_NOINLINE void *operator new[](std::size_t size) { return ::operator new(size); }
+LUX_TEST_NOINLINE void operator delete(void *p) noexcept { std::free(p); }
+LUX_TEST_NOINLINE void operator delete[](void *p) noexcept { std::free(p); }
+LUX_TEST_NOINLINE void operator delete(void *p, std::size_t) noexcept { std::free(p); }
+LUX_TEST_NOINLINE void operator delete[](void *p, std::size_t) noexcept { std::free(p); }
@@ -133,6 +133,7 @@ static void testShmRegistry()
     info.type_hash        = 12345;
     info.role             = discovery::EndpointRole::Publisher;
     info.hostname         = platform::currentHostname();
+    info.endpoint_id      = 7;
 
     int32_t slot = registry.announce(info);
     assert(slot >= 0);
@@ -151,6 +152,7 @@ static void testShmRegistry()
     assert(results[0].type_name == "TestMsg");
     assert(results[0].type_hash == 12345);
     assert(results[0].pid == platform::currentPid());
+    assert(results[0].endpoint_id == 7);
 
     // Lookup with wrong role → empty
     filter.role = discovery::EndpointRole::Subscriber;
@@ -165,6 +167,25 @@ static void testShmRegistry()
     results = registry.lookup(filter);
     assert(results.empty());
 
+    // Subscriber content filter travels with the entry, never truncated
+    info.role           = discovery::EndpointRole::Subscriber;
+    info.content_filter = "@4f>20.5,~100000000";
+    slot = registry.announce(info);
+    assert(slot >= 0);
+    filter.role = discovery::EndpointRole::Subscriber;
+    results = registry.lookup(filter);
+    assert(results.size() == 1);
+    assert(results[0].content_filter == "@4f>20.5,~100000000");
+    registry.withdraw(slot);
+
+    info.content_filter = std::string(discovery::kMaxFilterLen, 'x');
+    slot = registry.announce(info);
+    results = registry.lookup(filter);
+    assert(results.size() == 1 && results[0].content_filter.empty());
+    registry.withdraw(slot);
+    info.role           = discovery::EndpointRole::Publisher;
+    info.content_filter.clear();
+
     // Re-announce and test GC
     info.topic_name = "/gc/topic";
     info.topic_name_hash = discovery::fnv1a_64(info.topic_name);
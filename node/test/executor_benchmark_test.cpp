@@ -1,6 +1,6 @@
 /**
  * @file executor_benchmark_test.cpp
- * @brief Comprehensive throughput benchmark for all 4 executor types.
+ * @brief Comprehensive throughput benchmark for all executor types.
  *
  * Tests:
  *  1. SingleThreadedExecutor  — spin()    — 1 pub, 1 sub
@@ -11,6 +11,32 @@
  *  6. TimeOrderedExecutor     — spin()    — 1 pub, 1 sub
  *  7. SingleThreadedExecutor  — spin()    — 1 pub, N subs (fan-out scaling)
  *  8. SingleThreadedExecutor  — spin()    — N pubs, 1 sub (multi-publisher)
+ *  9. MultiThreadedExecutor   — spin()    — G independent MutExcl groups, 1..8 threads
+ * 10. SingleThreadedExecutor  — spin()    — 1 kHz control topic under bulk overload,
+ *                                            latency per ReadyPolicy
+ * 11. TimeOrdered vs ParallelTimeOrdered — multi-sensor fusion: G groups × 3 sensor
+ *                                            topics, CPU-bound callbacks, 1..4 threads
+ * 12. SingleThreadedExecutor  — spinSome  — aggregating subscriber, per-message vs
+ *                                            batch callback
+ * 13. Single/MultiThreaded    — spin()    — timer jitter at 1 kHz and 10 kHz vs a
+ *                                            sleep_until() publisher thread
+ * 14. SingleThreaded vs Coroutine — pair "next on A, then next on B": callback
+ *                                            state machine vs co_await next()
+ * 15. SingleThreadedExecutor  — spin()    — publish→callback latency vs process CPU
+ *                                            per WaitPolicy at 50 kHz / 5 kHz / 500 Hz
+ * 16. EventCount vs counting_semaphore — notify cost with nobody parked and
+ *                                            wake latency of a parked consumer,
+ *                                            1 / 4 / 16 producer threads
+ * 17. SingleThreadedExecutor  — spinSome  — 1 pub, 1 sub, profiling off vs on
+ * 18. Publisher (no executor) — 1 / 4 threads publishing to 2 SHM peers in
+ *                                            forked subscriber processes
+ * 19. SingleThreadedExecutor  — spin()    — bursty sensor driver, 2 subs,
+ *                                            publish() per message vs publishBatch()
+ * 20. Publisher (no executor) — 1 / 8 threads, each publishing to its own
+ *                                            topic, 1 SHM subscriber process
+ * 21. Sequence + stamp allocation — 1 / 8 threads, one shared counter (the
+ *                                            former Domain-wide one) vs per-publisher
+ *                                            counter and HybridClock
  *
  * Message type: trivially-copyable 8-byte double (SmallValueMsg fast path).
  */
@@ -22,13 +48,32 @@
 #include <chrono>
 #include <vector>
 #include <string>
+#include <memory>
+#include <algorithm>
+#include <span>
+#include <ctime>
+#include <semaphore>
+#include <climits>
+
+#include <signal.h>
+#include <sys/wait.h>
+#include <unistd.h>
 
 #include <lux/communication/Node.hpp>
+#include <lux/communication/HybridClock.hpp>
+#include <lux/communication/platform/PlatformDefs.hpp>
+#include <lux/communication/EventCount.hpp>
 #include <lux/communication/CallbackGroupBase.hpp>
+#include <lux/communication/Timer.hpp>
+#include <lux/communication/discovery/DiscoveryService.hpp>
+#include <lux/communication/transport/ShmRingReader.hpp>
 #include <lux/communication/executor/SingleThreadedExecutor.hpp>
 #include <lux/communication/executor/MultiThreadedExecutor.hpp>
 #include <lux/communication/executor/SeqOrderedExecutor.hpp>
 #include <lux/communication/executor/TimeOrderedExecutor.hpp>
+#include <lux/communication/executor/ParallelTimeOrderedExecutor.hpp>
+#include <lux/communication/executor/CoroutineExecutor.hpp>
+#include <deque>
 
 namespace comm = lux::communication;
 
@@ -53,6 +98,21 @@ static void printResult(const BenchResult& r)
               << std::endl;
 }
 
+/// 78-column rule ("─" is three bytes in UTF-8, so no std::string(n, c)).
+static void printRule()
+{
+    for (int i = 0; i < 78; ++i)
+        std::cout << "─";
+    std::cout << "\n";
+}
+
+static void printSection(const char* title)
+{
+    printRule();
+    std::cout << "  " << title << "\n";
+    printRule();
+}
+
 // ────────────────────────────────────────────────────────────
 // Benchmark 1: SingleThreadedExecutor — spin()
 // ────────────────────────────────────────────────────────────
@@ -237,8 +297,8 @@ static BenchResult benchTimeOrdered(int N)
         [&](const double&) { count.fetch_add(1, std::memory_order_relaxed); });
     auto pub = node.createPublisher<double>("/bench");
 
-    // time_offset=0 → execute immediately (no reorder delay)
-    comm::TimeOrderedExecutor exec(std::chrono::nanoseconds{0});
+    // idle_timeout=0 → never wait for an empty source (merge only what is drained)
+    comm::TimeOrderedExecutor exec;
     exec.addNode(&node);
     std::thread spin_th([&] { exec.spin(); });
 
@@ -251,7 +311,7 @@ static BenchResult benchTimeOrdered(int N)
     exec.stop(); spin_th.join();
 
     double ms = std::chrono::duration<double, std::milli>(t2 - t1).count();
-    return {"TimeOrdered spin() [1pub 1sub, offset=0]", N, ms, N / (ms / 1000.0)};
+    return {"TimeOrdered spin() [1pub 1sub, idle=0]", N, ms, N / (ms / 1000.0)};
 }
 
 // ────────────────────────────────────────────────────────────
@@ -338,6 +398,926 @@ static BenchResult benchMultiPublisher(int msgs_per_pub, int num_pubs)
 }
 
 // ────────────────────────────────────────────────────────────
+// Benchmark 9: Work-stealing scaling — G nodes, each with its own
+//              MutuallyExclusive default group and a CPU-bound callback
+// ────────────────────────────────────────────────────────────
+static void burnCpu(int iterations)
+{
+    volatile uint64_t x = 1;
+    for (int i = 0; i < iterations; ++i)
+        x = x * 6364136223846793005ull + 1442695040888963407ull;
+}
+
+static BenchResult benchIndependentGroups(int msgs_per_group, int groups, size_t threads)
+{
+    constexpr int kWorkIterations = 500; // ~0.5–1 µs of work per callback
+
+    comm::Domain domain(1);
+    std::vector<std::unique_ptr<comm::Node>> nodes;
+    std::vector<std::shared_ptr<comm::Subscriber<double>>> subs;
+    std::vector<std::shared_ptr<comm::Publisher<double>>> pubs;
+
+    std::atomic<int> count{0};
+    for (int g = 0; g < groups; ++g)
+    {
+        nodes.push_back(std::make_unique<comm::Node>("grp" + std::to_string(g), domain, intraOpts()));
+        const std::string topic = "/group_" + std::to_string(g);
+        subs.push_back(nodes.back()->createSubscriber<double>(topic,
+            [&](const double&) {
+                burnCpu(kWorkIterations);
+                count.fetch_add(1, std::memory_order_relaxed);
+            }));
+        pubs.push_back(nodes.back()->createPublisher<double>(topic));
+    }
+
+    const int total = msgs_per_group * groups;
+
+    comm::MultiThreadedExecutor exec(threads);
+    for (auto& n : nodes) exec.addNode(n.get());
+    std::thread spin_th([&] { exec.spin(); });
+
+    auto t1 = std::chrono::steady_clock::now();
+    for (int i = 0; i < msgs_per_group; ++i)
+        for (auto& p : pubs) p->emplace(1.0);
+    while (count.load(std::memory_order_relaxed) < total)
+        std::this_thread::yield();
+    auto t2 = std::chrono::steady_clock::now();
+
+    exec.stop(); spin_th.join();
+
+    double ms = std::chrono::duration<double, std::milli>(t2 - t1).count();
+    std::string name = "MultiThreaded [" + std::to_string(threads) + "T, "
+                       + std::to_string(groups) + " MutExcl groups]";
+    return {name, total, ms, total / (ms / 1000.0)};
+}
+
+// ────────────────────────────────────────────────────────────
+// Benchmark 10: Control-loop latency under bulk overload — a 1 kHz
+//               high-priority topic shares one SingleThreadedExecutor with
+//               a bursty CPU-bound bulk topic.  Reports publish→callback
+//               latency of the control topic for each ReadyPolicy.
+// ────────────────────────────────────────────────────────────
+struct LatencyResult {
+    std::string name;
+    size_t samples;
+    double p50_us;
+    double p99_us;
+    double max_us;
+};
+
+static void printLatency(const LatencyResult& r)
+{
+    std::cout << std::left << std::setw(40) << r.name
+              << std::right << std::fixed << std::setprecision(1)
+              << std::setw(10) << r.p50_us
+              << std::setw(10) << r.p99_us
+              << std::setw(10) << r.max_us << " µs"
+              << "   (" << r.samples << " samples)"
+              << std::endl;
+}
+
+static LatencyResult benchControlLatency(comm::ReadyPolicy policy, const char* label)
+{
+    constexpr auto kDuration   = std::chrono::seconds(1);
+    constexpr auto kPeriod     = std::chrono::microseconds(1000); // 1 kHz control loop
+    constexpr auto kBurstEvery = std::chrono::milliseconds(5);
+    constexpr int  kBurst      = 2000;  // bulk messages per burst (several ms of work)
+    constexpr int  kWork       = 500;   // burnCpu() iterations per bulk callback
+
+    using clock = std::chrono::steady_clock;
+
+    comm::Domain domain(1);
+    comm::Node node("latency", domain, intraOpts());
+
+    std::atomic<int> bulk_count{0};
+    auto bulk_sub = node.createSubscriber<double>("/bulk",
+        [&](const double&) {
+            burnCpu(kWork);
+            bulk_count.fetch_add(1, std::memory_order_relaxed);
+        });
+
+    std::vector<double> latencies_us;
+    latencies_us.reserve(2000);
+    std::atomic<int> ctrl_count{0};
+    comm::SubscribeOptions ctrl_opts;
+    ctrl_opts.priority           = 10;
+    ctrl_opts.qos.latency_budget = std::chrono::microseconds(200);
+    auto ctrl_sub = node.createSubscriber<int64_t>("/control",
+        [&](const int64_t& sent_ns) {
+            const int64_t now = clock::now().time_since_epoch().count();
+            latencies_us.push_back((now - sent_ns) / 1e3);
+            ctrl_count.fetch_add(1, std::memory_order_relaxed);
+        }, nullptr, ctrl_opts);
+
+    auto bulk_pub = node.createPublisher<double>("/bulk");
+    auto ctrl_pub = node.createPublisher<int64_t>("/control");
+
+    comm::SingleThreadedExecutor exec;
+    exec.setReadyPolicy(policy);
+    exec.addNode(&node);
+    std::thread spin_th([&] { exec.spin(); });
+
+    const auto end = clock::now() + kDuration;
+    int bulk_sent = 0;
+    std::thread bulk_th([&] {
+        for (auto next = clock::now(); next < end; next += kBurstEvery)
+        {
+            std::this_thread::sleep_until(next);
+            for (int i = 0; i < kBurst; ++i) bulk_pub->emplace(1.0);
+            bulk_sent += kBurst;
+        }
+    });
+
+    int ctrl_sent = 0;
+    for (auto next = clock::now(); next < end; next += kPeriod)
+    {
+        std::this_thread::sleep_until(next);
+        ctrl_pub->emplace(clock::now().time_since_epoch().count());
+        ++ctrl_sent;
+    }
+    bulk_th.join();
+
+    while (bulk_count.load(std::memory_order_relaxed) < bulk_sent ||
+           ctrl_count.load(std::memory_order_relaxed) < ctrl_sent)
+        std::this_thread::yield();
+    exec.stop(); spin_th.join();
+
+    std::sort(latencies_us.begin(), latencies_us.end());
+    const size_t n = latencies_us.size();
+    return {std::string("SingleThreaded ") + label, n,
+            latencies_us[n / 2], latencies_us[n * 99 / 100], latencies_us.back()};
+}
+
+// ────────────────────────────────────────────────────────────
+// Benchmark 11: Multi-sensor fusion — G fusion nodes, each with its own
+//               default group and 3 sensor topics (imu / camera / lidar)
+//               interleaved by one publisher thread.  TimeOrderedExecutor
+//               merges all 3·G sources on one thread; ParallelTimeOrdered
+//               keeps one merge per group and runs groups on a pool.
+// ────────────────────────────────────────────────────────────
+template<typename Executor>
+static BenchResult benchSensorFusion(const std::string& label, int msgs_per_topic, int groups,
+                                     Executor& exec)
+{
+    constexpr int kWorkIterations = 500;
+    static const char* kSensors[] = {"imu", "camera", "lidar"};
+
+    comm::Domain domain(1);
+    std::vector<std::unique_ptr<comm::Node>> nodes;
+    std::vector<std::shared_ptr<comm::Subscriber<double>>> subs;
+    std::vector<std::shared_ptr<comm::Publisher<double>>> pubs;
+
+    std::atomic<int> count{0};
+    for (int g = 0; g < groups; ++g)
+    {
+        nodes.push_back(std::make_unique<comm::Node>("fusion" + std::to_string(g), domain, intraOpts()));
+        for (const char* sensor : kSensors)
+        {
+            const std::string topic = "/fusion_" + std::to_string(g) + "/" + sensor;
+            subs.push_back(nodes.back()->createSubscriber<double>(topic,
+                [&](const double&) {
+                    burnCpu(kWorkIterations);
+                    count.fetch_add(1, std::memory_order_relaxed);
+                }));
+            pubs.push_back(nodes.back()->createPublisher<double>(topic));
+        }
+    }
+
+    const int total = msgs_per_topic * static_cast<int>(pubs.size());
+
+    for (auto& n : nodes) exec.addNode(n.get());
+    std::thread spin_th([&] { exec.spin(); });
+
+    auto t1 = std::chrono::steady_clock::now();
+    for (int i = 0; i < msgs_per_topic; ++i)
+        for (auto& p : pubs) p->emplace(1.0);
+    while (count.load(std::memory_order_relaxed) < total)
+        std::this_thread::yield();
+    auto t2 = std::chrono::steady_clock::now();
+
+    exec.stop(); spin_th.join();
+    for (auto& n : nodes) exec.removeNode(n.get());
+
+    double ms = std::chrono::duration<double, std::milli>(t2 - t1).count();
+    return {label, total, ms, total / (ms / 1000.0)};
+}
+
+// ────────────────────────────────────────────────────────────
+// Benchmark 12: Aggregating subscriber — per-message callback vs batch
+//               callback summing the span.  The queue is filled first and
+//               only the SingleThreaded spinSome() drain is timed.
+// ────────────────────────────────────────────────────────────
+static BenchResult benchBatchCallback(int N, bool batch, size_t max_batch)
+{
+    comm::Domain domain(1);
+    comm::Node node("batch_cb", domain, intraOpts());
+
+    std::atomic<int> count{0};
+    double sum = 0.0;
+    comm::SubscribeOptions opts;
+    opts.max_batch_size = max_batch;
+
+    std::shared_ptr<comm::Subscriber<double>> sub;
+    if (batch)
+    {
+        sub = node.createSubscriber<double>("/bench",
+            [&](std::span<const double> msgs)
+            {
+                double s = 0.0;
+                for (double v : msgs) s += v;
+                sum += s;
+                count.fetch_add(static_cast<int>(msgs.size()), std::memory_order_relaxed);
+            }, nullptr, opts);
+    }
+    else
+    {
+        sub = node.createSubscriber<double>("/bench",
+            [&](const double& v)
+            {
+                sum += v;
+                count.fetch_add(1, std::memory_order_relaxed);
+            });
+    }
+    auto pub = node.createPublisher<double>("/bench");
+
+    comm::SingleThreadedExecutor exec;
+    exec.addNode(&node);
+
+    // Pre-fill, then time the consumer side only.
+    for (int i = 0; i < N; ++i) pub->emplace(1.0);
+    auto t1 = std::chrono::steady_clock::now();
+    while (count.load(std::memory_order_relaxed) < N)
+        exec.spinSome();
+    auto t2 = std::chrono::steady_clock::now();
+
+    double ms = std::chrono::duration<double, std::milli>(t2 - t1).count();
+    std::string name = batch
+        ? "Batch callback [max " + (max_batch ? std::to_string(max_batch) : std::string("unbounded")) + "]"
+        : std::string("Per-message callback");
+    return {name, N, ms, N / (ms / 1000.0)};
+}
+
+// ────────────────────────────────────────────────────────────
+// Benchmark 13: Periodic jitter — lateness of each callback behind its
+//               scheduled time, for an executor timer and for the usual
+//               workaround of a thread that sleep_until()s and publishes.
+//               Also reports the CPU the process burnt per wall second.
+// ────────────────────────────────────────────────────────────
+static LatencyResult benchTimerJitter(std::chrono::nanoseconds period, bool use_timer,
+                                      comm::ExecutorBase& exec, const std::string& label,
+                                      double& cpu_pct)
+{
+    constexpr auto kDuration = std::chrono::seconds(1);
+    using clock = std::chrono::steady_clock;
+
+    comm::Domain domain(1);
+    comm::Node node("jitter", domain, intraOpts());
+
+    std::vector<double> late_us;
+    late_us.reserve(static_cast<size_t>(kDuration / period) + 16);
+
+    std::shared_ptr<comm::Timer> timer;
+    std::shared_ptr<comm::Subscriber<int64_t>> sub;
+    std::shared_ptr<comm::Publisher<int64_t>> pub;
+    if (use_timer)
+    {
+        timer = node.createTimer(period, [&]
+        {
+            const int64_t now = clock::now().time_since_epoch().count();
+            late_us.push_back((now - static_cast<int64_t>(timer->scheduledNs())) / 1e3);
+        });
+    }
+    else
+    {
+        sub = node.createSubscriber<int64_t>("/tick", [&](const int64_t& due_ns)
+        {
+            const int64_t now = clock::now().time_since_epoch().count();
+            late_us.push_back((now - due_ns) / 1e3);
+        });
+        pub = node.createPublisher<int64_t>("/tick");
+    }
+
+    exec.addNode(&node);
+    const std::clock_t cpu0 = std::clock();
+    const auto start = clock::now();
+    std::thread spin_th([&] { exec.spin(); });
+
+    if (use_timer)
+    {
+        std::this_thread::sleep_for(kDuration);
+    }
+    else
+    {
+        for (auto next = start + period; next < start + kDuration; next += period)
+        {
+            std::this_thread::sleep_until(next);
+            pub->emplace(next.time_since_epoch().count());
+        }
+    }
+    exec.stop(); spin_th.join();
+    const double wall_ms = std::chrono::duration<double, std::milli>(clock::now() - start).count();
+    cpu_pct = 100.0 * (1000.0 * (std::clock() - cpu0) / CLOCKS_PER_SEC) / wall_ms;
+    if (timer) timer->cancel();
+    exec.removeNode(&node);
+
+    std::sort(late_us.begin(), late_us.end());
+    const size_t n = late_us.size();
+    if (n == 0)
+        return {label, 0, 0.0, 0.0, 0.0};
+    return {label, n, late_us[n / 2], late_us[n * 99 / 100], late_us.back()};
+}
+
+// ────────────────────────────────────────────────────────────
+// Benchmark 14: Pairing pipeline — every message on /a is matched with the
+//               next one on /b.  Callback form: two callbacks feeding two
+//               deques and a pairing step.  Coroutine form: one task that
+//               co_awaits a.next() then b.next().  "pre-filled" times the
+//               drain of queued messages, "live" the whole run with a
+//               publisher alternating A and B while spin() runs.
+// ────────────────────────────────────────────────────────────
+static comm::Task pairLoop(comm::Subscriber<double>& a, comm::Subscriber<double>& b,
+                           int pairs, double& sum, std::atomic<int>& count)
+{
+    for (int i = 0; i < pairs; ++i)
+    {
+        const double x = co_await a.next();
+        const double y = co_await b.next();
+        sum += x * y;
+        count.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+static BenchResult benchPairing(int pairs, bool coroutine, bool live)
+{
+    comm::Domain domain(1);
+    comm::Node node("pairing", domain, intraOpts());
+
+    std::atomic<int> count{0};
+    double sum = 0.0;
+
+    std::shared_ptr<comm::Subscriber<double>> sub_a, sub_b;
+    std::deque<double> pending_a, pending_b;
+    auto match = [&]
+    {
+        while (!pending_a.empty() && !pending_b.empty())
+        {
+            sum += pending_a.front() * pending_b.front();
+            pending_a.pop_front();
+            pending_b.pop_front();
+            count.fetch_add(1, std::memory_order_relaxed);
+        }
+    };
+    if (coroutine)
+    {
+        sub_a = node.createSubscriber<double>("/a", nullptr);
+        sub_b = node.createSubscriber<double>("/b", nullptr);
+    }
+    else
+    {
+        sub_a = node.createSubscriber<double>("/a", [&](const double& v) { pending_a.push_back(v); match(); });
+        sub_b = node.createSubscriber<double>("/b", [&](const double& v) { pending_b.push_back(v); match(); });
+    }
+    auto pub_a = node.createPublisher<double>("/a");
+    auto pub_b = node.createPublisher<double>("/b");
+
+    comm::CoroutineExecutor coro_exec;
+    comm::SingleThreadedExecutor cb_exec;
+    comm::ExecutorBase& exec = coroutine ? static_cast<comm::ExecutorBase&>(coro_exec) : cb_exec;
+    exec.addNode(&node);
+    if (coroutine)
+        coro_exec.spawn(pairLoop(*sub_a, *sub_b, pairs, sum, count));
+
+    std::chrono::steady_clock::time_point t1, t2;
+    if (live)
+    {
+        std::thread spin_th([&] { exec.spin(); });
+        t1 = std::chrono::steady_clock::now();
+        for (int i = 0; i < pairs; ++i)
+        {
+            pub_a->emplace(1.0);
+            pub_b->emplace(2.0);
+        }
+        while (count.load(std::memory_order_relaxed) < pairs)
+            std::this_thread::yield();
+        t2 = std::chrono::steady_clock::now();
+        exec.stop(); spin_th.join();
+    }
+    else
+    {
+        for (int i = 0; i < pairs; ++i)
+        {
+            pub_a->emplace(1.0);
+            pub_b->emplace(2.0);
+        }
+        t1 = std::chrono::steady_clock::now();
+        while (count.load(std::memory_order_relaxed) < pairs)
+            exec.spinSome();
+        t2 = std::chrono::steady_clock::now();
+    }
+    exec.removeNode(&node);
+
+    double ms = std::chrono::duration<double, std::milli>(t2 - t1).count();
+    std::string name = std::string(coroutine ? "Coroutine co_await next()" : "Callbacks + deques")
+                     + (live ? " [live]" : " [pre-filled]");
+    return {name, pairs * 2, ms, pairs * 2 / (ms / 1000.0)};
+}
+
+// ────────────────────────────────────────────────────────────
+// ────────────────────────────────────────────────────────────
+// Benchmark 15: Wait policy — a publisher thread sleeps `interval` between
+//               messages; reports publish→callback latency and the CPU the
+//               process burnt per wall second for each WaitPolicy, and for
+//               SpinThenPark under a tight QoS latency budget.
+// ────────────────────────────────────────────────────────────
+static LatencyResult benchWaitPolicy(comm::WaitPolicy policy, std::chrono::microseconds interval,
+                                     std::chrono::microseconds budget, const std::string& label,
+                                     double& cpu_pct, uint64_t& window_ns)
+{
+    constexpr auto kDuration = std::chrono::milliseconds(500);
+    using clock = std::chrono::steady_clock;
+
+    comm::Domain domain(1);
+    comm::Node node("wait", domain, intraOpts());
+
+    std::vector<double> latencies_us;
+    latencies_us.reserve(static_cast<size_t>(kDuration / interval) + 16);
+    std::atomic<int> received{0};
+    comm::SubscribeOptions opts;
+    opts.qos.latency_budget = budget;
+    auto sub = node.createSubscriber<int64_t>("/wait",
+        [&](const int64_t& sent_ns) {
+            const int64_t now = clock::now().time_since_epoch().count();
+            latencies_us.push_back((now - sent_ns) / 1e3);
+            received.fetch_add(1, std::memory_order_relaxed);
+        }, nullptr, opts);
+    auto pub = node.createPublisher<int64_t>("/wait");
+
+    comm::SingleThreadedExecutor exec;
+    exec.setWaitPolicy(policy);
+    exec.addNode(&node);
+    const std::clock_t cpu0 = std::clock();
+    const auto start = clock::now();
+    std::thread spin_th([&] { exec.spin(); });
+
+    int sent = 0;
+    for (auto next = start + interval; next < start + kDuration; next += interval)
+    {
+        std::this_thread::sleep_until(next);
+        pub->emplace(clock::now().time_since_epoch().count());
+        ++sent;
+    }
+    while (received.load(std::memory_order_relaxed) < sent)
+        std::this_thread::yield();
+    window_ns = exec.spinWindowNs();
+    exec.stop(); spin_th.join();
+    const double wall_ms = std::chrono::duration<double, std::milli>(clock::now() - start).count();
+    cpu_pct = 100.0 * (1000.0 * (std::clock() - cpu0) / CLOCKS_PER_SEC) / wall_ms;
+    exec.removeNode(&node);
+
+    std::sort(latencies_us.begin(), latencies_us.end());
+    const size_t n = latencies_us.size();
+    return {label, n, latencies_us[n / 2], latencies_us[n * 99 / 100], latencies_us.back()};
+}
+
+// ────────────────────────────────────────────────────────────
+// Benchmark 16: Wake primitive — EventCount (what the executors park on)
+//               against std::counting_semaphore (what they parked on
+//               before).  Notify cost: `producers` threads notify with no
+//               consumer parked, the common case under load.  Wake latency:
+//               producers race to hand one stamped item to a parked
+//               consumer, which reports notify→return time.
+// ────────────────────────────────────────────────────────────
+static BenchResult benchNotifyCost(bool eventcount, int producers, int per_producer)
+{
+    comm::EventCount ec;
+    std::counting_semaphore<INT_MAX> sem{0};
+
+    std::atomic<bool> go{false};
+    std::vector<std::thread> threads;
+    for (int p = 0; p < producers; ++p)
+    {
+        threads.emplace_back([&]
+        {
+            while (!go.load(std::memory_order_acquire))
+                std::this_thread::yield();
+            for (int i = 0; i < per_producer; ++i)
+            {
+                if (eventcount)
+                    ec.notifyOne();
+                else
+                    sem.release();
+            }
+        });
+    }
+
+    auto t0 = std::chrono::high_resolution_clock::now();
+    go.store(true, std::memory_order_release);
+    for (auto& t : threads)
+        t.join();
+    auto t1 = std::chrono::high_resolution_clock::now();
+
+    const int total = producers * per_producer;
+    double ms = std::chrono::duration<double, std::milli>(t1 - t0).count();
+    return {std::string(eventcount ? "EventCount::notifyOne" : "semaphore::release") +
+                " (" + std::to_string(producers) + " producers)",
+            total, ms, total / (ms / 1000.0)};
+}
+
+static LatencyResult benchWakeLatency(bool eventcount, int producers, int rounds)
+{
+    using clock = std::chrono::steady_clock;
+
+    comm::EventCount ec;
+    std::counting_semaphore<INT_MAX> sem{0};
+    std::atomic<bool>    parked{false};  // semaphore consumer is about to block
+    std::atomic<int64_t> stamp{0};       // 0 = no item
+    std::atomic<bool>    done{false};
+
+    std::vector<std::thread> threads;
+    for (int p = 0; p < producers; ++p)
+    {
+        threads.emplace_back([&]
+        {
+            while (!done.load(std::memory_order_relaxed))
+            {
+                const bool waiting = eventcount ? ec.waiters() > 0
+                                                : parked.load(std::memory_order_acquire);
+                int64_t expected = 0;
+                if (waiting && stamp.load(std::memory_order_relaxed) == 0 &&
+                    stamp.compare_exchange_strong(expected, clock::now().time_since_epoch().count()))
+                {
+                    if (eventcount)
+                        ec.notifyOne();
+                    else
+                        sem.release();
+                }
+                else
+                {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+
+    std::vector<double> latencies_us;
+    latencies_us.reserve(rounds);
+    for (int r = 0; r < rounds; ++r)
+    {
+        int64_t sent = 0;
+        if (eventcount)
+        {
+            for (;;)
+            {
+                auto key = ec.prepareWait();
+                if ((sent = stamp.load(std::memory_order_acquire)) != 0)
+                {
+                    ec.cancelWait();
+                    break;
+                }
+                ec.commitWait(key);
+            }
+        }
+        else
+        {
+            parked.store(true, std::memory_order_release);
+            sem.acquire();
+            parked.store(false, std::memory_order_relaxed);
+            sent = stamp.load(std::memory_order_acquire);
+        }
+        const int64_t now = clock::now().time_since_epoch().count();
+        latencies_us.push_back((now - sent) / 1e3);
+        stamp.store(0, std::memory_order_release);
+    }
+
+    done.store(true);
+    if (!eventcount)
+        sem.release(producers); // nobody waits on it any more
+    for (auto& t : threads)
+        t.join();
+
+    std::sort(latencies_us.begin(), latencies_us.end());
+    const size_t n = latencies_us.size();
+    return {std::string(eventcount ? "EventCount" : "semaphore") +
+                " wake (" + std::to_string(producers) + " producers)",
+            n, latencies_us[n / 2], latencies_us[n * 99 / 100], latencies_us.back()};
+}
+
+// ────────────────────────────────────────────────────────────
+// Benchmark 17: Callback profiler overhead — spinSome() drains batches of
+//               published messages with the profiler off and on.
+// ────────────────────────────────────────────────────────────
+static BenchResult benchProfilerOverhead(int N, bool profiled)
+{
+    comm::Domain domain(1);
+    comm::Node node("profiler", domain, intraOpts());
+
+    std::atomic<int> count{0};
+    auto sub = node.createSubscriber<double>("/bench",
+        [&](const double&) { count.fetch_add(1, std::memory_order_relaxed); });
+    auto pub = node.createPublisher<double>("/bench");
+
+    comm::SingleThreadedExecutor exec;
+    if (profiled)
+        exec.enableProfiling(std::chrono::microseconds(100));
+    exec.addNode(&node);
+
+    constexpr int kBatch = 1000;
+    auto t1 = std::chrono::steady_clock::now();
+    for (int i = 0; i < N; i += kBatch)
+    {
+        for (int j = 0; j < kBatch; ++j) pub->emplace(1.0);
+        exec.spinSome();
+    }
+    auto t2 = std::chrono::steady_clock::now();
+    exec.removeNode(&node);
+
+    double ms = std::chrono::duration<double, std::milli>(t2 - t1).count();
+    return {profiled ? "SingleThreaded spinSome() profiled" : "SingleThreaded spinSome() unprofiled",
+            count.load(), ms, count.load() / (ms / 1000.0)};
+}
+
+// ────────────────────────────────────────────────────────────
+// Benchmark 18: Concurrent SHM publish — `threads` threads share one
+//               Publisher whose peers are subscribers in forked child
+//               processes.  Each child announces itself, opens the ring
+//               the parent creates for it and drains it until killed.
+//               Publish reads the peer snapshot lock-free; threads only
+//               meet on the per-peer ring lock.
+// ────────────────────────────────────────────────────────────
+[[noreturn]] static void drainShmPeer(size_t domain_id, const std::vector<std::string>& topics, pid_t parent)
+{
+    auto& ds = comm::discovery::DiscoveryService::getInstance(domain_id);
+    for (const auto& topic : topics)
+        ds.announceSubscriber(topic, typeid(double).name(), typeid(double).hash_code());
+
+    std::vector<std::unique_ptr<comm::transport::ShmRingReader>> readers(topics.size());
+    for (size_t i = 0; i < topics.size() && getppid() == parent;)
+    {
+        const std::string ring = comm::detail::makeRingName(
+            domain_id, comm::fnv1a_64(topics[i]), static_cast<uint32_t>(parent), static_cast<uint32_t>(getpid()));
+        try
+        {
+            readers[i] = std::make_unique<comm::transport::ShmRingReader>(ring);
+            ++i;
+        }
+        catch (...)
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+    }
+    const auto wait = std::chrono::milliseconds(topics.size() > 1 ? 1 : 10);
+    while (getppid() == parent)
+    {
+        for (auto& reader : readers)
+        {
+            if (reader && reader->acquireReadView(wait).data)
+                reader->releaseReadView();
+        }
+    }
+    _exit(0);
+}
+
+static BenchResult benchConcurrentShmPublish(int msgs_per_thread, int threads, int peers)
+{
+    const size_t domain_id = 180 + threads;
+    const std::string topic = "/bench/shm_mt_" + std::to_string(getpid()) + "_" + std::to_string(threads);
+    const pid_t parent = getpid();
+
+    std::vector<pid_t> children;
+    for (int i = 0; i < peers; ++i)
+    {
+        const pid_t child = fork();
+        if (child == 0)
+            drainShmPeer(domain_id, {topic}, parent);
+        children.push_back(child);
+    }
+
+    int published = 0;
+    double ms = 0.0;
+    {
+        comm::Domain domain(domain_id);
+        comm::Node node("shm_mt", domain, { .enable_net = false });
+
+        auto& ds = comm::discovery::DiscoveryService::getInstance(domain_id);
+        const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+        bool discovered = false;
+        while (!(discovered = ds.lookup(topic, comm::discovery::TopicEndpoint::Role::Subscriber).size() >= size_t(peers)) &&
+               std::chrono::steady_clock::now() < deadline)
+            std::this_thread::sleep_for(std::chrono::milliseconds(5));
+
+        auto pub = node.createPublisher<double>(topic);
+        if (discovered)
+        {
+            std::atomic<bool> go{false};
+            std::vector<std::thread> workers;
+            for (int t = 0; t < threads; ++t)
+            {
+                workers.emplace_back([&]
+                {
+                    while (!go.load(std::memory_order_acquire))
+                        std::this_thread::yield();
+                    for (int i = 0; i < msgs_per_thread; ++i)
+                        pub->publish(static_cast<double>(i));
+                });
+            }
+            auto t1 = std::chrono::steady_clock::now();
+            go.store(true, std::memory_order_release);
+            for (auto& w : workers)
+                w.join();
+            auto t2 = std::chrono::steady_clock::now();
+            published = threads * msgs_per_thread;
+            ms = std::chrono::duration<double, std::milli>(t2 - t1).count();
+        }
+    }
+
+    for (pid_t child : children)
+        kill(child, SIGTERM);
+    for (pid_t child : children)
+        waitpid(child, nullptr, 0);
+
+    if (published == 0)
+        return {"SHM publish: no peers discovered (skipped)", 0, 0.0, 0.0};
+    return {"SHM publish, " + std::to_string(threads) + " thread(s) -> " + std::to_string(peers) + " peers",
+            published, ms, published / (ms / 1000.0)};
+}
+
+// ────────────────────────────────────────────────────────────
+// Benchmark 19: Bursty sensor driver — a driver thread reads `burst`
+//               samples at a time (as from a hardware FIFO) and hands
+//               them on either one publish() at a time or in one
+//               publishBatch(); two subscribers on a spinning executor.
+// ────────────────────────────────────────────────────────────
+static BenchResult benchBurstPublish(int N, int burst, bool batch)
+{
+    comm::Domain domain(1);
+    comm::Node node("burst", domain, intraOpts());
+
+    std::atomic<int> count{0};
+    auto sub1 = node.createSubscriber<double>("/bench/burst",
+        [&](const double&) { count.fetch_add(1, std::memory_order_relaxed); });
+    auto sub2 = node.createSubscriber<double>("/bench/burst",
+        [&](const double&) { count.fetch_add(1, std::memory_order_relaxed); });
+    auto pub = node.createPublisher<double>("/bench/burst");
+
+    comm::SingleThreadedExecutor exec;
+    exec.addNode(&node);
+    std::thread spin_th([&] { exec.spin(); });
+
+    std::vector<double> fifo(burst);
+    const int expected = (N / burst) * burst * 2;
+    auto t1 = std::chrono::steady_clock::now();
+    for (int i = 0; i + burst <= N; i += burst)
+    {
+        for (int j = 0; j < burst; ++j)
+            fifo[j] = static_cast<double>(i + j);
+        if (batch)
+            pub->publishBatch(std::span<const double>(fifo));
+        else
+            for (double v : fifo) pub->publish(v);
+    }
+    while (count.load(std::memory_order_relaxed) < expected)
+        std::this_thread::yield();
+    auto t2 = std::chrono::steady_clock::now();
+
+    exec.stop();
+    spin_th.join();
+    exec.removeNode(&node);
+
+    double ms = std::chrono::duration<double, std::milli>(t2 - t1).count();
+    return {std::string(batch ? "publishBatch()" : "publish() per msg") + ", burst " + std::to_string(burst) + ", 2 subs",
+            count.load(), ms, count.load() / (ms / 1000.0)};
+}
+
+// ────────────────────────────────────────────────────────────
+// Benchmark 20: Independent topics — `threads` threads, each with its
+//               own Publisher on its own topic, one forked subscriber
+//               process draining all of them.  Sequence numbers and
+//               clock stamps are per publisher, so the threads share
+//               no counter.
+// ────────────────────────────────────────────────────────────
+static BenchResult benchPerTopicShmPublish(int msgs_per_thread, int threads)
+{
+    const size_t domain_id = 190 + threads;
+    std::vector<std::string> topics;
+    for (int t = 0; t < threads; ++t)
+        topics.push_back("/bench/shm_topic_" + std::to_string(getpid()) + "_" + std::to_string(t));
+    const pid_t parent = getpid();
+
+    const pid_t child = fork();
+    if (child == 0)
+        drainShmPeer(domain_id, topics, parent);
+
+    int published = 0;
+    double ms = 0.0;
+    {
+        comm::Domain domain(domain_id);
+        comm::Node node("shm_topics", domain, { .enable_net = false });
+
+        auto& ds = comm::discovery::DiscoveryService::getInstance(domain_id);
+        const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+        auto all_discovered = [&]
+        {
+            for (const auto& topic : topics)
+            {
+                if (ds.lookup(topic, comm::discovery::TopicEndpoint::Role::Subscriber).empty())
+                    return false;
+            }
+            return true;
+        };
+        bool discovered = false;
+        while (!(discovered = all_discovered()) && std::chrono::steady_clock::now() < deadline)
+            std::this_thread::sleep_for(std::chrono::milliseconds(5));
+
+        std::vector<std::shared_ptr<comm::Publisher<double>>> pubs;
+        for (const auto& topic : topics)
+            pubs.push_back(node.createPublisher<double>(topic));
+        if (discovered)
+        {
+            std::atomic<bool> go{false};
+            std::vector<std::thread> workers;
+            for (int t = 0; t < threads; ++t)
+            {
+                workers.emplace_back([&, t]
+                {
+                    auto& pub = *pubs[t];
+                    while (!go.load(std::memory_order_acquire))
+                        std::this_thread::yield();
+                    for (int i = 0; i < msgs_per_thread; ++i)
+                        pub.publish(static_cast<double>(i));
+                });
+            }
+            auto t1 = std::chrono::steady_clock::now();
+            go.store(true, std::memory_order_release);
+            for (auto& w : workers)
+                w.join();
+            auto t2 = std::chrono::steady_clock::now();
+            published = threads * msgs_per_thread;
+            ms = std::chrono::duration<double, std::milli>(t2 - t1).count();
+        }
+    }
+
+    kill(child, SIGTERM);
+    waitpid(child, nullptr, 0);
+
+    if (published == 0)
+        return {"SHM publish: no peers discovered (skipped)", 0, 0.0, 0.0};
+    return {"SHM publish, " + std::to_string(threads) + " thread(s) on own topics",
+            published, ms, published / (ms / 1000.0)};
+}
+
+// ────────────────────────────────────────────────────────────
+// Benchmark 21: Sequence + stamp allocation alone — `threads` threads
+//               number and stamp messages either from one shared
+//               counter (what Domain::allocateSeqRange did for every
+//               publish) or each from its own publisher's counter and
+//               HybridClock.  Isolates what benchmark 20 removed from
+//               the publish path.
+// ────────────────────────────────────────────────────────────
+static BenchResult benchSeqAllocation(int msgs_per_thread, int threads, bool shared)
+{
+    struct alignas(64) PublisherState
+    {
+        std::atomic<uint64_t> next_seq{1};
+        comm::HybridClock clock;
+    };
+    alignas(64) std::atomic<uint64_t> global_seq{1};
+    std::vector<PublisherState> pubs(threads);
+    std::atomic<uint64_t> sink{0};
+
+    std::atomic<bool> go{false};
+    std::vector<std::thread> workers;
+    for (int t = 0; t < threads; ++t)
+    {
+        workers.emplace_back([&, t]
+        {
+            auto& pub = pubs[t];
+            uint64_t sum = 0;
+            while (!go.load(std::memory_order_acquire))
+                std::this_thread::yield();
+            for (int i = 0; i < msgs_per_thread; ++i)
+            {
+                const uint64_t now = comm::platform::steadyNowNs();
+                if (shared)
+                    sum += global_seq.fetch_add(1, std::memory_order_relaxed) ^ now;
+                else
+                    sum += pub.next_seq.fetch_add(1, std::memory_order_relaxed) ^ pub.clock.tick(now);
+            }
+            sink.fetch_add(sum, std::memory_order_relaxed);
+        });
+    }
+    auto t1 = std::chrono::steady_clock::now();
+    go.store(true, std::memory_order_release);
+    for (auto& w : workers)
+        w.join();
+    auto t2 = std::chrono::steady_clock::now();
+
+    const int total = threads * msgs_per_thread;
+    double ms = std::chrono::duration<double, std::milli>(t2 - t1).count();
+    return {std::string(shared ? "Shared counter" : "Per-publisher seq + HybridClock") + ", " +
+                std::to_string(threads) + " thread(s)",
+            total, ms, total / (ms / 1000.0)};
+}
+
 int main()
 {
     const int N = 5'000'000;  // 5M messages per benchmark
@@ -348,7 +1328,7 @@ int main()
     std::cout << std::left << std::setw(52) << "Test"
               << std::right << std::setw(12) << "Throughput"
               << "    " << std::setw(8) << "Time" << "\n";
-    std::cout << std::string(78, '─') << "\n";
+    printRule();
 
     std::vector<BenchResult> results;
 
@@ -376,9 +1356,7 @@ int main()
     results.push_back(benchTimeOrdered(N));
     printResult(results.back());
 
-    std::cout << std::string(78, '─') << "\n";
-    std::cout << "  Fan-out scaling (1 publisher → N subscribers)\n";
-    std::cout << std::string(78, '─') << "\n";
+    printSection("Fan-out scaling (1 publisher → N subscribers)");
 
     // 7. Fan-out: 1, 2, 4, 8, 16 subscribers
     for (int subs : {1, 2, 4, 8, 16})
@@ -388,9 +1366,7 @@ int main()
         printResult(results.back());
     }
 
-    std::cout << std::string(78, '─') << "\n";
-    std::cout << "  Multi-publisher contention (N publishers → 1 subscriber)\n";
-    std::cout << std::string(78, '─') << "\n";
+    printSection("Multi-publisher contention (N publishers → 1 subscriber)");
 
     // 8. Multi-publisher: 1, 2, 4, 8 publishers
     for (int pubs : {1, 2, 4, 8})
@@ -400,6 +1376,208 @@ int main()
         printResult(results.back());
     }
 
+    printRule();
+    std::cout << "  Work-stealing scaling (8 independent MutExcl groups, CPU-bound callbacks)\n";
+    std::cout << "  (hardware threads: " << std::thread::hardware_concurrency() << ")\n";
+    printRule();
+
+    // 9. Independent groups: 1, 2, 4, 8 worker threads
+    double base_throughput = 0;
+    for (size_t threads : {1, 2, 4, 8})
+    {
+        results.push_back(benchIndependentGroups(50'000, 8, threads));
+        printResult(results.back());
+        if (threads == 1)
+            base_throughput = results.back().throughput;
+        std::cout << "    speedup vs 1T: " << std::fixed << std::setprecision(2)
+                  << results.back().throughput / base_throughput << "x\n";
+    }
+
+    printSection("Control-topic latency under bulk overload (1 kHz, p50 / p99 / max)");
+
+    // 10. Ready policies
+    printLatency(benchControlLatency(comm::ReadyPolicy::Fifo, "[Fifo]"));
+    printLatency(benchControlLatency(comm::ReadyPolicy::Priority, "[Priority]"));
+    printLatency(benchControlLatency(comm::ReadyPolicy::EarliestDeadline, "[EarliestDeadline]"));
+
+    printSection("Time-ordered multi-sensor fusion (4 groups x 3 sensors, idle=1ms)");
+
+    // 11. Global merge vs per-group merge on 1, 2, 4 threads
+    {
+        using namespace std::chrono_literals;
+        constexpr int kPerTopic = 20'000;
+        constexpr int kGroups   = 4;
+
+        comm::TimeOrderedExecutor single({.idle_timeout = 1ms});
+        results.push_back(benchSensorFusion("TimeOrdered [1T, global order]", kPerTopic, kGroups, single));
+        printResult(results.back());
+        const double single_throughput = results.back().throughput;
+
+        for (size_t threads : {1, 2, 4})
+        {
+            comm::ParallelTimeOrderedExecutor exec(threads, 1ms);
+            results.push_back(benchSensorFusion(
+                "ParallelTimeOrdered [" + std::to_string(threads) + "T, per-group order]",
+                kPerTopic, kGroups, exec));
+            printResult(results.back());
+            std::cout << "    speedup vs TimeOrdered: " << std::fixed << std::setprecision(2)
+                      << results.back().throughput / single_throughput << "x\n";
+        }
+    }
+
+    printSection("Aggregating subscriber: per-message vs batch callback");
+
+    // 12. Batch callbacks
+    results.push_back(benchBatchCallback(N, false, 0));
+    printResult(results.back());
+    const double per_msg_throughput = results.back().throughput;
+    for (size_t max_batch : {size_t{16}, size_t{256}, size_t{4096}})
+    {
+        results.push_back(benchBatchCallback(N, true, max_batch));
+        printResult(results.back());
+        std::cout << "    speedup vs per-message: " << std::fixed << std::setprecision(2)
+                  << results.back().throughput / per_msg_throughput << "x\n";
+    }
+
+    printSection("Periodic jitter: callback lateness behind schedule (p50 / p99 / max)");
+
+    // 13. Executor timer vs sleep_until() publisher
+    {
+        using namespace std::chrono_literals;
+        for (auto [period, rate] : {std::pair{1000us, "1 kHz"}, std::pair{100us, "10 kHz"}})
+        {
+            double cpu = 0.0;
+            {
+                comm::SingleThreadedExecutor exec;
+                printLatency(benchTimerJitter(period, true, exec,
+                    std::string("Timer [SingleThreaded, ") + rate + "]", cpu));
+                std::cout << "    process CPU: " << std::fixed << std::setprecision(1) << cpu << "%\n";
+            }
+            {
+                comm::MultiThreadedExecutor exec(2);
+                printLatency(benchTimerJitter(period, true, exec,
+                    std::string("Timer [MultiThreaded 2T, ") + rate + "]", cpu));
+                std::cout << "    process CPU: " << std::fixed << std::setprecision(1) << cpu << "%\n";
+            }
+            {
+                comm::SingleThreadedExecutor exec;
+                printLatency(benchTimerJitter(period, false, exec,
+                    std::string("sleep_until thread [") + rate + "]", cpu));
+                std::cout << "    process CPU: " << std::fixed << std::setprecision(1) << cpu << "%\n";
+            }
+        }
+    }
+
+    printSection("Pairing pipeline (A then matching B): callbacks vs coroutine");
+
+    // 14. Callback state machine vs co_await
+    for (bool live : {false, true})
+    {
+        results.push_back(benchPairing(N / 2, false, live));
+        printResult(results.back());
+        const double callback_throughput = results.back().throughput;
+        results.push_back(benchPairing(N / 2, true, live));
+        printResult(results.back());
+        std::cout << "    speedup vs callbacks: " << std::fixed << std::setprecision(2)
+                  << results.back().throughput / callback_throughput << "x\n";
+    }
+
+    printSection("Wait policy: publish→callback latency (p50 / p99 / max) vs CPU");
+
+    // 15. BusySpin / SpinThenPark / SpinThenPark + 20 µs budget / ParkOnly
+    {
+        using namespace std::chrono_literals;
+        struct Variant { comm::WaitPolicy policy; std::chrono::microseconds budget; const char* name; };
+        const Variant variants[] = {
+            {comm::WaitPolicy::BusySpin,     0us,  "BusySpin"},
+            {comm::WaitPolicy::SpinThenPark, 0us,  "SpinThenPark"},
+            {comm::WaitPolicy::SpinThenPark, 20us, "SpinThenPark 20us budget"},
+            {comm::WaitPolicy::ParkOnly,     0us,  "ParkOnly"},
+        };
+        for (auto [interval, rate] : {std::pair{20us, "50 kHz"}, std::pair{200us, "5 kHz"},
+                                      std::pair{2000us, "500 Hz"}})
+        {
+            for (const auto& v : variants)
+            {
+                double cpu = 0.0;
+                uint64_t window = 0;
+                printLatency(benchWaitPolicy(v.policy, interval, v.budget,
+                    std::string(v.name) + " [" + rate + "]", cpu, window));
+                std::cout << "    process CPU: " << std::fixed << std::setprecision(1) << cpu << "%"
+                          << "   spin window: "
+                          << (window == UINT64_MAX ? std::string("unbounded")
+                                                   : std::to_string(window / 1000) + " us")
+                          << "\n";
+            }
+        }
+    }
+
+    printSection("Wake primitive: EventCount vs counting_semaphore");
+
+    // 16. Notify cost with nobody parked, then wake latency of a parked consumer
+    for (int producers : {1, 4, 16})
+    {
+        for (bool eventcount : {false, true})
+        {
+            results.push_back(benchNotifyCost(eventcount, producers, N / producers));
+            printResult(results.back());
+        }
+    }
+    for (int producers : {1, 4, 16})
+    {
+        for (bool eventcount : {false, true})
+            printLatency(benchWakeLatency(eventcount, producers, 5'000));
+    }
+
+    printSection("Callback profiler overhead");
+
+    // 17. Profiling off vs on
+    for (bool profiled : {false, true})
+    {
+        results.push_back(benchProfilerOverhead(N, profiled));
+        printResult(results.back());
+    }
+
+    printSection("Concurrent publish to SHM peers");
+
+    // 18. One Publisher shared by 1 and 4 threads, 2 subscriber processes
+    for (int threads : {1, 4})
+    {
+        results.push_back(benchConcurrentShmPublish(N / threads, threads, 2));
+        printResult(results.back());
+    }
+
+    printSection("Bursty sensor driver: per-message vs batch publish");
+
+    // 19. Bursts of 8 / 64 samples
+    for (int burst : {8, 64})
+    {
+        for (bool batch : {false, true})
+        {
+            results.push_back(benchBurstPublish(N, burst, batch));
+            printResult(results.back());
+        }
+    }
+
+    printSection("Independent topics: per-publisher sequence spaces");
+
+    // 20. 1 and 8 threads, one topic each
+    for (int threads : {1, 8})
+    {
+        results.push_back(benchPerTopicShmPublish(N / threads, threads));
+        printResult(results.back());
+    }
+
+    // 21. The allocation alone: shared counter vs per publisher
+    for (int threads : {1, 8})
+    {
+        for (bool shared : {true, false})
+        {
+            results.push_back(benchSeqAllocation(N / threads, threads, shared));
+            printResult(results.back());
+        }
+    }
+
     std::cout << "═══════════════════════════════════════════════════════════════════════════\n";
     std::cout << "Done.\n";
     return 0;
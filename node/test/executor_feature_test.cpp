@@ -10,6 +10,21 @@
  *  6. Empty queue spinSome (returns immediately)
  *  7. Multi-node sharing one executor
  *  8. Late subscriber (subscriber created after messages published)
+ *  9. Cross-executor SeqOrdered + TimeOrdered
+ * 10. Stop from callback
+ * 11. Work-stealing: independent MutuallyExclusive groups run concurrently
+ * 12. ReadyPolicy: priority / earliest-deadline ordering, batch yielding
+ * 13. TimeOrdered K-way merge: per-source watermarks, idle timeout, late entries
+ * 14. ParallelTimeOrdered: order per callback group / ordering domain, no overlap
+ * 15. SeqOrdered gaps: consumed seqs (filter, KeepLast), gap timeout, ring overflow,
+ *     OrderKey merge of messages from other processes
+ * 16. Batch callbacks: one span per take, max_batch_size, max_batch_wait
+ * 17. Thread options: CPU set, names, scheduling errors for executor and IO threads
+ * 18. Timers: period, cancel/reset, coalesced overruns, group exclusivity, all executors
+ * 19. Coroutines: co_await next() pairing, resume thread, schedule(), task lifetime
+ * 20. Wait policy: busy-spin / spin-then-park / park-only, adaptive window, latency budgets
+ * 21. EventCount: timed wait, exact notifyOne/notifyAll, no lost wake-ups, wakeup() tokens
+ * 22. Callback profiler: queue wait / exec histograms, over-budget counts, per-thread shards
  */
 
 #include <iostream>
@@ -20,13 +35,28 @@
 #include <mutex>
 #include <cassert>
 #include <set>
+#include <memory>
+#include <string>
+#include <algorithm>
+#include <span>
+#include <ctime>
+
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#endif
 
 #include <lux/communication/Node.hpp>
 #include <lux/communication/CallbackGroupBase.hpp>
+#include <lux/communication/Timer.hpp>
 #include <lux/communication/executor/SingleThreadedExecutor.hpp>
 #include <lux/communication/executor/MultiThreadedExecutor.hpp>
 #include <lux/communication/executor/SeqOrderedExecutor.hpp>
 #include <lux/communication/executor/TimeOrderedExecutor.hpp>
+#include <lux/communication/executor/ParallelTimeOrderedExecutor.hpp>
+#include <lux/communication/executor/CoroutineExecutor.hpp>
+#include <lux/communication/EventCount.hpp>
+#include <lux/communication/HybridClock.hpp>
 
 namespace comm = lux::communication;
 
@@ -273,7 +303,7 @@ static void testSpinSomeVsSpin()
         testSpinSomeAll("spinSome() SeqOrdered", exec);
     }
     {
-        comm::TimeOrderedExecutor exec(std::chrono::nanoseconds{0});
+        comm::TimeOrderedExecutor exec;
         testSpinSomeAll("spinSome() TimeOrdered", exec);
     }
 }
@@ -465,7 +495,7 @@ static void testEmptySpinSome()
         testExec("Empty spinSome() SeqOrdered", exec);
     }
     {
-        comm::TimeOrderedExecutor exec(std::chrono::nanoseconds{0});
+        comm::TimeOrderedExecutor exec;
         testExec("Empty spinSome() TimeOrdered", exec);
     }
 
@@ -578,7 +608,7 @@ static void testAllExecutorCorrectness()
         runTest("SeqOrdered delivers all", exec);
     }
     {
-        comm::TimeOrderedExecutor exec(std::chrono::nanoseconds{0});
+        comm::TimeOrderedExecutor exec;
         runTest("TimeOrdered(offset=0) delivers all", exec);
     }
 }
@@ -609,7 +639,7 @@ static void testCrossExecutorSeqTime()
     comm::SeqOrderedExecutor exec_seq;
     exec_seq.addNode(&seqNode);
 
-    comm::TimeOrderedExecutor exec_time(std::chrono::nanoseconds{0});
+    comm::TimeOrderedExecutor exec_time;
     exec_time.addNode(&timeNode);
 
     std::thread t1([&] { exec_seq.spin(); });
@@ -671,6 +701,1735 @@ static void testStopFromCallback()
 }
 
 // ═══════════════════════════════════════════════════════════════
+// Test 11: Independent MutuallyExclusive Groups
+//   Four nodes (one default MutExcl group each, two subscribers per
+//   group) on a 4-thread MultiThreadedExecutor.  Different groups
+//   must overlap; callbacks within one group must not.
+// ═══════════════════════════════════════════════════════════════
+static void testIndependentGroupsConcurrent()
+{
+    std::cout << "\n=== Test 11: Independent MutExcl Groups Run Concurrently ===\n";
+    constexpr int kGroups = 4;
+    constexpr int N = 200;
+
+    comm::Domain domain(113);
+    std::vector<std::unique_ptr<comm::Node>> nodes;
+    std::vector<std::shared_ptr<comm::Subscriber<int>>> subs;
+    std::vector<std::shared_ptr<comm::Publisher<int>>> pubs;
+
+    struct GroupState
+    {
+        std::atomic<int>  in_use{0};
+        std::atomic<bool> overlap{false};
+    };
+    GroupState states[kGroups];
+    std::atomic<int> active{0};
+    std::atomic<int> peak{0};
+    std::atomic<int> count{0};
+
+    for (int g = 0; g < kGroups; ++g)
+    {
+        nodes.push_back(std::make_unique<comm::Node>("ws" + std::to_string(g), domain, intraOpts()));
+        const std::string topic = "/ws_" + std::to_string(g);
+        for (int k = 0; k < 2; ++k)
+        {
+            subs.push_back(nodes.back()->createSubscriber<int>(topic,
+                [&, g](const int&) {
+                    auto& st = states[g];
+                    if (st.in_use.fetch_add(1) != 0)
+                        st.overlap.store(true);
+                    int now = active.fetch_add(1) + 1;
+                    int old = peak.load();
+                    while (now > old && !peak.compare_exchange_weak(old, now)) {}
+
+                    // Sleep so groups overlap even on a single core.
+                    std::this_thread::sleep_for(std::chrono::microseconds(100));
+
+                    active.fetch_sub(1);
+                    st.in_use.fetch_sub(1);
+                    count.fetch_add(1);
+                }));
+        }
+        pubs.push_back(nodes.back()->createPublisher<int>(topic));
+    }
+
+    comm::MultiThreadedExecutor exec(4);
+    for (auto& n : nodes) exec.addNode(n.get());
+    std::thread t([&] { exec.spin(); });
+
+    for (int i = 0; i < N; ++i)
+        for (auto& p : pubs) p->publish(i);
+
+    const int expected = N * kGroups * 2;
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+    while (count.load() < expected && std::chrono::steady_clock::now() < deadline)
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+
+    exec.stop(); t.join();
+
+    bool any_overlap = false;
+    for (auto& st : states) any_overlap |= st.overlap.load();
+
+    check(count.load() == expected, "All groups delivered",
+          (std::to_string(count.load()) + "/" + std::to_string(expected)).c_str());
+    check(!any_overlap, "No overlap within a MutExcl group");
+    check(peak.load() > 1, "Different MutExcl groups ran concurrently",
+          ("peak concurrency " + std::to_string(peak.load())).c_str());
+
+    for (auto& n : nodes) n->stop();
+}
+
+// ═══════════════════════════════════════════════════════════════
+// Test 12: Ready Policy
+//   Priority: higher subscriber / group priority runs first.
+//   Batching: a flooded low-priority subscriber yields after one batch.
+//   EarliestDeadline: shortest latency_budget / deadline runs first,
+//   subscribers without one run last.
+// ═══════════════════════════════════════════════════════════════
+static void testReadyPolicy()
+{
+    std::cout << "\n=== Test 12: Ready Policy ===\n";
+
+    comm::Domain domain(114);
+    comm::Node node("ready_policy", domain, intraOpts());
+    comm::CallbackGroupBase group_mid(&node, comm::CallbackGroupType::MutuallyExclusive);
+    group_mid.setPriority(5);
+
+    std::vector<char> order;
+    auto logger = [&order](char tag) { return [&order, tag](const int&) { order.push_back(tag); }; };
+
+    // ── Priority ──
+    {
+        comm::SingleThreadedExecutor exec;
+        exec.setReadyPolicy(comm::ReadyPolicy::Priority);
+        exec.addNode(&node);
+
+        comm::SubscribeOptions high_opts;
+        high_opts.priority = 10;
+        auto pub_l = node.createPublisher<int>("/rp_low");
+        auto pub_m = node.createPublisher<int>("/rp_mid");
+        auto pub_h = node.createPublisher<int>("/rp_high");
+        auto sub_l = node.createSubscriber<int>("/rp_low", logger('L'));
+        auto sub_m = node.createSubscriber<int>("/rp_mid", logger('M'), &group_mid);
+        auto sub_h = node.createSubscriber<int>("/rp_high", logger('H'), nullptr, high_opts);
+
+        order.clear();
+        pub_l->publish(1);
+        pub_m->publish(1);
+        pub_h->publish(1);
+        exec.spinSome();
+        check(std::string(order.begin(), order.end()) == "HML",
+              "Priority: subscriber and group priority order",
+              std::string(order.begin(), order.end()).c_str());
+
+        // Flood the low-priority topic; the high-priority message published
+        // from the first low callback must not wait for the whole backlog.
+        constexpr int kFlood = 200;
+        order.clear();
+        bool injected = false;
+        auto sub_flood = node.createSubscriber<int>("/rp_flood",
+            [&](const int&) {
+                order.push_back('F');
+                if (!injected) { injected = true; pub_h->publish(2); }
+            });
+        auto pub_flood = node.createPublisher<int>("/rp_flood");
+        for (int i = 0; i < kFlood; ++i)
+            pub_flood->publish(i);
+        exec.setReadyPolicy(comm::ReadyPolicy::Priority, 16);
+        exec.spinSome();
+
+        const auto h_pos = std::find(order.begin(), order.end(), 'H') - order.begin();
+        check(order.size() == kFlood + 1, "Priority: flood fully delivered",
+              (std::to_string(order.size()) + " callbacks").c_str());
+        check(h_pos <= 16, "Priority: flooded subscriber yields after one batch",
+              ("high ran after " + std::to_string(h_pos) + " flood callbacks").c_str());
+        exec.removeNode(&node);
+    }
+
+    // ── Earliest deadline ──
+    {
+        comm::SingleThreadedExecutor exec;
+        exec.setReadyPolicy(comm::ReadyPolicy::EarliestDeadline);
+        exec.addNode(&node);
+
+        comm::SubscribeOptions slow_opts;
+        slow_opts.qos.deadline = std::chrono::milliseconds(50);
+        comm::SubscribeOptions fast_opts;
+        fast_opts.qos.latency_budget = std::chrono::microseconds(500);
+        comm::SubscribeOptions none_opts;
+        none_opts.priority = 100; // no deadline: runs after all deadlines
+
+        auto pub_s = node.createPublisher<int>("/edf_slow");
+        auto pub_f = node.createPublisher<int>("/edf_fast");
+        auto pub_n = node.createPublisher<int>("/edf_none");
+        auto sub_s = node.createSubscriber<int>("/edf_slow", logger('S'), nullptr, slow_opts);
+        auto sub_f = node.createSubscriber<int>("/edf_fast", logger('F'), nullptr, fast_opts);
+        auto sub_n = node.createSubscriber<int>("/edf_none", logger('N'), nullptr, none_opts);
+
+        order.clear();
+        pub_n->publish(1);
+        pub_s->publish(1);
+        pub_f->publish(1);
+        exec.spinSome();
+        check(std::string(order.begin(), order.end()) == "FSN",
+              "EarliestDeadline: earliest absolute deadline first",
+              std::string(order.begin(), order.end()).c_str());
+        exec.removeNode(&node);
+    }
+
+    // ── A group destroyed before its subscribers detaches them ──
+    {
+        auto group = std::make_unique<comm::CallbackGroupBase>(&node);
+        comm::SingleThreadedExecutor exec;
+        exec.addNode(&node);
+
+        auto pub   = node.createPublisher<int>("/rp_orphan");
+        auto sub   = node.createSubscriber<int>("/rp_orphan", logger('O'), group.get());
+        std::atomic<int> ticks{0};
+        auto timer = node.createTimer(std::chrono::milliseconds(1), [&] { ++ticks; }, group.get());
+
+        order.clear();
+        pub->publish(1);
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+        exec.spinSome();
+        check(order.size() == 1 && ticks.load() > 0, "Group attached: message and timer run");
+
+        group.reset();
+        check(sub->callbackGroup() == nullptr && timer->callbackGroup() == nullptr,
+              "Destroyed group detaches its subscribers and timers");
+
+        // Publishing, re-arming the timer and receiving must not reach the
+        // dead group; nothing runs them any more.
+        order.clear();
+        ticks = 0;
+        pub->publish(2);
+        pub->publishBatch(std::vector<int>{3, 4});
+        timer->reset();
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+        exec.spinSome();
+        check(order.empty() && ticks.load() == 0,
+              "Detached subscriber and timer are not scheduled after publish");
+
+        sub->takeAll();
+        check(order.size() == 3, "Detached subscriber still hands out what it received",
+              std::to_string(order.size()).c_str());
+        exec.removeNode(&node);
+    }
+
+    node.stop();
+}
+
+// ═══════════════════════════════════════════════════════════════
+// Test 13: TimeOrdered Watermark Merge
+//   Two stamped sources.  An entry runs only once every active source
+//   has progressed past it; an idle source stops holding the merge and
+//   a message older than one already released is counted as late.
+// ═══════════════════════════════════════════════════════════════
+struct StampedSample
+{
+    lux::communication::builtin_msgs::common_msgs::TimestampS timestamp;
+    char source;
+};
+
+static void testTimeOrderedWatermarks()
+{
+    std::cout << "\n=== Test 13: TimeOrdered Watermark Merge ===\n";
+    using namespace std::chrono_literals;
+    constexpr auto kIdle = 100ms;
+
+    comm::Domain domain(115);
+    comm::Node node("watermark", domain, intraOpts());
+
+    std::string order;
+    std::mutex order_mutex;
+    auto record = [&](const StampedSample& s)
+    {
+        std::lock_guard lk(order_mutex);
+        order += s.source;
+        order += std::to_string(comm::builtin_msgs::common_msgs::timestamp_to_ns(s.timestamp));
+        order += ' ';
+    };
+    auto sub_a = node.createSubscriber<StampedSample>("/wm_a", record);
+    auto sub_b = node.createSubscriber<StampedSample>("/wm_b", record);
+    auto pub_a = node.createPublisher<StampedSample>("/wm_a");
+    auto pub_b = node.createPublisher<StampedSample>("/wm_b");
+
+    auto publish = [](auto& pub, char source, uint64_t ts)
+    {
+        StampedSample s{};
+        comm::builtin_msgs::common_msgs::timestamp_from_ns(s.timestamp, ts);
+        s.source = source;
+        pub->publish(s);
+    };
+    auto snapshot = [&]
+    {
+        std::lock_guard lk(order_mutex);
+        return order;
+    };
+
+    {
+        comm::TimeOrderedExecutor exec({.idle_timeout = kIdle});
+        exec.addNode(&node);
+
+        publish(pub_a, 'A', 10);
+        publish(pub_a, 'A', 30);
+        publish(pub_b, 'B', 20);
+        publish(pub_b, 'B', 40);
+        exec.spinSome();
+        check(snapshot() == "A10 B20 A30 ", "Merge stops at the watermark of an empty source",
+              snapshot().c_str());
+        check(exec.pendingSize() == 1, "Newer entry held back");
+
+        publish(pub_a, 'A', 50);
+        exec.spinSome();
+        check(snapshot() == "A10 B20 A30 B40 ", "Held entry released once the other source advances",
+              snapshot().c_str());
+
+        std::this_thread::sleep_for(kIdle + 50ms);
+        exec.spinSome();
+        check(snapshot() == "A10 B20 A30 B40 A50 ", "Idle source no longer holds the merge",
+              snapshot().c_str());
+
+        publish(pub_b, 'B', 45);
+        exec.spinSome();
+        check(exec.lateCount() == 1, "Message older than a released one counted late",
+              ("late=" + std::to_string(exec.lateCount())).c_str());
+        exec.removeNode(&node);
+    }
+
+    // spin() must wake up on its own when a waiting source turns idle.
+    {
+        order.clear();
+        comm::TimeOrderedExecutor exec({.idle_timeout = kIdle});
+        exec.addNode(&node);
+        std::thread t([&] { exec.spin(); });
+
+        publish(pub_a, 'A', 100);
+        publish(pub_b, 'B', 110);
+        publish(pub_b, 'B', 120);
+
+        auto deadline = std::chrono::steady_clock::now() + 2s;
+        while (snapshot() != "A100 B110 B120 " && std::chrono::steady_clock::now() < deadline)
+            std::this_thread::sleep_for(5ms);
+        exec.stop(); t.join();
+
+        check(snapshot() == "A100 B110 B120 ", "spin() releases held entries after the idle timeout",
+              snapshot().c_str());
+        exec.removeNode(&node);
+    }
+
+    node.stop();
+}
+
+// ═══════════════════════════════════════════════════════════════
+// Test 14: ParallelTimeOrderedExecutor — each callback group is an
+//          ordering domain; domains do not hold each other back and
+//          callbacks of one domain never overlap.
+// ═══════════════════════════════════════════════════════════════
+static void testParallelTimeOrdered()
+{
+    std::cout << "\n=== Test 14: ParallelTimeOrdered Domains ===\n";
+    using namespace std::chrono_literals;
+
+    comm::Domain domain(116);
+    comm::Node node("ptorder", domain, intraOpts());
+    comm::CallbackGroupBase group_1(&node, comm::CallbackGroupType::MutuallyExclusive);
+    comm::CallbackGroupBase group_2(&node, comm::CallbackGroupType::MutuallyExclusive);
+
+    struct GroupLog
+    {
+        std::mutex            mutex;
+        std::string           order;
+        uint64_t              last_ts = 0;
+        int                   count = 0;
+        bool                  monotonic = true;
+        std::atomic<bool>     in_callback{false};
+        std::atomic<bool>     overlapped{false};
+    };
+    GroupLog log_1, log_2;
+
+    auto recorder = [](GroupLog& log)
+    {
+        return [&log](const StampedSample& s)
+        {
+            if (log.in_callback.exchange(true))
+                log.overlapped = true;
+            {
+                std::lock_guard lk(log.mutex);
+                const uint64_t ts = comm::builtin_msgs::common_msgs::timestamp_to_ns(s.timestamp);
+                if (ts < log.last_ts)
+                    log.monotonic = false;
+                log.last_ts = ts;
+                ++log.count;
+                if (log.order.size() < 64)
+                {
+                    log.order += s.source;
+                    log.order += std::to_string(ts);
+                    log.order += ' ';
+                }
+            }
+            log.in_callback = false;
+        };
+    };
+    auto sub_a = node.createSubscriber<StampedSample>("/pt_a", recorder(log_1), &group_1);
+    auto sub_b = node.createSubscriber<StampedSample>("/pt_b", recorder(log_1), &group_1);
+    auto sub_c = node.createSubscriber<StampedSample>("/pt_c", recorder(log_2), &group_2);
+    auto sub_d = node.createSubscriber<StampedSample>("/pt_d", recorder(log_2), &group_2);
+    auto pub_a = node.createPublisher<StampedSample>("/pt_a");
+    auto pub_b = node.createPublisher<StampedSample>("/pt_b");
+    auto pub_c = node.createPublisher<StampedSample>("/pt_c");
+    auto pub_d = node.createPublisher<StampedSample>("/pt_d");
+
+    auto publish = [](auto& pub, char source, uint64_t ts)
+    {
+        StampedSample s{};
+        comm::builtin_msgs::common_msgs::timestamp_from_ns(s.timestamp, ts);
+        s.source = source;
+        pub->publish(s);
+    };
+    auto snapshot = [](GroupLog& log)
+    {
+        std::lock_guard lk(log.mutex);
+        return log.order;
+    };
+    auto reset = [](GroupLog& log)
+    {
+        std::lock_guard lk(log.mutex);
+        log.order.clear();
+        log.last_ts = 0;
+        log.count = 0;
+        log.monotonic = true;
+    };
+
+    // Group 1 is held at B's watermark; group 2 must not wait for it.
+    {
+        comm::ParallelTimeOrderedExecutor exec(2, 200ms);
+        exec.addNode(&node);
+
+        publish(pub_a, 'A', 10);
+        publish(pub_a, 'A', 30);
+        publish(pub_b, 'B', 20);
+        publish(pub_b, 'B', 40);
+        publish(pub_c, 'C', 100);
+        exec.spinSome();
+
+        check(snapshot(log_1) == "A10 B20 A30 ", "Group merged by timestamp", snapshot(log_1).c_str());
+        check(snapshot(log_2) == "C100 ", "Other group not held back by it", snapshot(log_2).c_str());
+        check(exec.domainCount() == 2, "One ordering domain per callback group");
+        exec.removeNode(&node);
+    }
+
+    // Two groups mapped onto one ordering domain merge together.
+    {
+        reset(log_1);
+        reset(log_2);
+        comm::ParallelTimeOrderedExecutor exec(2, 200ms);
+        exec.setOrderingDomain(&group_1, 7);
+        exec.setOrderingDomain(&group_2, 7);
+        exec.addNode(&node);
+
+        publish(pub_a, 'A', 10);
+        publish(pub_c, 'C', 100);
+        exec.spinSome();
+
+        check(exec.domainCount() == 1, "setOrderingDomain shares one domain");
+        check(snapshot(log_1) == "A10 " && snapshot(log_2).empty(),
+              "Shared domain holds C behind A's watermark",
+              (snapshot(log_1) + "| " + snapshot(log_2)).c_str());
+        exec.removeNode(&node);
+    }
+
+    // spin() on a pool: every domain stays ordered and serialized.
+    {
+        reset(log_1);
+        reset(log_2);
+        comm::ParallelTimeOrderedExecutor exec(4, 200ms);
+        exec.addNode(&node);
+        std::thread t([&] { exec.spin(); });
+
+        // Register every source first so none starts the stream unknown.
+        constexpr int kPerTopic = 1000;
+        publish(pub_a, 'A', 1);
+        publish(pub_b, 'B', 2);
+        publish(pub_c, 'C', 1);
+        publish(pub_d, 'D', 2);
+        auto primed = [&]
+        {
+            std::lock_guard l1(log_1.mutex);
+            std::lock_guard l2(log_2.mutex);
+            return log_1.count == 2 && log_2.count == 2;
+        };
+        auto deadline = std::chrono::steady_clock::now() + 5s;
+        while (!primed() && std::chrono::steady_clock::now() < deadline)
+            std::this_thread::sleep_for(1ms);
+
+        for (int i = 0; i < kPerTopic; ++i)
+        {
+            const uint64_t ts = 1000 + 10ull * i;
+            publish(pub_a, 'A', ts);
+            publish(pub_c, 'C', ts + 1);
+            publish(pub_b, 'B', ts + 5);
+            publish(pub_d, 'D', ts + 6);
+        }
+
+        auto done = [&]
+        {
+            std::lock_guard l1(log_1.mutex);
+            std::lock_guard l2(log_2.mutex);
+            return log_1.count == 2 * kPerTopic + 2 && log_2.count == 2 * kPerTopic + 2;
+        };
+        deadline = std::chrono::steady_clock::now() + 5s;
+        while (!done() && std::chrono::steady_clock::now() < deadline)
+            std::this_thread::sleep_for(5ms);
+        exec.stop(); t.join();
+
+        check(done(), "All messages delivered on the pool",
+              (std::to_string(log_1.count) + " + " + std::to_string(log_2.count)).c_str());
+        check(log_1.monotonic && log_2.monotonic, "Each group ran in timestamp order");
+        check(!log_1.overlapped && !log_2.overlapped, "Callbacks of one domain never overlap");
+        exec.removeNode(&node);
+    }
+
+    node.stop();
+}
+
+// ═══════════════════════════════════════════════════════════════
+// Test 15: SeqOrderedExecutor gap handling — sequence numbers that never
+//          arrive must not hold back the messages behind them.
+// ═══════════════════════════════════════════════════════════════
+// Stands in for a subscriber fed by other processes: hands out entries
+// that carry an OrderKey instead of an executor seq.
+class RemoteFeedSub : public comm::SubscriberBase
+{
+public:
+    RemoteFeedSub(comm::Node& node, std::vector<int>& out)
+        : SubscriberBase(nullptr, &node, node.defaultCallbackGroup()), out_(out) {}
+
+    void feed(comm::OrderKey key, int value)
+    {
+        queue_.push_back({key, value});
+        notifyReady();
+    }
+
+    void takeAll() override
+    {
+        for (; head_ < queue_.size(); ++head_)
+            out_.push_back(queue_[head_].second);
+        clearReady();
+    }
+    void drainAll(std::vector<comm::TimeExecEntry>&) override {}
+    void drainAllExec(std::vector<comm::ExecEntry>& out) override { drainExecSome(out, SIZE_MAX); }
+    size_t drainExecSome(std::vector<comm::ExecEntry>& out, size_t max_count) override
+    {
+        size_t n = 0;
+        for (; n < max_count && head_ < queue_.size(); ++n, ++head_)
+        {
+            auto& e = out.emplace_back();
+            int value = queue_[head_].second;
+            e.emplace<int, &RemoteFeedSub::invoke>(queue_[head_].first.stamp, this, std::move(value));
+            e.origin = queue_[head_].first.origin;
+        }
+        clearReady();
+        return n;
+    }
+
+private:
+    static void invoke(void* obj, int& value) { static_cast<RemoteFeedSub*>(obj)->out_.push_back(value); }
+
+    std::vector<int>& out_;
+    std::vector<std::pair<comm::OrderKey, int>> queue_;
+    size_t head_{0};
+};
+
+static void testSeqOrderedGaps()
+{
+    std::cout << "\n=== Test 15: SeqOrdered Gap Handling ===\n";
+    using namespace std::chrono_literals;
+
+    comm::Domain domain(117);
+    comm::Node node("seqgap", domain, intraOpts());
+
+    std::vector<int> order;
+    std::atomic<int> delivered{0};
+    auto record = [&](const int& v)
+    {
+        order.push_back(v);
+        delivered.fetch_add(1, std::memory_order_release);
+    };
+    auto in_order = [&]
+    {
+        return std::is_sorted(order.begin(), order.end());
+    };
+
+    // Content filter: rejected messages are reported as consumed.
+    {
+        comm::SeqOrderedOptions opts;
+        opts.gap_timeout = 0ns; // only explicit notifications may unblock
+        comm::SeqOrderedExecutor exec(opts);
+
+        auto sub_even = node.createSubscriber<int>("/gap_filter", record, nullptr, {},
+            [](const int& v) { return v % 2 == 0; });
+        auto sub_all = node.createSubscriber<int>("/gap_plain", record);
+        auto pub_f = node.createPublisher<int>("/gap_filter");
+        auto pub_p = node.createPublisher<int>("/gap_plain");
+        exec.addNode(&node);
+
+        order.clear();
+        for (int i = 0; i < 20; i += 2)
+        {
+            pub_f->publish(i * 10 + 1);      // odd: filtered out
+            pub_p->publish(i * 10 + 5);
+            pub_f->publish((i + 1) * 10 + 0);
+        }
+        exec.spinSome();
+
+        check(order.size() == 20 && in_order(), "Filtered seqs do not block later messages",
+              ("delivered=" + std::to_string(order.size())).c_str());
+        check(exec.pending_size() == 0, "Nothing left pending");
+        check(exec.stats().consumed == 10, "Consumed markers counted",
+              ("consumed=" + std::to_string(exec.stats().consumed)).c_str());
+        exec.removeNode(&node);
+    }
+
+    // KeepLast overflow drops are reported as consumed.
+    {
+        comm::SeqOrderedOptions opts;
+        opts.gap_timeout = 0ns;
+        comm::SeqOrderedExecutor exec(opts);
+
+        comm::SubscribeOptions keep2;
+        keep2.qos.history = comm::History::KeepLast;
+        keep2.qos.depth   = 2;
+        auto sub_last = node.createSubscriber<int>("/gap_keeplast", record, nullptr, keep2);
+        auto sub_all  = node.createSubscriber<int>("/gap_plain2", record);
+        auto pub_l = node.createPublisher<int>("/gap_keeplast");
+        auto pub_p = node.createPublisher<int>("/gap_plain2");
+        exec.addNode(&node);
+
+        order.clear();
+        for (int i = 0; i < 10; ++i)
+            pub_l->publish(i);
+        pub_p->publish(100);
+        exec.spinSome();
+
+        check(order == std::vector<int>({8, 9, 100}), "KeepLast drops do not block later messages",
+              ("delivered=" + std::to_string(order.size())).c_str());
+        exec.removeNode(&node);
+    }
+
+    // An unreported hole blocks the head for at most gap_timeout.
+    {
+        comm::SeqOrderedOptions opts;
+        opts.gap_timeout = 30ms;
+        comm::SeqOrderedExecutor exec(opts);
+        auto sub = node.createSubscriber<int>("/gap_timeout", record);
+        auto pub = node.createPublisher<int>("/gap_timeout");
+        exec.addNode(&node);
+
+        order.clear();
+        (void)exec.allocateSeq(); // a seq nobody will ever deliver
+        for (int i = 0; i < 3; ++i)
+            pub->publish(i);
+        exec.spinSome();
+        check(order.empty() && exec.pending_size() == 3, "Missing head holds entries back");
+
+        std::this_thread::sleep_for(50ms);
+        exec.spinSome();
+        check(order == std::vector<int>({0, 1, 2}), "Head skipped after gap_timeout");
+        check(exec.stats().gaps_skipped == 1, "Skipped seq counted");
+
+        // spin() must wake up on its own.
+        order.clear();
+        delivered = 0;
+        (void)exec.allocateSeq();
+        std::thread t([&] { exec.spin(); });
+        for (int i = 10; i < 13; ++i)
+            pub->publish(i);
+        auto deadline = std::chrono::steady_clock::now() + 2s;
+        while (delivered.load(std::memory_order_acquire) < 3 &&
+               std::chrono::steady_clock::now() < deadline)
+            std::this_thread::sleep_for(5ms);
+        exec.stop(); t.join();
+        check(order == std::vector<int>({10, 11, 12}), "spin() skips a timed-out gap");
+        exec.removeNode(&node);
+    }
+
+    // A small ring bounds the stall even with the timeout disabled.
+    {
+        comm::SeqOrderedOptions opts;
+        opts.ring_capacity = 8;
+        opts.gap_timeout   = 0ns;
+        comm::SeqOrderedExecutor exec(opts);
+        auto sub = node.createSubscriber<int>("/gap_ring", record);
+        auto pub = node.createPublisher<int>("/gap_ring");
+        exec.addNode(&node);
+
+        order.clear();
+        (void)exec.allocateSeq();
+        for (int i = 0; i < 20; ++i)
+            pub->publish(i);
+        exec.spinSome();
+        check(order.size() == 20 && in_order(), "Ring overflow forces the head past its gap",
+              ("delivered=" + std::to_string(order.size())).c_str());
+        check(exec.stats().gaps_skipped == 1, "Exactly the missing seq skipped");
+        exec.removeNode(&node);
+    }
+
+    // Messages from other processes merge by (stamp, publisher, process),
+    // not in arrival order.
+    {
+        comm::SeqOrderedOptions opts;
+        opts.remote_idle_timeout = 50ms;
+        comm::SeqOrderedExecutor exec(opts);
+        std::vector<int> remote;
+        RemoteFeedSub feed(node, remote);
+        exec.addNode(&node);
+
+        using Key = comm::OrderKey;
+        const uint64_t a = Key::makeOrigin(1, comm::processTag("host", 100));
+        const uint64_t b = Key::makeOrigin(1, comm::processTag("host", 200));
+        const int tie_first = a < b ? 31 : 32;
+        // Process A's ring is read before process B's.
+        feed.feed({10, a}, 10);
+        feed.feed({30, a}, 31);
+        feed.feed({50, a}, 50);
+        feed.feed({20, b}, 20);
+        feed.feed({30, b}, 32);
+        feed.feed({40, b}, 40);
+        exec.spinSome();
+        check(remote == std::vector<int>({10, 20, tie_first, 63 - tie_first, 40}),
+              "Remote entries run in OrderKey order");
+        check(exec.remote_pending_size() == 1, "Silent sender holds back newer stamps");
+
+        std::this_thread::sleep_for(60ms);
+        exec.spinSome();
+        check(remote.size() == 6 && remote.back() == 50, "Idle sender stops holding the merge");
+
+        feed.feed({35, b}, 35);
+        exec.spinSome();
+        check(remote.back() == 35 && exec.remote_late_count() == 1,
+              "Entry older than one already run is delivered late");
+        exec.removeNode(&node);
+    }
+
+    node.stop();
+}
+
+// ═══════════════════════════════════════════════════════════════
+// Test 16: Batch callbacks — everything one take drains arrives as one
+//          span, split by max_batch_size, held for max_batch_wait
+// ═══════════════════════════════════════════════════════════════
+static void testBatchCallback()
+{
+    std::cout << "\n=== Test 16: Batch Callback ===\n";
+    using namespace std::chrono_literals;
+
+    comm::Domain domain(118);
+    comm::Node node("batch", domain, intraOpts());
+
+    // Everything drained by one take arrives as one span, in order.
+    {
+        comm::SingleThreadedExecutor exec;
+        std::vector<size_t> sizes;
+        std::vector<int> values;
+        auto sub = node.createSubscriber<int>("/batch_all",
+            [&](std::span<const int> batch)
+            {
+                sizes.push_back(batch.size());
+                values.insert(values.end(), batch.begin(), batch.end());
+            });
+        auto pub = node.createPublisher<int>("/batch_all");
+        exec.addNode(&node);
+
+        for (int i = 0; i < 100; ++i)
+            pub->publish(i);
+        exec.spinSome();
+
+        std::vector<int> expected(100);
+        for (int i = 0; i < 100; ++i)
+            expected[i] = i;
+        check(sub->isBatch(), "Span callback selects batch delivery");
+        check(sizes == std::vector<size_t>({100}), "One take delivers one batch",
+              ("batches=" + std::to_string(sizes.size())).c_str());
+        check(values == expected, "Batch keeps publish order");
+        exec.removeNode(&node);
+    }
+
+    // max_batch_size splits the drain; shared_ptr messages work the same.
+    {
+        comm::SingleThreadedExecutor exec;
+        std::vector<size_t> sizes;
+        size_t total = 0;
+        comm::SubscribeOptions opts;
+        opts.max_batch_size = 16;
+        auto sub = node.createSubscriber<std::string>("/batch_split",
+            [&](std::span<const std::shared_ptr<std::string>> batch)
+            {
+                sizes.push_back(batch.size());
+                for (auto& m : batch)
+                    total += m->size();
+            }, nullptr, opts);
+        auto pub = node.createPublisher<std::string>("/batch_split");
+        exec.addNode(&node);
+
+        for (int i = 0; i < 40; ++i)
+            pub->publish(std::string("x"));
+        exec.spinSome();
+
+        check(sizes == std::vector<size_t>({16, 16, 8}), "max_batch_size splits the drain",
+              ("batches=" + std::to_string(sizes.size())).c_str());
+        check(total == 40, "Every message delivered once");
+        exec.removeNode(&node);
+    }
+
+    // A partial batch waits up to max_batch_wait, then flushes on its own.
+    {
+        comm::SingleThreadedExecutor exec;
+        std::vector<size_t> sizes;
+        std::atomic<int> delivered{0};
+        comm::SubscribeOptions opts;
+        opts.max_batch_size = 8;
+        opts.max_batch_wait = 30ms;
+        auto sub = node.createSubscriber<int>("/batch_wait",
+            [&](std::span<const int> batch)
+            {
+                sizes.push_back(batch.size());
+                delivered.fetch_add(static_cast<int>(batch.size()), std::memory_order_release);
+            }, nullptr, opts);
+        auto pub = node.createPublisher<int>("/batch_wait");
+        exec.addNode(&node);
+
+        for (int i = 0; i < 3; ++i)
+            pub->publish(i);
+        exec.spinSome();
+        check(sizes.empty(), "Partial batch held back");
+
+        for (int i = 3; i < 8; ++i)
+            pub->publish(i);
+        exec.spinSome();
+        check(sizes == std::vector<size_t>({8}), "Batch delivered once full");
+
+        sizes.clear();
+        delivered = 0;
+        std::thread t([&] { exec.spin(); });
+        pub->publish(100);
+        pub->publish(101);
+        auto deadline = std::chrono::steady_clock::now() + 2s;
+        while (delivered.load(std::memory_order_acquire) < 2 &&
+               std::chrono::steady_clock::now() < deadline)
+            std::this_thread::sleep_for(5ms);
+        exec.stop(); t.join();
+        check(sizes == std::vector<size_t>({2}), "Partial batch flushed after max_batch_wait");
+        exec.removeNode(&node);
+    }
+
+    // Ordered executors release entries one at a time.
+    {
+        comm::SeqOrderedExecutor exec;
+        std::vector<int> values;
+        auto sub = node.createSubscriber<int>("/batch_seq",
+            [&](std::span<const int> batch)
+            {
+                values.insert(values.end(), batch.begin(), batch.end());
+            });
+        auto pub = node.createPublisher<int>("/batch_seq");
+        exec.addNode(&node);
+
+        for (int i = 0; i < 5; ++i)
+            pub->publish(i);
+        exec.spinSome();
+        check(values == std::vector<int>({0, 1, 2, 3, 4}), "SeqOrdered delivers to batch callbacks");
+        exec.removeNode(&node);
+    }
+
+    node.stop();
+}
+
+// ═══════════════════════════════════════════════════════════════
+// Test 17: Thread options — executor and IO threads take their CPU set,
+//          name and scheduling policy; failures are counted, not fatal
+// ═══════════════════════════════════════════════════════════════
+#ifdef __linux__
+static std::string currentThreadName()
+{
+    char buf[16]{};
+    pthread_getname_np(pthread_self(), buf, sizeof(buf));
+    return buf;
+}
+
+static std::vector<int> currentThreadCpus()
+{
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    std::vector<int> cpus;
+    if (pthread_getaffinity_np(pthread_self(), sizeof(set), &set) == 0)
+    {
+        for (int c = 0; c < CPU_SETSIZE; ++c)
+            if (CPU_ISSET(c, &set)) cpus.push_back(c);
+    }
+    return cpus;
+}
+#endif
+
+static void testThreadOptions()
+{
+    std::cout << "\n=== Test 17: Thread Options ===\n";
+#ifdef __linux__
+    using namespace std::chrono_literals;
+
+    comm::Domain domain(119);
+    comm::Node node("thread_opts", domain, intraOpts());
+    comm::CallbackGroupBase group(&node, comm::CallbackGroupType::Reentrant);
+
+    auto wait_for = [](std::atomic<int>& n, int target)
+    {
+        auto deadline = std::chrono::steady_clock::now() + 2s;
+        while (n.load(std::memory_order_acquire) < target &&
+               std::chrono::steady_clock::now() < deadline)
+            std::this_thread::sleep_for(2ms);
+    };
+
+    // SingleThreaded: spin() applies the options to its thread.
+    {
+        comm::SingleThreadedExecutor exec;
+        comm::ThreadOptions opts;
+        opts.cpus = {0};
+        opts.name = "lux-control";
+        exec.setThreadOptions(opts);
+
+        std::string name;
+        std::vector<int> cpus;
+        std::atomic<int> n{0};
+        auto sub = node.createSubscriber<int>("/thread_st", [&](const int&)
+        {
+            name = currentThreadName();
+            cpus = currentThreadCpus();
+            n.fetch_add(1, std::memory_order_release);
+        });
+        auto pub = node.createPublisher<int>("/thread_st");
+        exec.addNode(&node);
+
+        std::thread t([&] { exec.spin(); });
+        pub->publish(1);
+        wait_for(n, 1);
+        exec.stop(); t.join();
+
+        check(name == "lux-control", "Executor thread named", name.c_str());
+        check(cpus == std::vector<int>({0}), "Executor thread pinned to its CPU set");
+        check(exec.threadOptionErrors() == 0, "No errors reported");
+        exec.removeNode(&node);
+    }
+
+    // MultiThreaded: every worker gets the name with its index.
+    {
+        comm::MultiThreadedExecutor exec(2);
+        comm::ThreadOptions opts;
+        opts.cpus = {0};
+        opts.pin_per_worker = true;
+        opts.name = "lux-pool";
+        exec.setThreadOptions(opts);
+
+        std::mutex mtx;
+        std::set<std::string> names;
+        std::atomic<int> n{0};
+        auto sub = node.createSubscriber<int>("/thread_mt", [&](const int&)
+        {
+            {
+                std::lock_guard lock(mtx);
+                names.insert(currentThreadName());
+            }
+            n.fetch_add(1, std::memory_order_release);
+        }, &group);
+        auto pub = node.createPublisher<int>("/thread_mt");
+        exec.addNode(&node);
+
+        std::thread t([&] { exec.spin(); });
+        for (int i = 0; i < 200; ++i)
+            pub->publish(i);
+        wait_for(n, 200);
+        exec.stop(); t.join();
+
+        bool all_named = !names.empty();
+        for (auto& s : names)
+            all_named = all_named && (s == "lux-pool-0" || s == "lux-pool-1");
+        check(all_named, "Pool workers named with their index");
+        check(exec.threadOptionErrors() == 0, "No errors reported");
+        exec.removeNode(&node);
+    }
+
+    // An unusable policy is reported, the executor keeps running.
+    {
+        comm::SingleThreadedExecutor exec;
+        comm::ThreadOptions opts;
+        opts.sched_policy   = comm::SchedPolicy::Fifo;
+        opts.sched_priority = 1000; // out of range on every kernel
+        exec.setThreadOptions(opts);
+
+        std::atomic<int> n{0};
+        auto sub = node.createSubscriber<int>("/thread_bad", [&](const int&)
+        {
+            n.fetch_add(1, std::memory_order_release);
+        });
+        auto pub = node.createPublisher<int>("/thread_bad");
+        exec.addNode(&node);
+
+        std::thread t([&] { exec.spin(); });
+        pub->publish(1);
+        wait_for(n, 1);
+        exec.stop(); t.join();
+
+        check(n.load() == 1, "Callbacks still run after a scheduling error");
+        check(exec.threadOptionErrors() == 1, "Scheduling error counted");
+        exec.removeNode(&node);
+    }
+
+    node.stop();
+
+    // IoThread: NodeOptions::io_thread.
+    {
+        auto nopts = intraOpts();
+        nopts.io_thread.name = "lux-io";
+        nopts.io_thread.sched_policy   = comm::SchedPolicy::RoundRobin;
+        nopts.io_thread.sched_priority = 1000;
+        comm::Node io_node("thread_io", domain, nopts);
+
+        std::mutex mtx;
+        std::string name;
+        std::atomic<int> n{0};
+        auto handle = io_node.ioThread().registerPoller([&]
+        {
+            std::lock_guard lock(mtx);
+            name = currentThreadName();
+            n.fetch_add(1, std::memory_order_release);
+        });
+        wait_for(n, 1);
+        io_node.ioThread().unregisterPoller(handle);
+
+        std::lock_guard lock(mtx);
+        check(name == "lux-io", "IO thread named", name.c_str());
+        check(io_node.ioThread().threadOptionsFailed(), "IO thread scheduling error reported");
+        io_node.stop();
+    }
+#else
+    std::cout << "  (skipped: Linux only)\n";
+#endif
+}
+
+// ═══════════════════════════════════════════════════════════════
+// Test 18: Timers — fire at their period from the executor's timing
+//          wheel, block between ticks, coalesce missed ticks and obey
+//          their callback group
+// ═══════════════════════════════════════════════════════════════
+static void testTimers()
+{
+    std::cout << "\n=== Test 18: Timers ===\n";
+    using namespace std::chrono_literals;
+
+    comm::Domain domain(120);
+    comm::Node node("timers", domain, intraOpts());
+    comm::CallbackGroupBase group(&node, comm::CallbackGroupType::MutuallyExclusive);
+
+    // Periodic firing from spin(); the executor sleeps until each deadline.
+    {
+        comm::SingleThreadedExecutor exec;
+        std::atomic<int> ticks{0};
+        uint64_t max_late_ns = 0;
+        std::shared_ptr<comm::Timer> timer;
+        timer = node.createTimer(10ms, [&]
+        {
+            const uint64_t late = static_cast<uint64_t>(
+                std::chrono::steady_clock::now().time_since_epoch().count()) - timer->scheduledNs();
+            max_late_ns = std::max(max_late_ns, late);
+            ticks.fetch_add(1, std::memory_order_relaxed);
+        });
+        exec.addNode(&node);
+
+        const std::clock_t cpu0 = std::clock();
+        std::thread th([&] { exec.spin(); });
+        std::this_thread::sleep_for(300ms);
+        exec.stop(); th.join();
+        const double cpu_ms = 1000.0 * (std::clock() - cpu0) / CLOCKS_PER_SEC;
+
+        const int n = ticks.load();
+        check(n >= 20 && n <= 31, "Timer fires at its period",
+              ("ticks=" + std::to_string(n) + " in 300 ms").c_str());
+        check(max_late_ns < 20'000'000, "Callback runs close to its deadline",
+              ("max late=" + std::to_string(max_late_ns / 1000) + " us").c_str());
+        check(cpu_ms < 150.0, "Executor blocks between ticks",
+              ("cpu=" + std::to_string(cpu_ms) + " ms").c_str());
+
+        // cancel() stops it, reset() restarts the period.
+        timer->cancel();
+        const int at_cancel = ticks.load();
+        for (auto end = std::chrono::steady_clock::now() + 40ms; std::chrono::steady_clock::now() < end;)
+        {
+            exec.spinSome();
+            std::this_thread::sleep_for(1ms);
+        }
+        check(ticks.load() == at_cancel && timer->isCanceled(), "Canceled timer does not fire");
+
+        timer->reset();
+        for (auto end = std::chrono::steady_clock::now() + 1s;
+             ticks.load() == at_cancel && std::chrono::steady_clock::now() < end;)
+        {
+            exec.spinSome();
+            std::this_thread::sleep_for(1ms);
+        }
+        check(ticks.load() > at_cancel, "Reset timer fires again");
+        timer->cancel();
+        exec.removeNode(&node);
+    }
+
+    // Ticks missed while nobody spins run once and count as overruns.
+    {
+        comm::SingleThreadedExecutor exec;
+        exec.addNode(&node);
+        int ticks = 0;
+        auto timer = node.createTimer(5ms, [&] { ++ticks; }, &group);
+        check(exec.timerCount() == 1, "Timer created on an attached node is armed");
+
+        std::this_thread::sleep_for(52ms);
+        exec.spinSome();
+        check(ticks == 1, "Missed ticks coalesce into one callback",
+              ("ticks=" + std::to_string(ticks)).c_str());
+        check(timer->overruns() >= 5, "Missed ticks counted as overruns",
+              ("overruns=" + std::to_string(timer->overruns())).c_str());
+
+        timer->cancel();
+        check(exec.timerCount() == 0, "Canceled timer leaves the wheel");
+        exec.removeNode(&node);
+    }
+
+    // A MutuallyExclusive group never runs the timer next to its subscriber.
+    {
+        std::atomic<int> in_group{0};
+        std::atomic<bool> overlap{false};
+        std::atomic<int> ticks{0};
+        std::atomic<int> received{0};
+        auto enter = [&]
+        {
+            if (in_group.fetch_add(1, std::memory_order_seq_cst) != 0)
+                overlap.store(true, std::memory_order_relaxed);
+            std::this_thread::sleep_for(50us);
+            in_group.fetch_sub(1, std::memory_order_seq_cst);
+        };
+
+        auto timer = node.createTimer(1ms, [&] { enter(); ticks.fetch_add(1); }, &group);
+        auto sub = node.createSubscriber<int>("/timer_group",
+            [&](const int&) { enter(); received.fetch_add(1); }, &group);
+        auto pub = node.createPublisher<int>("/timer_group");
+
+        comm::MultiThreadedExecutor exec(4);
+        exec.addNode(&node);
+        std::thread th([&] { exec.spin(); });
+        for (int i = 0; i < 500; ++i)
+        {
+            pub->publish(i);
+            if (i % 10 == 0)
+                std::this_thread::sleep_for(1ms);
+        }
+        auto deadline = std::chrono::steady_clock::now() + 5s;
+        while ((received.load() < 500 || ticks.load() < 10) &&
+               std::chrono::steady_clock::now() < deadline)
+            std::this_thread::sleep_for(1ms);
+        exec.stop(); th.join();
+
+        check(received.load() == 500 && ticks.load() >= 10, "Timer and subscriber both ran",
+              ("msgs=" + std::to_string(received.load()) + " ticks=" + std::to_string(ticks.load())).c_str());
+        check(!overlap.load(), "Timer never overlapped its MutExcl group");
+        timer->cancel();
+        exec.removeNode(&node);
+    }
+
+    // Every executor drives timers from spin().
+    {
+        std::atomic<int> ticks{0};
+        auto timer = node.createTimer(2ms, [&] { ticks.fetch_add(1); }, &group);
+        timer->cancel();
+
+        auto run = [&](comm::ExecutorBase& exec, const char* name)
+        {
+            ticks = 0;
+            exec.addNode(&node);
+            timer->reset();
+            std::thread th([&] { exec.spin(); });
+            auto deadline = std::chrono::steady_clock::now() + 2s;
+            while (ticks.load() < 5 && std::chrono::steady_clock::now() < deadline)
+                std::this_thread::sleep_for(1ms);
+            exec.stop(); th.join();
+            timer->cancel();
+            exec.removeNode(&node);
+            check(ticks.load() >= 5, name, ("ticks=" + std::to_string(ticks.load())).c_str());
+        };
+
+        comm::MultiThreadedExecutor mt(2);
+        comm::SeqOrderedExecutor seq;
+        comm::TimeOrderedExecutor time;
+        comm::ParallelTimeOrderedExecutor ptime(2);
+        run(mt, "MultiThreaded runs timers");
+        run(seq, "SeqOrdered runs timers");
+        run(time, "TimeOrdered runs timers");
+        run(ptime, "ParallelTimeOrdered runs timers");
+    }
+
+    node.stop();
+}
+
+// ═══════════════════════════════════════════════════════════════
+// Test 19: Coroutines — a task awaits "next on A, then next on B",
+//          resumes on the executor thread and dies with its executor
+// ═══════════════════════════════════════════════════════════════
+static comm::Task pairTask(comm::Subscriber<int>& a, comm::Subscriber<int>& b, int count,
+                           std::vector<std::pair<int, int>>& pairs, std::set<std::thread::id>& threads)
+{
+    for (int i = 0; i < count; ++i)
+    {
+        int x = co_await a.next();
+        threads.insert(std::this_thread::get_id());
+        int y = co_await b.next();
+        threads.insert(std::this_thread::get_id());
+        pairs.emplace_back(x, y);
+    }
+}
+
+static comm::Task yieldTask(comm::CoroutineExecutor& exec, int rounds, int& done)
+{
+    for (int i = 0; i < rounds; ++i)
+    {
+        co_await exec.schedule();
+        ++done;
+    }
+}
+
+static comm::Task waitForeverTask(comm::Subscriber<int>& sub, int& got)
+{
+    for (;;)
+        got += co_await sub.next();
+}
+
+static void testCoroutines()
+{
+    std::cout << "\n=== Test 19: Coroutines ===\n";
+    using namespace std::chrono_literals;
+    constexpr int N = 2000;
+
+    comm::Domain domain(121);
+    comm::Node node("coro", domain, intraOpts());
+
+    auto sub_a = node.createSubscriber<int>("/coro_a", nullptr);
+    auto sub_b = node.createSubscriber<int>("/coro_b", nullptr);
+    auto pub_a = node.createPublisher<int>("/coro_a");
+    auto pub_b = node.createPublisher<int>("/coro_b");
+
+    // Pairs form in order whether A or B runs ahead; the task resumes on
+    // the spinning thread only.
+    {
+        comm::CoroutineExecutor exec;
+        exec.addNode(&node);
+        std::vector<std::pair<int, int>> pairs;
+        std::set<std::thread::id> threads;
+        exec.spawn(pairTask(*sub_a, *sub_b, N, pairs, threads));
+        check(exec.taskCount() == 1, "Spawned task is owned by the executor");
+
+        std::thread::id spin_id;
+        std::thread th([&] { spin_id = std::this_thread::get_id(); exec.spin(); });
+        for (int i = 0; i < N / 2; ++i)           // B lags behind A
+            pub_a->publish(i);
+        for (int i = 0; i < N / 2; ++i)
+            pub_b->publish(1000 + i);
+        for (int i = N / 2; i < N; ++i)           // one by one
+        {
+            pub_b->publish(1000 + i);
+            pub_a->publish(i);
+            if (i % 100 == 0)
+                std::this_thread::sleep_for(1ms);
+        }
+        auto deadline = std::chrono::steady_clock::now() + 5s;
+        while (exec.taskCount() > 0 && std::chrono::steady_clock::now() < deadline)
+            std::this_thread::sleep_for(1ms);
+        exec.stop(); th.join();
+
+        bool ordered = pairs.size() == static_cast<size_t>(N);
+        for (int i = 0; ordered && i < N; ++i)
+            ordered = pairs[i] == std::make_pair(i, 1000 + i);
+        check(ordered, "Awaited messages pair up in order",
+              ("pairs=" + std::to_string(pairs.size())).c_str());
+        check(threads.size() == 1 && *threads.begin() == spin_id, "Coroutine resumed on the executor thread");
+        check(exec.taskCount() == 0, "Finished task frame released");
+        exec.removeNode(&node);
+    }
+
+    // schedule() yields back to the executor between rounds.
+    {
+        comm::CoroutineExecutor exec;
+        int done = 0;
+        exec.spawn(yieldTask(exec, 5, done));
+        exec.spinSome();
+        check(done == 1, "schedule() resumes on the next round",
+              ("done=" + std::to_string(done)).c_str());
+        for (int i = 0; i < 10 && exec.taskCount() > 0; ++i)
+            exec.spinSome();
+        check(done == 5 && exec.taskCount() == 0, "Task runs to completion over spinSome() calls");
+    }
+
+    // A task still waiting dies with its executor; the subscriber can be
+    // awaited again afterwards.
+    {
+        int got = 0;
+        {
+            comm::CoroutineExecutor exec;
+            exec.addNode(&node);
+            exec.spawn(waitForeverTask(*sub_a, got));
+            exec.spinSome();
+            pub_a->publish(5);
+            exec.spinSome();
+            check(got == 5, "Parked task resumed by spinSome()");
+            exec.removeNode(&node);
+        }
+
+        comm::CoroutineExecutor exec;
+        exec.addNode(&node);
+        exec.spawn(waitForeverTask(*sub_a, got));
+        pub_a->publish(7);
+        exec.spinSome();
+        exec.spinSome();
+        check(got == 12, "Destroyed task disarmed its awaiter",
+              ("got=" + std::to_string(got)).c_str());
+        exec.removeNode(&node);
+    }
+
+    node.stop();
+}
+
+// ═══════════════════════════════════════════════════════════════
+// Test 20: Wait policy — every policy delivers and stops, idle CPU
+//          follows the policy, the spin window adapts to the arrival
+//          rate and widens for a tight latency budget
+// ═══════════════════════════════════════════════════════════════
+static void testWaitPolicy()
+{
+    std::cout << "\n=== Test 20: Wait policy ===\n";
+    using namespace std::chrono_literals;
+
+    comm::Domain domain(122);
+    comm::Node node("wait_policy", domain, intraOpts());
+
+    // Latency budgets of attached subscribers reach the executor.
+    {
+        comm::SubscribeOptions relaxed;
+        relaxed.qos.latency_budget = std::chrono::microseconds(500);
+        auto sub_relaxed = node.createSubscriber<int>("/budget", [](const int&) {}, nullptr, relaxed);
+
+        comm::SingleThreadedExecutor exec;
+        check(exec.waitPolicy() == comm::WaitPolicy::SpinThenPark, "SpinThenPark is the default");
+        check(exec.minLatencyBudgetNs() == 0, "No budget before addNode()");
+        exec.addNode(&node);
+        check(exec.minLatencyBudgetNs() == 500'000, "addNode() reports the budget of existing subscribers",
+              ("budget=" + std::to_string(exec.minLatencyBudgetNs())).c_str());
+
+        comm::SubscribeOptions tight;
+        tight.qos.latency_budget = std::chrono::microseconds(20);
+        auto sub_tight = node.createSubscriber<int>("/budget", [](const int&) {}, nullptr, tight);
+        check(exec.minLatencyBudgetNs() == 20'000, "Subscriber created on an attached node lowers the budget",
+              ("budget=" + std::to_string(exec.minLatencyBudgetNs())).c_str());
+
+        exec.setWaitPolicy(comm::WaitPolicy::BusySpin);
+        check(exec.spinWindowNs() == UINT64_MAX, "BusySpin never parks");
+        exec.setWaitPolicy(comm::WaitPolicy::ParkOnly);
+        check(exec.spinWindowNs() == 0, "ParkOnly never spins");
+
+        exec.removeNode(&node);
+        check(exec.minLatencyBudgetNs() == 0, "removeNode() drops the budget");
+    }
+
+    // Every policy delivers everything and stops cleanly, single- and multi-threaded.
+    for (auto policy : {comm::WaitPolicy::BusySpin, comm::WaitPolicy::SpinThenPark, comm::WaitPolicy::ParkOnly})
+    {
+        const std::string name = policy == comm::WaitPolicy::BusySpin     ? "BusySpin"
+                               : policy == comm::WaitPolicy::SpinThenPark ? "SpinThenPark"
+                                                                          : "ParkOnly";
+        std::atomic<int> received{0};
+        auto sub = node.createSubscriber<int>("/policy/" + name, [&](const int&) { received.fetch_add(1); });
+        auto pub = node.createPublisher<int>("/policy/" + name);
+
+        auto run = [&](comm::ExecutorBase& exec, const std::string& label)
+        {
+            received = 0;
+            exec.setWaitPolicy(policy);
+            exec.addNode(&node);
+            std::thread th([&] { exec.spin(); });
+            for (int i = 0; i < 200; ++i)
+            {
+                pub->publish(i);
+                if (i % 20 == 0)
+                    std::this_thread::sleep_for(200us);
+            }
+            for (auto end = std::chrono::steady_clock::now() + 2s;
+                 received.load() < 200 && std::chrono::steady_clock::now() < end;)
+                std::this_thread::sleep_for(1ms);
+            exec.stop(); th.join();
+            exec.removeNode(&node);
+            check(received.load() == 200, (label + " " + name + " delivers and stops").c_str(),
+                  ("received=" + std::to_string(received.load())).c_str());
+        };
+
+        { comm::SingleThreadedExecutor exec; run(exec, "SingleThreaded"); }
+        { comm::MultiThreadedExecutor exec(2); run(exec, "MultiThreaded"); }
+    }
+
+    // Idle CPU: parking costs nothing, busy-spinning a full core.
+    {
+        auto idleCpuMs = [&](comm::WaitPolicy policy)
+        {
+            comm::SingleThreadedExecutor exec;
+            exec.setWaitPolicy(policy);
+            exec.addNode(&node);
+            const std::clock_t cpu0 = std::clock();
+            std::thread th([&] { exec.spin(); });
+            std::this_thread::sleep_for(200ms);
+            exec.stop(); th.join();
+            exec.removeNode(&node);
+            return 1000.0 * (std::clock() - cpu0) / CLOCKS_PER_SEC;
+        };
+        const double park_ms = idleCpuMs(comm::WaitPolicy::ParkOnly);
+        const double spin_ms = idleCpuMs(comm::WaitPolicy::BusySpin);
+        check(park_ms < 50.0, "ParkOnly executor idles without CPU",
+              ("cpu=" + std::to_string(park_ms) + " ms").c_str());
+        check(spin_ms > 100.0, "BusySpin executor keeps spinning while idle",
+              ("cpu=" + std::to_string(spin_ms) + " ms").c_str());
+    }
+
+    // The SpinThenPark window follows the arrival rate; a tight budget widens it.
+    {
+        int run = 0;
+        auto windowAfter = [&](std::chrono::microseconds interval, int count, bool tight)
+        {
+            // A node of its own: budgets of earlier subscribers must not count.
+            comm::Node node("adaptive", domain, intraOpts());
+            const std::string topic = "/adaptive/" + std::to_string(run++);
+            comm::SubscribeOptions opts;
+            if (tight)
+                opts.qos.latency_budget = std::chrono::microseconds(20);
+            std::atomic<int> received{0};
+            auto sub = node.createSubscriber<int>(topic, [&](const int&) { received.fetch_add(1); },
+                                                  nullptr, opts);
+            auto pub = node.createPublisher<int>(topic);
+
+            comm::SingleThreadedExecutor exec;
+            exec.addNode(&node);
+            std::thread th([&] { exec.spin(); });
+            for (auto next = std::chrono::steady_clock::now(); received.load() < count;)
+            {
+                next += interval;
+                std::this_thread::sleep_until(next);
+                pub->publish(0);
+            }
+            const uint64_t window = exec.spinWindowNs();
+            exec.stop(); th.join();
+            exec.removeNode(&node);
+            return window;
+        };
+
+        const uint64_t slow = windowAfter(5ms, 30, false);
+        check(slow < 10'000, "Sparse arrivals collapse the spin window",
+              ("window=" + std::to_string(slow) + " ns").c_str());
+        const uint64_t medium = windowAfter(300us, 200, false);
+        const uint64_t medium_tight = windowAfter(300us, 200, true);
+        check(medium < 10'000 && medium_tight >= 100'000,
+              "A tight latency budget keeps spinning across 300 us gaps",
+              ("window=" + std::to_string(medium) + " / " + std::to_string(medium_tight) + " ns").c_str());
+    }
+
+    node.stop();
+}
+
+// ═══════════════════════════════════════════════════════════════
+// Test 21: EventCount — a notify without waiters is a no-op, timed
+//          waits expire, notifyOne wakes exactly one sleeper, no
+//          wake-up is lost against a concurrent producer, and a
+//          wakeup() token ends a parked spin under every ReadyPolicy
+// ═══════════════════════════════════════════════════════════════
+static comm::Task setFlag(std::atomic<bool>* flag)
+{
+    flag->store(true);
+    co_return;
+}
+
+static void testEventCount()
+{
+    std::cout << "\n=== Test 21: EventCount ===\n";
+    using namespace std::chrono_literals;
+
+    // Nobody waiting: notify leaves the key alone, a timed wait expires.
+    {
+        comm::EventCount ec;
+        ec.notifyOne();
+        ec.notifyAll();
+        check(ec.waiters() == 0, "No waiters before prepareWait()");
+
+        auto key = ec.prepareWait();
+        check(ec.waiters() == 1, "prepareWait() counts the caller");
+        const auto t0 = std::chrono::steady_clock::now();
+        const bool notified = ec.commitWait(key, comm::platform::steadyNowNs() + 5'000'000);
+        const auto waited = std::chrono::steady_clock::now() - t0;
+        check(!notified && waited >= 5ms, "Earlier notify is not remembered; commitWait() times out",
+              ("waited=" + std::to_string(std::chrono::duration_cast<std::chrono::microseconds>(waited).count()) + " us").c_str());
+        check(ec.waiters() == 0, "commitWait() uncounts the caller");
+
+        key = ec.prepareWait();
+        ec.cancelWait();
+        check(ec.waiters() == 0, "cancelWait() uncounts the caller");
+    }
+
+    // Exact wake-ups: one notifyOne() releases one of four sleepers.
+    {
+        comm::EventCount ec;
+        std::atomic<int> woken{0};
+        std::vector<std::thread> threads;
+        for (int i = 0; i < 4; ++i)
+        {
+            threads.emplace_back([&]
+            {
+                ec.commitWait(ec.prepareWait());
+                woken.fetch_add(1);
+            });
+        }
+        while (ec.waiters() < 4)
+            std::this_thread::sleep_for(1ms);
+        std::this_thread::sleep_for(50ms); // let all four reach the futex
+
+        ec.notifyOne();
+        std::this_thread::sleep_for(50ms);
+        check(woken.load() == 1, "notifyOne() wakes exactly one sleeper",
+              ("woken=" + std::to_string(woken.load())).c_str());
+
+        ec.notifyAll();
+        for (auto& t : threads)
+            t.join();
+        check(woken.load() == 4, "notifyAll() wakes the rest");
+    }
+
+    // Producer/consumer handshake: every item is seen without timeouts.
+    {
+        comm::EventCount ec;
+        std::atomic<uint64_t> produced{0};
+        constexpr uint64_t kItems = 20'000;
+        uint64_t consumed = 0;
+
+        std::thread consumer([&]
+        {
+            while (consumed < kItems)
+            {
+                if (produced.load(std::memory_order_acquire) > consumed)
+                {
+                    ++consumed;
+                    continue;
+                }
+                auto key = ec.prepareWait();
+                if (produced.load(std::memory_order_acquire) > consumed)
+                    ec.cancelWait();
+                else
+                    ec.commitWait(key);
+            }
+        });
+        for (uint64_t i = 0; i < kItems; ++i)
+        {
+            produced.fetch_add(1, std::memory_order_release);
+            ec.notifyOne();
+            if ((i & 255) == 0)
+                std::this_thread::yield();
+        }
+        consumer.join();
+        check(consumed == kItems, "No lost wake-up across 20000 handshakes");
+    }
+
+    // A wakeup() token ends a parked spin under every ReadyPolicy.
+    for (auto policy : {comm::ReadyPolicy::Fifo, comm::ReadyPolicy::Priority,
+                        comm::ReadyPolicy::EarliestDeadline})
+    {
+        comm::CoroutineExecutor exec;
+        exec.setReadyPolicy(policy);
+        exec.setWaitPolicy(comm::WaitPolicy::ParkOnly);
+        std::thread spinner([&] { exec.spin(); });
+        std::this_thread::sleep_for(20ms);
+
+        std::atomic<bool> ran{false};
+        exec.spawn(setFlag(&ran));
+        for (int i = 0; i < 200 && !ran.load(); ++i)
+            std::this_thread::sleep_for(5ms);
+        check(ran.load(), "Task spawned onto a parked executor runs",
+              ("policy=" + std::to_string(static_cast<int>(policy))).c_str());
+
+        exec.stop();
+        spinner.join();
+    }
+}
+
+// ═══════════════════════════════════════════════════════════════
+// Test 22: Callback profiler — per-subscriber queue-wait and execution
+//          histograms, over-budget counts and the slow-callback hook,
+//          shards per worker thread, timers, forget() / reset()
+// ═══════════════════════════════════════════════════════════════
+static void testCallbackProfiler()
+{
+    std::cout << "\n=== Test 22: Callback profiler ===\n";
+    using namespace std::chrono_literals;
+
+    comm::Domain domain(123);
+    comm::Node node("profiler", domain, intraOpts());
+
+    // Histogram quantiles land in the right power-of-two bucket.
+    {
+        comm::DurationHistogram h;
+        for (int i = 0; i < 99; ++i)
+            h.record(1'000);
+        h.record(1'000'000);
+        check(h.count == 100 && h.max_ns == 1'000'000, "Histogram counts samples and max");
+        check(h.quantileNs(0.5) >= 1'000 && h.quantileNs(0.5) < 2'048, "p50 in the 1 us bucket",
+              ("p50=" + std::to_string(h.quantileNs(0.5)) + " ns").c_str());
+        check(h.quantileNs(1.0) == 1'000'000, "p100 is the max");
+    }
+
+    // One slow and one fast subscriber on a SingleThreadedExecutor.
+    {
+        std::atomic<int> fast_n{0}, slow_n{0};
+        auto fast = node.createSubscriber<int>("/profile/fast", [&](const int&) { ++fast_n; });
+        auto slow = node.createSubscriber<int>("/profile/slow", [&](const int& v)
+        {
+            if (v % 5 == 0)
+                std::this_thread::sleep_for(5ms);
+            ++slow_n;
+        });
+        auto pub_fast = node.createPublisher<int>("/profile/fast");
+        auto pub_slow = node.createPublisher<int>("/profile/slow");
+
+        comm::SingleThreadedExecutor exec;
+        check(exec.profiler() == nullptr && !exec.needsTimestamps(), "Profiling is off by default");
+        exec.enableProfiling(2ms);
+        check(exec.profiler() != nullptr && exec.needsTimestamps(),
+              "enableProfiling() creates the profiler and turns on stamping");
+
+        std::vector<const comm::SubscriberBase*> slow_reports;
+        exec.profiler()->setSlowCallbackHandler([&](const comm::SubscriberBase* sub, uint64_t)
+        {
+            slow_reports.push_back(sub);
+        });
+        exec.addNode(&node);
+
+        for (int i = 0; i < 20; ++i)
+        {
+            pub_fast->publish(i);
+            pub_slow->publish(i);
+        }
+        std::this_thread::sleep_for(1ms); // every message waits at least 1 ms
+        exec.spinSome();
+
+        const auto fs = exec.profiler()->stats(fast.get());
+        const auto ss = exec.profiler()->stats(slow.get());
+        check(fast_n == 20 && slow_n == 20, "All callbacks ran");
+        check(fs.exec.count == 20 && ss.exec.count == 20, "One exec sample per callback",
+              ("fast=" + std::to_string(fs.exec.count) + " slow=" + std::to_string(ss.exec.count)).c_str());
+        check(fs.queue_wait.count == 20 && fs.queue_wait.max_ns >= 1'000'000,
+              "Queue wait sampled from the publish stamp",
+              ("max=" + std::to_string(fs.queue_wait.max_ns) + " ns").c_str());
+        check(ss.over_budget == 4 && fs.over_budget == 0, "Over-budget callbacks counted per subscriber",
+              ("slow=" + std::to_string(ss.over_budget) + " fast=" + std::to_string(fs.over_budget)).c_str());
+        check(ss.exec.max_ns >= 5'000'000 && fs.exec.quantileNs(0.99) < 2'000'000,
+              "Execution histogram separates slow from fast");
+        check(slow_reports.size() == 4 &&
+              std::all_of(slow_reports.begin(), slow_reports.end(),
+                          [&](auto* s) { return s == slow.get(); }),
+              "Slow-callback handler named the slow subscriber",
+              ("reports=" + std::to_string(slow_reports.size())).c_str());
+        check(exec.profiler()->snapshot().size() == 2, "snapshot() lists both subscribers");
+
+        exec.profiler()->reset();
+        check(exec.profiler()->stats(slow.get()).exec.count == 0, "reset() clears the data");
+        exec.removeNode(&node);
+    }
+
+    // Worker threads record into their own shards; the merge sees all.
+    {
+        std::atomic<int> got{0};
+        comm::Node mt_node("profiler_mt", domain, intraOpts());
+        comm::CallbackGroupBase group(&mt_node, comm::CallbackGroupType::Reentrant);
+        std::vector<std::shared_ptr<comm::Subscriber<int>>> subs;
+        for (int i = 0; i < 4; ++i)
+        {
+            subs.push_back(mt_node.createSubscriber<int>("/profile/mt" + std::to_string(i),
+                [&](const int&) { std::this_thread::sleep_for(50us); ++got; }, &group));
+        }
+        auto pub0 = mt_node.createPublisher<int>("/profile/mt0");
+        auto pub1 = mt_node.createPublisher<int>("/profile/mt1");
+        auto pub2 = mt_node.createPublisher<int>("/profile/mt2");
+        auto pub3 = mt_node.createPublisher<int>("/profile/mt3");
+
+        comm::MultiThreadedExecutor exec(2);
+        exec.enableProfiling();
+        exec.addNode(&mt_node);
+        std::thread spinner([&] { exec.spin(); });
+        for (int i = 0; i < 200; ++i)
+        {
+            pub0->publish(i); pub1->publish(i); pub2->publish(i); pub3->publish(i);
+            if (i % 20 == 0)
+                std::this_thread::sleep_for(1ms);
+        }
+        for (int i = 0; i < 500 && got < 800; ++i)
+            std::this_thread::sleep_for(5ms);
+        exec.stop();
+        spinner.join();
+
+        uint64_t total = 0;
+        for (const auto& s : exec.profiler()->snapshot())
+            total += s.exec.count;
+        check(got == 800 && total == 800, "Merged samples match callbacks across workers",
+              ("got=" + std::to_string(got.load()) + " samples=" + std::to_string(total)).c_str());
+        check(exec.profiler()->threadCount() >= 1 && exec.profiler()->threadCount() <= 2,
+              "One shard per worker that ran callbacks",
+              ("shards=" + std::to_string(exec.profiler()->threadCount())).c_str());
+        exec.removeNode(&mt_node);
+    }
+
+    // Timers: queue wait is the lateness behind the due time.
+    {
+        comm::Node timer_node("profiler_timer", domain, intraOpts());
+        std::atomic<int> ticks{0};
+        auto timer = timer_node.createTimer(2ms, [&] { ++ticks; });
+
+        comm::SingleThreadedExecutor exec;
+        exec.enableProfiling();
+        exec.addNode(&timer_node);
+        std::thread spinner([&] { exec.spin(); });
+        for (int i = 0; i < 200 && ticks < 5; ++i)
+            std::this_thread::sleep_for(5ms);
+        exec.stop();
+        spinner.join();
+
+        const auto ts = exec.profiler()->stats(timer.get());
+        check(ts.exec.count >= 5 && ts.queue_wait.count == ts.exec.count,
+              "Timer callbacks profiled with their lateness",
+              ("ticks=" + std::to_string(ts.exec.count)).c_str());
+        timer->cancel();
+        exec.removeNode(&timer_node);
+    }
+
+    // forget() drops one subscriber's entries.
+    {
+        comm::CallbackProfiler prof(1'000);
+        auto* a = reinterpret_cast<const comm::SubscriberBase*>(0x1000);
+        auto* b = reinterpret_cast<const comm::SubscriberBase*>(0x2000);
+        prof.record(a, 0, 10, 20);
+        prof.record(b, 5, 10, 5'000);
+        check(prof.stats(a).queue_wait.count == 0, "Unknown enqueue time skips the wait sample");
+        check(prof.stats(b).over_budget == 1, "Standalone profiler applies its budget");
+        prof.forget(a);
+        const auto snap = prof.snapshot();
+        check(snap.size() == 1 && snap[0].subscriber == b, "forget() drops only that subscriber");
+    }
+
+    node.stop();
+}
+
 int main()
 {
     std::cout << "═══════════════════════════════════════════════════════════\n"
@@ -687,6 +2446,18 @@ int main()
     testAllExecutorCorrectness();
     testCrossExecutorSeqTime();
     testStopFromCallback();
+    testIndependentGroupsConcurrent();
+    testReadyPolicy();
+    testTimeOrderedWatermarks();
+    testParallelTimeOrdered();
+    testSeqOrderedGaps();
+    testBatchCallback();
+    testThreadOptions();
+    testTimers();
+    testCoroutines();
+    testWaitPolicy();
+    testEventCount();
+    testCallbackProfiler();
 
     std::cout << "\n═══════════════════════════════════════════════════════════\n"
               << "  Results: " << g_pass << " passed, " << g_fail << " failed\n"
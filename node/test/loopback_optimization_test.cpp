@@ -15,6 +15,9 @@
 ///  12. ShmDataPool split on alloc
 ///  13. HugePages TryHuge fallback
 ///  14. PoolDescriptor round-trip through ring
+///  15. LoanedMessage keeps its writer's owner alive until commit
+///  16. Ring writes while a loan is outstanding queue behind it
+///  17. Publisher::publish() while a loan is outstanding (Linux, two processes)
 
 #include <lux/communication/transport/FrameHeader.hpp>
 #include <lux/communication/transport/ShmRingBuffer.hpp>
@@ -33,8 +36,20 @@
 #include <vector>
 #include <chrono>
 #include <atomic>
+#include <memory>
+#include <mutex>
 #include <string>
 
+#ifdef __linux__
+#include <lux/communication/unified/Node.hpp>
+#include <lux/communication/Domain.hpp>
+#include <lux/communication/discovery/DiscoveryService.hpp>
+
+#include <signal.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
 using namespace lux::communication;
 
 // ─── Helpers ───────────────────────────────────────────────────────────────────
@@ -507,6 +522,221 @@ void test_pool_descriptor_ring_roundtrip() {
     std::cout << "OK\n";
 }
 
+// ─── Test 15: LoanedMessage owns its writer ───────────────────────────────────
+
+void test_loaned_message_owner() {
+    std::cout << "[15] LoanedMessage keeps its writer's owner alive ... ";
+
+    // Stands in for the Publisher's SHM peer: mutex + ring writer.
+    struct Owner {
+        std::mutex mutex;
+        std::unique_ptr<transport::ShmRingWriter> writer;
+    };
+    auto owner = std::make_shared<Owner>();
+    owner->writer = std::make_unique<transport::ShmRingWriter>("test_loan_owner_ring", 4, 4096);
+    transport::ShmRingReader reader("test_loan_owner_ring");
+
+    transport::FrameHeader hdr;
+    hdr.topic_hash = 15;
+    hdr.payload_size = sizeof(TestPod);
+    transport::setLoaned(hdr);
+
+    transport::LoanedMessage<TestPod> loan(owner->writer.get(), hdr,
+                                           std::shared_ptr<std::mutex>(owner, &owner->mutex));
+    CHECK(loan.valid());
+    CHECK(owner->mutex.try_lock()); // not held between acquire and commit
+    owner->mutex.unlock();
+    loan->x = 15;
+
+    // The peer leaves the publisher's snapshot while the loan is out.
+    std::weak_ptr<Owner> alive = owner;
+    owner.reset();
+    CHECK(!alive.expired());
+
+    loan.commit(static_cast<uint32_t>(sizeof(transport::FrameHeader) + sizeof(TestPod)));
+    auto view = reader.acquireReadView(std::chrono::milliseconds{100});
+    CHECK(view.data != nullptr);
+    if (view.data) {
+        const TestPod* pod = reinterpret_cast<const TestPod*>(
+            static_cast<const char*>(view.data) + sizeof(transport::FrameHeader));
+        CHECK(pod->x == 15);
+        reader.releaseReadView();
+    }
+
+    loan = {};
+    CHECK(alive.expired());
+
+    std::cout << "OK\n";
+}
+
+// ─── Test 16: ring writes behind an outstanding loan ──────────────────────────
+
+void test_loan_interleaved_writes() {
+    std::cout << "[16] Ring writes while a loan is outstanding ... ";
+
+    transport::ShmRingWriter writer("test_loan_interleave_ring", 8, 4096);
+    transport::ShmRingReader reader("test_loan_interleave_ring");
+    constexpr uint32_t kTotal = sizeof(transport::FrameHeader) + sizeof(TestPod);
+
+    transport::FrameHeader hdr;
+    hdr.topic_hash = 16;
+    hdr.payload_size = sizeof(TestPod);
+
+    // What Publisher::publishShm() does on the same ring.
+    auto publish = [&](int32_t x) {
+        void* slot = writer.acquireSlot();
+        if (!slot) return false;
+        TestPod pod{x, 0.0f, 0.0};
+        std::memcpy(slot, &hdr, sizeof(hdr));
+        std::memcpy(static_cast<char*>(slot) + sizeof(hdr), &pod, sizeof(pod));
+        writer.commitSlot(kTotal);
+        return true;
+    };
+    // Next frame's x; -1 for an empty (cancelled) slot, -2 for nothing.
+    auto next = [&] {
+        auto view = reader.acquireReadView(std::chrono::microseconds{0});
+        if (!view.data) return -2;
+        int32_t x = -1;
+        if (view.size >= kTotal)
+            x = reinterpret_cast<const TestPod*>(
+                static_cast<const char*>(view.data) + sizeof(transport::FrameHeader))->x;
+        reader.releaseReadView();
+        return x;
+    };
+
+    // Committed loan: later writes keep their own slots and follow it.
+    {
+        transport::LoanedMessage<TestPod> loan(&writer, hdr);
+        CHECK(loan.valid());
+        loan->x = 1;
+        CHECK(publish(2));
+        CHECK(publish(3));
+        CHECK(loan->x == 1);  // not overwritten
+        CHECK(next() == -2);  // held back behind the loan
+        loan.commit(kTotal);
+    }
+    CHECK(next() == 1);
+    CHECK(next() == 2);
+    CHECK(next() == 3);
+    CHECK(next() == -2);
+
+    // Dropped loan with writes behind it: an empty slot, then the writes.
+    {
+        transport::LoanedMessage<TestPod> loan(&writer, hdr);
+        CHECK(loan.valid());
+        CHECK(publish(4));
+    }
+    CHECK(next() == -1);
+    CHECK(next() == 4);
+    CHECK(next() == -2);
+
+    std::cout << "OK\n";
+}
+
+#ifdef __linux__
+// ─── Test 17: Publisher::publish() while a loan is outstanding ────────────────
+
+// Child: a raw SHM subscriber that expects x = 1, 2, 3 in that order.
+static int runLoanSubscriber(size_t domain_id, const std::string& topic, pid_t parent)
+{
+    auto& ds = discovery::DiscoveryService::getInstance(domain_id);
+    ds.start();
+    ds.announceSubscriber(topic, typeid(TestPod).name(), typeid(TestPod).hash_code());
+
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+    std::unique_ptr<transport::ShmRingReader> reader;
+    while (!reader && std::chrono::steady_clock::now() < deadline) {
+        try {
+            reader = std::make_unique<transport::ShmRingReader>(detail::makeRingName(
+                domain_id, fnv1a_64(topic), static_cast<uint32_t>(parent),
+                static_cast<uint32_t>(getpid())));
+        } catch (...) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+    }
+    if (!reader)
+        return 3;
+
+    for (int32_t expected = 1; expected <= 3; ++expected) {
+        auto view = reader->acquireReadView(std::chrono::seconds(5));
+        if (!view.data)
+            return 2;
+        const auto* hdr = static_cast<const transport::FrameHeader*>(view.data);
+        TestPod pod{};
+        if (view.size >= sizeof(*hdr) + sizeof(pod))
+            std::memcpy(&pod, static_cast<const char*>(view.data) + sizeof(*hdr), sizeof(pod));
+        reader->releaseReadView();
+        if (pod.x != expected)
+            return 1;
+    }
+    return 0;
+}
+
+void test_publisher_publish_during_loan() {
+    std::cout << "[17] Publisher::publish() while a loan is outstanding ... ";
+
+    constexpr size_t domain_id = 617;
+    const std::string topic = "loopback/loan_interleave_" + std::to_string(getpid());
+
+    const pid_t parent = getpid();
+    int go[2]; // parent -> child: the publisher exists
+    if (pipe(go) != 0) {
+        CHECK(false);
+        return;
+    }
+
+    std::cout.flush();
+    const pid_t child = fork();
+    if (child == 0) {
+        close(go[1]);
+        char c;
+        (void)!read(go[0], &c, 1);
+        _exit(runLoanSubscriber(domain_id, topic, parent));
+    }
+    close(go[0]);
+
+    int status = -1;
+    {
+        Domain domain(domain_id);
+        Node node("loan_interleave_pub", domain, { .enable_net = false });
+        auto pub = node.createPublisher<TestPod>(topic);
+        (void)!write(go[1], "g", 1);
+        close(go[1]);
+
+        // A loan is only granted once the child's ring is connected.
+        transport::LoanedMessage<TestPod> loan;
+        const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+        while (!(loan = pub->loan()) && std::chrono::steady_clock::now() < deadline)
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        CHECK(loan.valid());
+        if (loan) {
+            loan->x = 1;
+            pub->publish(TestPod{2, 0.0f, 0.0}); // same thread, loan still out
+            CHECK(loan->x == 1);
+            pub->publish(std::move(loan));
+            pub->publish(TestPod{3, 0.0f, 0.0});
+        }
+
+        const auto wait_end = std::chrono::steady_clock::now() + std::chrono::seconds(15);
+        while (std::chrono::steady_clock::now() < wait_end &&
+               waitpid(child, &status, WNOHANG) != child)
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        node.stop();
+    }
+    if (status == -1) {
+        kill(child, SIGKILL);
+        waitpid(child, &status, 0);
+    }
+
+    const int rc = WIFEXITED(status) ? WEXITSTATUS(status) : -1;
+    CHECK(rc == 0);
+    if (rc != 0)
+        std::cerr << "  subscriber exit status " << rc << "\n";
+
+    std::cout << "OK\n";
+}
+#endif
+
 // ─── main ──────────────────────────────────────────────────────────────────────
 
 int main() {
@@ -526,6 +756,11 @@ int main() {
     test_pool_split();
     test_huge_pages_fallback();
     test_pool_descriptor_ring_roundtrip();
+    test_loaned_message_owner();
+    test_loan_interleaved_writes();
+#ifdef __linux__
+    test_publisher_publish_during_loan();
+#endif
 
     std::cout << "\n=== Results: " << tests_passed << " passed, "
               << tests_failed << " failed ===\n";
@@ -28,6 +28,16 @@
 ///  25.  IoReactor multiple fds
 ///  26.  FrameHeader kFlagReassembled
 ///  27.  NetConstants sanity checks
+///  28.  LinkQualityEstimator: loss → shrink, hysteresis, bounded growth, staleness
+///  29.  Adaptive path: loopback with artificial fragment loss via a lossy relay
+///  30.  FragmentPacer: departure slots, burst credit, congestion control
+///  31.  Paced vs. back-to-back 2 MB frame into a small receive buffer
+///  32.  FragmentAssembler: steady-state 1 MB reassembly performs no heap allocation
+///  33.  FragmentAssembler: slot table full → oldest group evicted
+///  34.  CompactFrameHeader: varint encode / decode, flags + timestamp deltas
+///  35.  UdpTransport compact headers: negotiation, rebinding, unbound drop
+///  36.  LinkReport: groups evicted by the reassembler count as lost
+///  37.  Paced UdpTransport: frames leave in send() order, move drains the queue
 
 #include <lux/communication/platform/NetSocket.hpp>
 #include <lux/communication/transport/FrameHeader.hpp>
@@ -41,6 +51,11 @@
 #include <lux/communication/transport/TcpTransportReader.hpp>
 #include <lux/communication/transport/Handshake.hpp>
 #include <lux/communication/transport/IoReactor.hpp>
+#include <lux/communication/transport/LinkReport.hpp>
+#include <lux/communication/transport/LinkQualityEstimator.hpp>
+#include <lux/communication/transport/FragmentPacer.hpp>
+#include <lux/communication/transport/CompactFrameHeader.hpp>
+#include <lux/communication/platform/PlatformDefs.hpp>
 
 #include <cassert>
 #include <cstring>
@@ -51,6 +66,10 @@
 #include <atomic>
 #include <numeric>
 #include <algorithm>
+#include <cstdlib>
+#include <new>
+
+#include "counting_allocator.hpp"
 
 using namespace lux::communication;
 
@@ -352,9 +371,9 @@ void test_fragment_split_reassemble() {
             CHECK(!result.has_value());
     }
     CHECK(result.has_value());
-    CHECK(result->data.size() == MSG_SIZE);
+    CHECK(result->size() == MSG_SIZE);
     CHECK(result->topic_hash == topic_hash);
-    CHECK(std::memcmp(result->data.data(), original.data(), MSG_SIZE) == 0);
+    CHECK(std::memcmp(result->data(), original.data(), MSG_SIZE) == 0);
 
     auto s = assembler.stats();
     CHECK(s.complete_messages == 1);
@@ -399,8 +418,8 @@ void test_fragment_out_of_order() {
         if (r) result = std::move(r);
     }
     CHECK(result.has_value());
-    CHECK(result->data.size() == MSG_SIZE);
-    CHECK(std::memcmp(result->data.data(), original.data(), MSG_SIZE) == 0);
+    CHECK(result->size() == MSG_SIZE);
+    CHECK(std::memcmp(result->data(), original.data(), MSG_SIZE) == 0);
 
     std::cout << "PASS\n";
 }
@@ -538,8 +557,8 @@ void test_fragment_large_64kb() {
         if (r) result = std::move(r);
     }
     CHECK(result.has_value());
-    CHECK(result->data.size() == MSG_SIZE);
-    CHECK(std::memcmp(result->data.data(), original.data(), MSG_SIZE) == 0);
+    CHECK(result->size() == MSG_SIZE);
+    CHECK(std::memcmp(result->data(), original.data(), MSG_SIZE) == 0);
 
     std::cout << "PASS\n";
 }
@@ -1034,6 +1053,692 @@ void test_net_constants() {
     std::cout << "PASS\n";
 }
 
+// ─── Test 28: LinkQualityEstimator ─────────────────────────────────────────────
+
+void test_link_quality_estimator() {
+    std::cout << "[28] LinkQualityEstimator hysteresis ... ";
+
+    constexpr uint64_t kMs = 1'000'000ull;
+    constexpr uint32_t kStatic = 64 * 1024;
+
+    transport::LinkQualityConfig cfg;
+    transport::LinkQualityEstimator est(cfg);
+
+    // No estimate yet → static fallback.
+    CHECK(!est.hasEstimate(0));
+    CHECK(est.udpThreshold(kStatic, 0) == kStatic);
+
+    for (int i = 0; i < 200; ++i)
+        est.onGroupSent(45); // 64 KB messages
+
+    uint64_t now = 1000 * kMs;
+    transport::LinkReport rep;
+    rep.complete_groups = 100;
+    est.onReport(rep, now);
+
+    // Loss-free → ceiling.
+    CHECK(est.hasEstimate(now));
+    CHECK(est.udpThreshold(kStatic, now) == cfg.max_udp_threshold);
+
+    // 50 % group loss → shrink immediately, well below 64 KB.
+    now += 100 * kMs;
+    rep.complete_groups = 110;
+    rep.lost_groups = 10;
+    est.onReport(rep, now);
+    const uint32_t shrunk = est.udpThreshold(kStatic, now);
+    CHECK(shrunk < kStatic);
+    CHECK(shrunk >= cfg.min_udp_threshold);
+    CHECK(est.stats().fragment_loss > 0.0);
+
+    // One clean report inside the dwell window → no change (hysteresis).
+    now += 100 * kMs;
+    rep.complete_groups = 120;
+    est.onReport(rep, now);
+    CHECK(est.udpThreshold(kStatic, now) == shrunk);
+
+    // Reordered (older) report is ignored.
+    const auto reports_before = est.stats().reports;
+    transport::LinkReport old_rep = rep;
+    old_rep.complete_groups = 50;
+    est.onReport(old_rep, now);
+    CHECK(est.stats().reports == reports_before);
+
+    // Sustained clean link → grows, at most ×2 per step, back above 64 KB.
+    uint32_t prev = shrunk;
+    bool bounded = true;
+    for (int i = 0; i < 40; ++i) {
+        now += 600 * kMs;
+        rep.complete_groups += 10;
+        est.onReport(rep, now);
+        const uint32_t cur = est.udpThreshold(kStatic, now);
+        if (cur < prev || cur > prev * 2ull)
+            bounded = false;
+        prev = cur;
+    }
+    CHECK(bounded);
+    CHECK(prev > kStatic);
+
+    // Feedback goes silent → stale → static fallback.
+    CHECK(est.udpThreshold(kStatic, now + 5000 * kMs) == kStatic);
+
+    // RTT echo: 2 ms round trip, 0.5 ms of it spent in the reader.
+    transport::LinkQualityEstimator rtt_est;
+    transport::LinkReport r2;
+    r2.echo_timestamp_ns = 10 * kMs;
+    r2.echo_delay_ns = kMs / 2;
+    rtt_est.onReport(r2, 12 * kMs);
+    CHECK(rtt_est.stats().srtt_ns == 3 * kMs / 2);
+
+    std::cout << "PASS\n";
+}
+
+// ─── Test 29: Adaptive path over a lossy loopback relay ────────────────────────
+//
+//   Writer ──UDP──▶ Relay (drops 1 in 20 fragments) ──UDP──▶ Reader
+//   Writer ◀──────── Relay ◀──────── LinkReport ──────────── Reader
+
+void test_adaptive_path_lossy_loopback() {
+    std::cout << "[29] Adaptive path: lossy loopback relay ... ";
+    platform::NetInitGuard net_guard;
+
+    transport::UdpTransportReader reader(0);
+    const uint16_t reader_port = reader.localPort();
+
+    platform::UdpSocket relay;
+    CHECK(relay.bind("127.0.0.1", 0));
+    relay.setNonBlocking(true);
+    relay.setRecvBufferSize(transport::kUdpRecvBufferSize);
+    const uint16_t relay_port = relay.localPort();
+
+    transport::LinkQualityConfig cfg;
+    cfg.min_dwell = std::chrono::milliseconds{100};
+    transport::UdpTransportWriter writer("127.0.0.1", relay_port, cfg);
+
+    uint16_t writer_port = 0;
+    uint64_t relayed = 0;
+    auto pump = [&](int drop_every) {
+        uint8_t buf[2048];
+        std::string src;
+        uint16_t sport = 0;
+        for (;;) {
+            int n = relay.recvFrom(buf, sizeof(buf), src, sport);
+            if (n <= 0)
+                break;
+            if (sport == reader_port) {
+                if (writer_port)
+                    relay.sendTo(buf, n, "127.0.0.1", writer_port);
+                continue;
+            }
+            writer_port = sport;
+            if (drop_every && (relayed++ % drop_every) == static_cast<uint64_t>(drop_every / 2))
+                continue; // injected loss
+            relay.sendTo(buf, n, "127.0.0.1", reader_port);
+        }
+    };
+
+    constexpr uint32_t PAYLOAD_SIZE = 32 * 1024; // 23 fragments
+    constexpr uint32_t FRAME_SIZE = PAYLOAD_SIZE + sizeof(transport::FrameHeader);
+    constexpr uint32_t kStatic = 64 * 1024;
+    std::vector<uint8_t> payload(PAYLOAD_SIZE, 0xAB);
+
+    int delivered = 0;
+    auto drain_reader = [&] {
+        while (reader.pollOnce([&](const transport::FrameHeader&, const void*, uint32_t) { ++delivered; })) {}
+    };
+    auto send_round = [&](int n_msgs, int drop_every) {
+        for (int i = 0; i < n_msgs; ++i) {
+            transport::FrameHeader hdr;
+            hdr.topic_hash = 0x2929;
+            hdr.seq_num = static_cast<uint64_t>(i);
+            hdr.timestamp_ns = platform::steadyNowNs();
+            hdr.payload_size = PAYLOAD_SIZE;
+            writer.send(hdr, payload.data(), PAYLOAD_SIZE);
+            pump(drop_every);
+            drain_reader();
+        }
+    };
+    auto feedback = [&] {
+        sleep_ms(transport::kLinkReportIntervalMs + 10);
+        reader.gc();
+        reader.sendLinkReport();
+        sleep_ms(2);
+        pump(0);
+        return writer.pollLinkReports();
+    };
+
+    // ── Phase 1: 5 % fragment loss → most 23-fragment groups time out ──
+    send_round(20, 20);
+    sleep_ms(transport::kFragmentTimeoutMs + 50); // let incomplete groups expire
+    CHECK(feedback() >= 1);
+
+    const uint64_t now = platform::steadyNowNs();
+    const auto &lq = writer.linkQuality();
+    CHECK(reader.assemblerStats().timed_out_groups > 0);
+    CHECK(delivered < 20);
+    CHECK(lq.hasEstimate(now));
+    CHECK(lq.stats().fragment_loss > 0.0);
+    // A 32 KB frame would now take TCP even though the static threshold is 64 KB.
+    CHECK(lq.udpThreshold(kStatic, now) < FRAME_SIZE);
+
+    // ── Phase 2: loss removed → threshold recovers with bounded steps ──
+    bool recovered = false;
+    for (int round = 0; round < 40 && !recovered; ++round) {
+        send_round(4, 0);
+        feedback();
+        recovered = lq.udpThreshold(kStatic, platform::steadyNowNs()) >= FRAME_SIZE;
+    }
+    CHECK(recovered);
+    CHECK(lq.stats().threshold_changes >= 2);
+    CHECK(lq.stats().srtt_ns > 0); // echoed from frames that made it through
+
+    std::cout << "PASS\n";
+}
+
+// ─── Test 30: FragmentPacer ────────────────────────────────────────────────────
+
+void test_fragment_pacer() {
+    std::cout << "[30] FragmentPacer slots + congestion control ... ";
+
+    constexpr uint64_t kMs = 1'000'000ull;
+
+    // Disabled pacer never delays.
+    transport::FragmentPacer off;
+    CHECK(!off.enabled());
+    CHECK(off.reserve(1 << 20, 5 * kMs) == 5 * kMs);
+
+    // 1 MB/s, 2 KB burst: 1 byte = 1 µs.
+    transport::PacingConfig cfg;
+    cfg.rate_bytes_per_sec = 1'000'000;
+    cfg.burst_bytes = 2000;
+    transport::FragmentPacer pacer(cfg);
+    CHECK(pacer.enabled());
+
+    const uint64_t t0 = 1000 * kMs;
+    // Burst credit: the first 2000 bytes leave immediately.
+    CHECK(pacer.reserve(1000, t0) == t0);
+    CHECK(pacer.reserve(1000, t0) == t0);
+    // Then one 1000-byte slot per millisecond.
+    CHECK(pacer.reserve(1000, t0) == t0); // credit exactly exhausted here
+    CHECK(pacer.reserve(1000, t0) == t0 + 1 * kMs);
+    CHECK(pacer.reserve(1000, t0) == t0 + 2 * kMs);
+    // Idle for a long time: credit is capped at one burst.
+    const uint64_t t1 = t0 + 1000 * kMs;
+    CHECK(pacer.reserve(2000, t1) == t1);
+    CHECK(pacer.reserve(1000, t1) == t1);
+    CHECK(pacer.reserve(1000, t1) == t1 + 1 * kMs);
+    CHECK(pacer.stats().paced_bytes == 9000);
+
+    // Loss-based control: multiplicative decrease, bounded increase.
+    transport::PacingConfig cc;
+    cc.rate_bytes_per_sec = 100'000'000;
+    cc.congestion = transport::CongestionControl::LossBased;
+    cc.min_rate_bytes_per_sec = 10'000'000;
+    cc.max_rate_bytes_per_sec = 200'000'000;
+    transport::FragmentPacer ctl(cc);
+    ctl.onFeedback(1, 9, 0);
+    CHECK(ctl.rate() == 70'000'000);
+    for (int i = 0; i < 20; ++i) ctl.onFeedback(3, 0, 0);
+    CHECK(ctl.rate() == cc.min_rate_bytes_per_sec);
+    for (int i = 0; i < 100; ++i) ctl.onFeedback(0, 10, 0);
+    CHECK(ctl.rate() == cc.max_rate_bytes_per_sec);
+    CHECK(ctl.stats().rate_decreases == 21);
+
+    // Delay-based: RTT inflation alone backs off.
+    cc.congestion = transport::CongestionControl::DelayBased;
+    transport::FragmentPacer dly(cc);
+    dly.onFeedback(0, 10, 1 * kMs);  // establishes min RTT, grows
+    const uint64_t before = dly.rate();
+    dly.onFeedback(0, 10, 5 * kMs);  // queueing delay
+    CHECK(dly.rate() < before);
+
+    std::cout << "PASS\n";
+}
+
+// ─── Test 31: Paced vs. back-to-back into a small receive buffer ───────────────
+
+/// Sends one 2 MB frame to a receiver with a 64 KB SO_RCVBUF that drains about
+/// once per millisecond, and returns the number of fragments that arrived.
+static size_t send_2mb_to_slow_receiver(const transport::PacingConfig *pacing,
+                                        bool &complete, double &elapsed_ms) {
+    platform::UdpSocket rx;
+    rx.bind("127.0.0.1", 0);
+    rx.setNonBlocking(true);
+    rx.setRecvBufferSize(64 * 1024);
+    const uint16_t port = rx.localPort();
+
+    transport::UdpTransportWriter writer("127.0.0.1", port);
+    if (pacing)
+        writer.setPacing(*pacing);
+
+    constexpr uint32_t PAYLOAD_SIZE = 2 * 1024 * 1024;
+    std::vector<uint8_t> payload(PAYLOAD_SIZE, 0x5A);
+    transport::FrameHeader hdr;
+    hdr.topic_hash = 0x3131;
+    hdr.payload_size = PAYLOAD_SIZE;
+
+    std::atomic<bool> done{false};
+    size_t frags = 0;
+    transport::FragmentAssembler assembler;
+    complete = false;
+    std::thread drain([&] {
+        std::vector<uint8_t> buf(transport::kMaxUdpPayload + 64);
+        std::string a; uint16_t p = 0;
+        auto idle_since = std::chrono::steady_clock::now();
+        for (;;) {
+            int n;
+            while ((n = rx.recvFrom(buf.data(), buf.size(), a, p)) > 0) {
+                ++frags;
+                idle_since = std::chrono::steady_clock::now();
+                transport::FragmentHeader fh;
+                std::memcpy(&fh, buf.data(), sizeof(fh));
+                if (assembler.feed(fh, buf.data() + sizeof(fh), n - sizeof(fh)))
+                    complete = true;
+            }
+            if (done.load() && std::chrono::steady_clock::now() - idle_since > std::chrono::milliseconds(50))
+                break;
+            sleep_ms(1); // slow consumer
+        }
+    });
+
+    auto t1 = std::chrono::steady_clock::now();
+    writer.send(hdr, payload.data(), PAYLOAD_SIZE);
+    writer.flush();
+    auto t2 = std::chrono::steady_clock::now();
+    done = true;
+    drain.join();
+
+    elapsed_ms = std::chrono::duration<double, std::milli>(t2 - t1).count();
+    return frags;
+}
+
+void test_paced_vs_burst() {
+    std::cout << "[31] Paced vs. back-to-back 2 MB into 64 KB rcvbuf ... ";
+    platform::NetInitGuard net_guard;
+
+    const size_t total_frags =
+        (2 * 1024 * 1024 + sizeof(transport::FrameHeader) + transport::kMaxFragPayload - 1) /
+        transport::kMaxFragPayload;
+
+    bool burst_complete = false, paced_complete = false;
+    double burst_ms = 0, paced_ms = 0;
+    const size_t burst_frags = send_2mb_to_slow_receiver(nullptr, burst_complete, burst_ms);
+
+    transport::PacingConfig pacing;
+    pacing.rate_bytes_per_sec = 8 * 1024 * 1024; // ≈ 5.7 fragments per ms
+    pacing.burst_bytes = 16 * 1024;
+    const size_t paced_frags = send_2mb_to_slow_receiver(&pacing, paced_complete, paced_ms);
+
+    // Back-to-back overruns the receive buffer; paced delivery fits in it.
+    CHECK(burst_frags < total_frags);
+    CHECK(!burst_complete);
+    CHECK(paced_frags == total_frags);
+    CHECK(paced_complete);
+    // 2 MB at 8 MB/s ≈ 250 ms.
+    CHECK(paced_ms > 200.0);
+
+    std::cout << "PASS (burst " << burst_frags << "/" << total_frags
+              << " frags, paced " << paced_frags << "/" << total_frags
+              << " in " << static_cast<int>(paced_ms) << " ms)\n";
+}
+
+// ─── Test 32: Allocation-free steady-state reassembly ──────────────────────────
+
+static std::optional<transport::FragmentAssembler::CompleteMessage>
+feed_all_fragments(transport::FragmentAssembler &assembler, const std::vector<uint8_t> &msg,
+                   uint32_t group_id, uint64_t topic_hash)
+{
+    const uint16_t total_frags = static_cast<uint16_t>(
+        (msg.size() + transport::kMaxFragPayload - 1) / transport::kMaxFragPayload);
+    std::optional<transport::FragmentAssembler::CompleteMessage> result;
+    for (uint16_t i = 0; i < total_frags; ++i) {
+        size_t offset   = static_cast<size_t>(i) * transport::kMaxFragPayload;
+        size_t frag_len = std::min<size_t>(transport::kMaxFragPayload, msg.size() - offset);
+
+        transport::FragmentHeader fh{};
+        fh.frag_magic        = transport::kFragmentMagic;
+        fh.group_id          = group_id;
+        fh.seq_in_group      = i;
+        fh.total_fragments   = total_frags;
+        fh.total_msg_size    = static_cast<uint32_t>(msg.size());
+        fh.topic_hash        = topic_hash;
+
+        auto r = assembler.feed(fh, msg.data() + offset, frag_len);
+        if (r) result = std::move(r);
+    }
+    return result;
+}
+
+void test_assembler_zero_alloc() {
+    std::cout << "[32] FragmentAssembler: steady-state zero allocation ... ";
+
+    constexpr size_t MSG_SIZE = 1024 * 1024;
+    std::vector<uint8_t> original(MSG_SIZE);
+    for (size_t i = 0; i < MSG_SIZE; ++i) original[i] = static_cast<uint8_t>(i * 7);
+
+    transport::FragmentAssembler assembler;
+    assembler.bufferPool().prewarm(MSG_SIZE, 2);
+    // Warm-up round sizes the slot bitmap.
+    CHECK(feed_all_fragments(assembler, original, 0, 0x3232).has_value());
+
+    const uint64_t pool_before = assembler.stats().buffer_allocations;
+    const uint64_t heap_before = g_allocs.load();
+
+    constexpr int ROUNDS = 50;
+    int ok = 0;
+    for (int r = 1; r <= ROUNDS; ++r) {
+        auto msg = feed_all_fragments(assembler, original, static_cast<uint32_t>(r), 0x3232);
+        if (msg && msg->size() == MSG_SIZE &&
+            std::memcmp(msg->data(), original.data(), MSG_SIZE) == 0)
+            ++ok;
+    }
+
+    const uint64_t heap_after = g_allocs.load();
+    CHECK(ok == ROUNDS);
+    CHECK(heap_after == heap_before);
+    CHECK(assembler.stats().buffer_allocations == pool_before);
+    CHECK(assembler.bufferPool().stats().reuses >= static_cast<uint64_t>(ROUNDS));
+
+    std::cout << "PASS (" << (heap_after - heap_before) << " allocations in "
+              << ROUNDS << " × 1 MB)\n";
+}
+
+// ─── Test 33: Slot eviction ─────────────────────────────────────────────────────
+
+void test_assembler_slot_eviction() {
+    std::cout << "[33] FragmentAssembler: oldest group evicted when full ... ";
+
+    transport::FragmentAssembler assembler(std::chrono::milliseconds{1000}, 2);
+    std::vector<uint8_t> dummy(transport::kMaxFragPayload, 0x33);
+
+    auto first_frag = [&](uint32_t group_id) {
+        transport::FragmentHeader fh{};
+        fh.frag_magic        = transport::kFragmentMagic;
+        fh.group_id          = group_id;
+        fh.seq_in_group      = 0;
+        fh.total_fragments   = 2;
+        fh.total_msg_size    = static_cast<uint32_t>(transport::kMaxFragPayload + 100);
+        fh.topic_hash        = 0x3333;
+        return fh;
+    };
+
+    CHECK(!assembler.feed(first_frag(1), dummy.data(), dummy.size()));
+    sleep_ms(2);
+    CHECK(!assembler.feed(first_frag(2), dummy.data(), dummy.size()));
+    sleep_ms(2);
+    CHECK(!assembler.feed(first_frag(3), dummy.data(), dummy.size())); // evicts group 1
+
+    auto s = assembler.stats();
+    CHECK(s.pending_groups == 2);
+    CHECK(s.evicted_groups == 1);
+
+    // Group 2 survived and completes; group 1's tail starts a fresh group.
+    auto tail = first_frag(2);
+    tail.seq_in_group = 1;
+    auto r = assembler.feed(tail, dummy.data(), 100);
+    CHECK(r.has_value());
+    tail.group_id = 1;
+    CHECK(!assembler.feed(tail, dummy.data(), 100));
+    CHECK(assembler.stats().evicted_groups == 1);
+
+    assembler.reset();
+    CHECK(assembler.stats().pending_groups == 0);
+
+    std::cout << "PASS\n";
+}
+
+// ─── Test 34: CompactFrameHeader encode / decode ───────────────────────────────
+
+void test_compact_header_codec() {
+    std::cout << "[34] CompactFrameHeader encode / decode ... ";
+
+    // Varint edges
+    uint8_t vb[10];
+    for (uint64_t v : {0ull, 127ull, 128ull, 16383ull, 16384ull, ~0ull}) {
+        size_t n = transport::writeVarint(vb, v);
+        uint64_t back = 0;
+        CHECK(transport::readVarint(vb, n, back) == n);
+        CHECK(back == v);
+    }
+    CHECK(transport::writeVarint(vb, 127) == 1);
+    CHECK(transport::writeVarint(vb, 128) == 2);
+    uint64_t trunc = 0;
+    CHECK(transport::readVarint(vb, 1, trunc) == 0); // truncated
+    for (int64_t v : {0ll, -1ll, 1ll, -1000000ll, 1000000ll})
+        CHECK(transport::zigzagDecode(transport::zigzagEncode(v)) == v);
+
+    transport::CompactBinding base;
+    base.topic_hash        = 0x3434;
+    base.base_seq          = 1000;
+    base.base_timestamp_ns = 5'000'000'000ull;
+    base.flags             = transport::kFlagReliable;
+    base.epoch             = 3;
+    base.publisher_id      = 77;
+
+    // Typical telemetry frame: small seq delta, µs timestamp delta, same flags.
+    transport::FrameHeader hdr;
+    hdr.topic_hash   = 0x3434;
+    hdr.seq_num      = 1005;
+    hdr.timestamp_ns = base.base_timestamp_ns + 2'000;
+    hdr.flags        = transport::kFlagReliable;
+
+    uint8_t buf[transport::kMaxCompactHeaderSize + 8] = {};
+    size_t len = transport::encodeCompactHeader(buf, hdr, 2, base);
+    CHECK(len > 0 && len <= 8); // vs. 48 for FrameHeader
+
+    transport::CompactFields f;
+    CHECK(transport::parseCompactHeader(buf, len + 8, f) == len);
+    CHECK(f.topic_id == 2);
+    CHECK(f.epoch == 3);
+    CHECK(!f.has_flags);
+    auto out = transport::expandCompactHeader(f, base, 8);
+    CHECK(transport::isValidFrame(out));
+    CHECK(out.topic_hash == hdr.topic_hash);
+    CHECK(out.seq_num == hdr.seq_num);
+    CHECK(out.timestamp_ns == hdr.timestamp_ns);
+    CHECK(out.flags == hdr.flags);
+    CHECK(out.publisher_id == base.publisher_id);
+    CHECK(out.payload_size == 8);
+
+    // No timestamp, changed flags, timestamp before baseline.
+    hdr.timestamp_ns = 0;
+    hdr.flags = 0;
+    len = transport::encodeCompactHeader(buf, hdr, 2, base);
+    CHECK(transport::parseCompactHeader(buf, len, f) == len);
+    out = transport::expandCompactHeader(f, base, 0);
+    CHECK(out.timestamp_ns == 0);
+    CHECK(out.flags == 0);
+
+    hdr.timestamp_ns = base.base_timestamp_ns - 7;
+    len = transport::encodeCompactHeader(buf, hdr, 2, base);
+    CHECK(transport::parseCompactHeader(buf, len, f) == len);
+    CHECK(transport::expandCompactHeader(f, base, 0).timestamp_ns == hdr.timestamp_ns);
+
+    // Sequence behind the baseline cannot be expressed.
+    hdr.seq_num = 999;
+    CHECK(transport::encodeCompactHeader(buf, hdr, 2, base) == 0);
+
+    // Truncated header rejected; marker distinct from other wire magics.
+    CHECK(transport::parseCompactHeader(buf, 3, f) == 0);
+    transport::FrameHeader full;
+    CHECK(!transport::isCompactFrame(&full, sizeof(full)));
+
+    std::cout << "PASS (" << len << " B header)\n";
+}
+
+// ─── Test 35: Compact headers over loopback ────────────────────────────────────
+
+void test_compact_header_negotiation() {
+    std::cout << "[35] UdpTransport compact header negotiation ... ";
+    platform::NetInitGuard net_guard;
+
+    transport::UdpTransportReader reader(0);
+    transport::UdpTransportWriter writer("127.0.0.1", reader.localPort());
+    writer.setCompactHeader(true);
+
+    transport::FrameHeader hdr;
+    hdr.topic_hash   = 0x3535;
+    hdr.seq_num      = 100;
+    hdr.timestamp_ns = 1'000'000'000ull;
+    uint64_t payload = 0;
+
+    auto drain = [&](std::vector<transport::FrameHeader> &got, std::vector<uint64_t> &vals) {
+        sleep_ms(20);
+        while (reader.pollOnce([&](const transport::FrameHeader &h, const void *p, uint32_t sz) {
+            got.push_back(h);
+            uint64_t v = 0;
+            if (sz == sizeof(v)) std::memcpy(&v, p, sz);
+            vals.push_back(v);
+        })) {}
+    };
+
+    // Before negotiation: full header.
+    CHECK(!writer.compactActive());
+    CHECK(writer.send(hdr, &payload, sizeof(payload)));
+    std::vector<transport::FrameHeader> got;
+    std::vector<uint64_t> vals;
+    drain(got, vals);
+    CHECK(got.size() == 1);
+
+    // Reader advertises the capability; writer switches.
+    CHECK(reader.sendLinkReport());
+    sleep_ms(20);
+    CHECK(writer.pollLinkReports() == 1);
+    CHECK(writer.compactActive());
+
+    constexpr int N = 200;
+    got.clear();
+    vals.clear();
+    for (int i = 1; i <= N; ++i) {
+        hdr.seq_num      = 100 + static_cast<uint64_t>(i);
+        hdr.timestamp_ns = 1'000'000'000ull + static_cast<uint64_t>(i) * 10'000;
+        hdr.flags        = (i % 50 == 0) ? transport::kFlagReliable : 0;
+        payload          = static_cast<uint64_t>(i) * 3;
+        CHECK(writer.send(hdr, &payload, sizeof(payload)));
+        if (i % 32 == 0) drain(got, vals);
+    }
+    drain(got, vals);
+
+    CHECK(got.size() == static_cast<size_t>(N));
+    bool exact = got.size() == static_cast<size_t>(N);
+    for (size_t i = 0; exact && i < got.size(); ++i) {
+        const uint64_t k = i + 1;
+        exact = got[i].topic_hash == 0x3535 && got[i].seq_num == 100 + k &&
+                got[i].timestamp_ns == 1'000'000'000ull + k * 10'000 &&
+                got[i].flags == ((k % 50 == 0) ? transport::kFlagReliable : 0) &&
+                vals[i] == k * 3;
+    }
+    CHECK(exact);
+    // Most frames compact; a binding frame every kCompactRebindFrames.
+    CHECK(writer.compactFramesSent() >= N - N / transport::kCompactRebindFrames - 1);
+    CHECK(reader.compactFramesReceived() == writer.compactFramesSent());
+    CHECK(reader.compactFramesUnbound() == 0);
+
+    // A compact frame from a sender without a binding is dropped.
+    platform::UdpSocket stranger;
+    uint8_t raw[transport::kMaxCompactHeaderSize + 8] = {};
+    transport::CompactBinding none;
+    size_t len = transport::encodeCompactHeader(raw, hdr, 0, none);
+    stranger.sendTo(raw, len + 8, "127.0.0.1", reader.localPort());
+    got.clear();
+    drain(got, vals);
+    CHECK(got.empty());
+    CHECK(reader.compactFramesUnbound() == 1);
+
+    std::cout << "PASS (" << writer.compactFramesSent() << "/" << N << " compact)\n";
+}
+
+// ─── Test 36: Evicted groups reported as loss ──────────────────────────────────
+
+void test_link_report_counts_evictions() {
+    std::cout << "[36] LinkReport counts evicted groups as lost ... ";
+    platform::NetInitGuard net_guard;
+
+    transport::UdpTransportReader reader(0);
+    platform::UdpSocket sender;
+    CHECK(sender.bindAny(0));
+
+    // More incomplete groups than the reader's 64 assembler slots.
+    constexpr uint32_t kGroups = 70;
+    std::vector<uint8_t> dgram(sizeof(transport::FragmentHeader) + transport::kMaxFragPayload, 0x36);
+    for (uint32_t g = 1; g <= kGroups; ++g) {
+        transport::FragmentHeader fh{};
+        fh.frag_magic      = transport::kFragmentMagic;
+        fh.group_id        = g;
+        fh.seq_in_group    = 0;
+        fh.total_fragments = 2;
+        fh.total_msg_size  = static_cast<uint32_t>(transport::kMaxFragPayload + 100);
+        fh.topic_hash      = 0x3636;
+        std::memcpy(dgram.data(), &fh, sizeof(fh));
+        sender.sendTo(dgram.data(), dgram.size(), "127.0.0.1", reader.localPort());
+        sleep_ms(1);
+        while (reader.pollOnce([](const transport::FrameHeader &, const void *, uint32_t) {})) {}
+    }
+
+    const auto st = reader.assemblerStats();
+    CHECK(st.timed_out_groups == 0);
+    CHECK(st.evicted_groups == kGroups - 64);
+
+    CHECK(reader.sendLinkReport());
+    sleep_ms(10);
+    transport::LinkReport rep;
+    std::string from;
+    uint16_t port = 0;
+    CHECK(sender.recvFrom(&rep, sizeof(rep), from, port) == static_cast<int>(sizeof(rep)));
+    CHECK(transport::isLinkReport(&rep, sizeof(rep)));
+    CHECK(rep.lost_groups == st.evicted_groups);
+
+    std::cout << "PASS\n";
+}
+
+// ─── Test 37: Paced sends keep frame order ─────────────────────────────────────
+
+void test_paced_send_order() {
+    std::cout << "[37] Paced UdpTransport keeps small frames behind large ones ... ";
+    platform::NetInitGuard net_guard;
+
+    transport::UdpTransportReader reader(0);
+    transport::UdpTransportWriter writer("127.0.0.1", reader.localPort());
+    transport::PacingConfig pacing;
+    pacing.rate_bytes_per_sec = 16 * 1024 * 1024;
+    pacing.burst_bytes = 16 * 1024;
+    writer.setPacing(pacing);
+
+    std::vector<uint8_t> large(64 * 1024, 0x37);
+    uint64_t small = 0;
+    transport::FrameHeader hdr;
+    hdr.topic_hash = 0x3737;
+    for (uint64_t seq = 1; seq <= 4; ++seq) {
+        hdr.seq_num = seq;
+        if (seq % 2) {
+            hdr.payload_size = static_cast<uint32_t>(large.size());
+            CHECK(writer.send(hdr, large.data(), hdr.payload_size));
+        } else {
+            hdr.payload_size = sizeof(small);
+            CHECK(writer.send(hdr, &small, sizeof(small)));
+        }
+    }
+
+    // A move drains the source's queue before taking over its socket.
+    transport::UdpTransportWriter moved(std::move(writer));
+    hdr.seq_num = 5;
+    hdr.payload_size = sizeof(small);
+    CHECK(moved.send(hdr, &small, sizeof(small)));
+    moved.flush();
+    CHECK(moved.queuedSendFailures() == 0);
+
+    std::vector<uint64_t> order;
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(2);
+    while (order.size() < 5 && std::chrono::steady_clock::now() < deadline) {
+        if (!reader.pollOnce([&](const transport::FrameHeader &h, const void *, uint32_t) {
+                order.push_back(h.seq_num);
+            }))
+            sleep_ms(1);
+    }
+    CHECK((order == std::vector<uint64_t>{1, 2, 3, 4, 5}));
+
+    std::cout << "PASS\n";
+}
+
 // ─── Main ──────────────────────────────────────────────────────────────────────
 
 int main() {
@@ -1080,6 +1785,24 @@ int main() {
     test_flag_reassembled();
     test_net_constants();
 
+    // Adaptive UDP/TCP path selection
+    test_link_quality_estimator();
+    test_adaptive_path_lossy_loopback();
+
+    // Paced fragment transmission
+    test_fragment_pacer();
+    test_paced_vs_burst();
+
+    // Allocation-free reassembly
+    test_assembler_zero_alloc();
+    test_assembler_slot_eviction();
+
+    // Compact wire header
+    test_compact_header_codec();
+    test_compact_header_negotiation();
+    test_link_report_counts_evictions();
+    test_paced_send_order();
+
     std::cout << "\n═══ Results: " << tests_passed << " passed, "
               << tests_failed << " failed ═══\n";
     return tests_failed > 0 ? 1 : 0;
@@ -20,6 +20,12 @@
  * 15. TokenBucket burst
  * 16. FrameHeader Reliable flag
  * 17. Combined QoS (RealtimeControl)
+ * 18. KeepLastRing exact depth under concurrent producers
+ * 19. KeepLast subscriber with concurrent publishers
+ * 20. FieldFilter encode / decode / evaluation
+ * 21. FieldFilter on a subscriber (intra path)
+ * 22. FieldFilter on a large serializable message (shared_ptr path)
+ * 23. FieldFilter pushdown to a process with a filtered and an unfiltered subscriber
  */
 #include <iostream>
 #include <cassert>
@@ -35,12 +41,23 @@
 #include <lux/communication/QoSProfiles.hpp>
 #include <lux/communication/QoSChecker.hpp>
 #include <lux/communication/TokenBucket.hpp>
+#include <lux/communication/KeepLastRing.hpp>
+#include <lux/communication/FieldFilter.hpp>
 #include <lux/communication/transport/FrameHeader.hpp>
 #include <lux/communication/unified/Node.hpp>
 #include <lux/communication/executor/SingleThreadedExecutor.hpp>
 #include <lux/communication/platform/PlatformDefs.hpp>
 #include <lux/communication/Domain.hpp>
 
+#ifdef __linux__
+#include <signal.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <lux/communication/discovery/DiscoveryService.hpp>
+#include <lux/communication/transport/ShmRingReader.hpp>
+#endif
+
 namespace comm = lux::communication;
 
 static int  tests_passed = 0;
@@ -704,6 +721,478 @@ static void testCombinedQoS()
     std::cout << "OK\n";
 }
 
+// ─── Test 18: KeepLastRing under concurrent producers ────────────────────
+
+static void testKeepLastRingConcurrent()
+{
+    std::cout << "[KeepLastRing] Testing exact depth with 4 producers ... ";
+
+    constexpr int kProducers   = 4;
+    constexpr int kPerProducer = 20000;
+    constexpr uint64_t kTotal  = uint64_t(kProducers) * kPerProducer;
+
+    // No consumer: the ring ends up holding exactly `depth` entries and
+    // every other push is counted as a drop.  7 exercises the modulo index.
+    for (size_t depth : {size_t(1), size_t(7), size_t(16)})
+    {
+        comm::KeepLastRing<uint64_t> ring(depth);
+        std::atomic<uint64_t> evicted{0};
+        std::vector<std::thread> producers;
+        for (int p = 0; p < kProducers; ++p)
+        {
+            producers.emplace_back([&, p] {
+                for (int i = 0; i < kPerProducer; ++i)
+                    ring.push(uint64_t(p) * kPerProducer + i + 1,
+                              [&](uint64_t&&) { evicted.fetch_add(1, std::memory_order_relaxed); });
+            });
+        }
+        for (auto& t : producers)
+            t.join();
+
+        CHECK(ring.sizeApprox() == depth,
+              "KeepLastRing(" + std::to_string(depth) + "): holds depth (got "
+              + std::to_string(ring.sizeApprox()) + ")");
+        CHECK(ring.dropped() == kTotal - depth,
+              "KeepLastRing(" + std::to_string(depth) + "): dropped == pushed - depth (got "
+              + std::to_string(ring.dropped()) + ")");
+        CHECK(evicted.load() == ring.dropped(),
+              "KeepLastRing(" + std::to_string(depth) + "): one on_evict per drop");
+
+        // The survivors are each producer's latest values, in per-producer order.
+        std::vector<uint64_t> last(kProducers, 0);
+        uint64_t v = 0;
+        size_t popped = 0;
+        bool ordered = true;
+        while (ring.tryPop(v))
+        {
+            const auto p = static_cast<size_t>((v - 1) / kPerProducer);
+            ordered = ordered && v > last[p];
+            last[p] = v;
+            ++popped;
+        }
+        CHECK(popped == depth, "KeepLastRing: pops exactly depth entries");
+        CHECK(ordered, "KeepLastRing: per-producer FIFO order kept");
+    }
+
+    // With a concurrent consumer nothing is lost or duplicated:
+    // popped + dropped == pushed.
+    {
+        comm::KeepLastRing<uint64_t> ring(5);
+        std::atomic<bool> done{false};
+        std::atomic<uint64_t> sum_pushed{0};
+        uint64_t popped = 0, sum_popped = 0, sum_evicted = 0;
+        std::mutex evict_mutex;
+
+        std::thread consumer([&] {
+            uint64_t v = 0;
+            for (;;)
+            {
+                const bool finished = done.load(std::memory_order_acquire);
+                if (ring.tryPop(v))
+                {
+                    ++popped;
+                    sum_popped += v;
+                }
+                else if (finished)
+                    break;
+                else
+                    std::this_thread::yield();
+            }
+        });
+
+        std::vector<std::thread> producers;
+        for (int p = 0; p < kProducers; ++p)
+        {
+            producers.emplace_back([&, p] {
+                for (int i = 0; i < kPerProducer; ++i)
+                {
+                    const uint64_t v = uint64_t(p) * kPerProducer + i + 1;
+                    sum_pushed.fetch_add(v, std::memory_order_relaxed);
+                    ring.push(v, [&](uint64_t&& e) {
+                        std::lock_guard<std::mutex> lock(evict_mutex);
+                        sum_evicted += e;
+                    });
+                }
+            });
+        }
+        for (auto& t : producers)
+            t.join();
+        done.store(true, std::memory_order_release);
+        consumer.join();
+
+        CHECK(popped + ring.dropped() == kTotal,
+              "KeepLastRing: popped + dropped == pushed (popped=" + std::to_string(popped)
+              + " dropped=" + std::to_string(ring.dropped()) + ")");
+        CHECK(sum_popped + sum_evicted == sum_pushed.load(),
+              "KeepLastRing: every value popped or evicted exactly once");
+    }
+
+    std::cout << "OK\n";
+}
+
+// ─── Test 19: KeepLast subscriber, concurrent publishers ─────────────────
+
+static void testKeepLastConcurrentPublishers()
+{
+    std::cout << "[KeepLast] Testing exact depth with 4 publisher threads ... ";
+
+    constexpr int kThreads   = 4;
+    constexpr int kPerThread = 2000;
+    constexpr int kTotal     = kThreads * kPerThread;
+
+    for (uint64_t depth : {uint64_t(1), uint64_t(10)})
+    {
+        comm::Domain domain(depth == 1 ? 618 : 619);
+        comm::Node node("qos_kl_mp", domain, intraOnlyOpts());
+
+        std::atomic<int> recv_count{0};
+
+        comm::SubscribeOptions sub_opts;
+        sub_opts.qos.history = comm::History::KeepLast;
+        sub_opts.qos.depth   = depth;
+
+        auto sub = node.createSubscriber<int>("qos/kl_mp",
+            [&](const int&) { recv_count.fetch_add(1); },
+            nullptr, sub_opts);
+
+        auto pub = node.createPublisher<int>("qos/kl_mp");
+
+        comm::SingleThreadedExecutor exec;
+        exec.addNode(&node);
+
+        // Publish from several threads while nothing consumes: the queue
+        // must end up holding exactly the last `depth` messages.
+        std::vector<std::thread> publishers;
+        for (int t = 0; t < kThreads; ++t)
+        {
+            publishers.emplace_back([&, t] {
+                for (int i = 0; i < kPerThread; ++i)
+                    pub->publish(t * kPerThread + i);
+            });
+        }
+        for (auto& t : publishers)
+            t.join();
+
+        exec.spinSome();
+
+        CHECK(recv_count.load() == static_cast<int>(depth),
+              "KeepLast(" + std::to_string(depth) + "): received exactly depth (got "
+              + std::to_string(recv_count.load()) + ")");
+        CHECK(sub->keepLastDropped() == kTotal - depth,
+              "KeepLast(" + std::to_string(depth) + "): dropped == published - depth (got "
+              + std::to_string(sub->keepLastDropped()) + ")");
+
+        node.stop();
+    }
+
+    std::cout << "OK\n";
+}
+
+// ─── Test 20: FieldFilter encode / decode / evaluation ───────────────────
+
+struct FilterReading
+{
+    int32_t  id;
+    float    temp;
+    double   pressure;
+    uint8_t  flags;
+};
+
+/// Trivially copyable but above the inline size: shared_ptr storage and,
+/// from SHM / network, the raw-bytes path of deserialize_on_executor.
+struct FilterFrame
+{
+    int32_t id;
+    float   temp;
+    char    pixels[512];
+};
+
+struct FilterLabel
+{
+    std::string text;
+    int         priority;
+};
+
+static void testFieldFilterCodec()
+{
+    std::cout << "[FieldFilter] Testing encode / decode / matches ... ";
+
+    comm::FieldFilter ff;
+    ff.where(&FilterReading::temp, comm::CompareOp::Gt, 20.5f)
+      .where(&FilterReading::flags, comm::CompareOp::Eq, 3)
+      .minInterval(std::chrono::milliseconds(100));
+
+    const std::string text = ff.encode();
+    CHECK(!text.empty() && text.size() <= comm::FieldFilter::kMaxEncodedSize,
+          "FieldFilter: encodes within the discovery limit (got '" + text + "')");
+
+    comm::FieldFilter decoded;
+    CHECK(comm::FieldFilter::decode(text, decoded), "FieldFilter: decode succeeds");
+    CHECK(decoded.encode() == text, "FieldFilter: decode(encode()) round-trips");
+    CHECK(decoded.minIntervalNs() == 100'000'000, "FieldFilter: interval round-trips");
+
+    FilterReading hot{1, 25.0f, 1.0, 3};
+    FilterReading cold{2, 20.5f, 1.0, 3};
+    FilterReading other_flags{3, 30.0f, 1.0, 1};
+    CHECK(decoded.matches(hot), "FieldFilter: temp > 20.5 && flags == 3 passes");
+    CHECK(!decoded.matches(cold), "FieldFilter: temp == 20.5 rejected");
+    CHECK(!decoded.matches(other_flags), "FieldFilter: flags != 3 rejected");
+
+    uint64_t last = 0;
+    CHECK(decoded.sampled(1'000'000'000, last), "FieldFilter: first sample passes");
+    CHECK(!decoded.sampled(1'050'000'000, last), "FieldFilter: sample within interval rejected");
+    CHECK(decoded.sampled(1'100'000'000, last), "FieldFilter: sample after interval passes");
+
+    // Named fields on a type that is not trivially copyable.
+    comm::FilterFields<FilterLabel>::add("prio", [](const FilterLabel& l) { return double(l.priority); });
+    comm::FieldFilter named;
+    named.where("prio", comm::CompareOp::Ge, 2).where("unregistered", comm::CompareOp::Eq, 0);
+    comm::FieldFilter named_decoded;
+    CHECK(comm::FieldFilter::decode(named.encode(), named_decoded),
+          "FieldFilter: named predicates decode");
+    named_decoded.resolve<FilterLabel>();
+    CHECK(named_decoded.matches(FilterLabel{"a", 2}), "FieldFilter: prio >= 2 passes");
+    CHECK(!named_decoded.matches(FilterLabel{"b", 1}), "FieldFilter: prio < 2 rejected");
+
+    // Too long for discovery: not advertised, still usable locally.
+    comm::FieldFilter long_ff;
+    for (int i = 0; i < 4; ++i)
+        long_ff.where(&FilterReading::pressure, comm::CompareOp::Lt, 1013.25 + i);
+    CHECK(long_ff.encode().empty(), "FieldFilter: over-long filter encodes empty");
+
+    comm::FieldFilter bad;
+    CHECK(!comm::FieldFilter::decode("@4x>1", bad) && !comm::FieldFilter::decode("temp>", bad)
+          && !comm::FieldFilter::decode("~abc", bad),
+          "FieldFilter: malformed input rejected");
+
+    std::cout << "OK\n";
+}
+
+// ─── Test 21: FieldFilter on a subscriber (intra path) ──────────────────
+
+static void testFieldFilterSubscriber()
+{
+    std::cout << "[FieldFilter] Testing subscriber field filter and sampling ... ";
+
+    comm::Domain domain(620);
+    comm::Node node("qos_field_filter", domain, intraOnlyOpts());
+
+    std::vector<int32_t> hot_ids;
+    std::atomic<int> sampled_count{0};
+
+    comm::SubscribeOptions hot_opts;
+    hot_opts.field_filter.where(&FilterReading::temp, comm::CompareOp::Gt, 20.0f);
+    auto hot_sub = node.createSubscriber<FilterReading>("qos/field_filter",
+        [&](const FilterReading& r) { hot_ids.push_back(r.id); },
+        nullptr, hot_opts,
+        // Composes with the ContentFilter callback.
+        [](const FilterReading& r) { return r.id != 7; });
+
+    comm::SubscribeOptions sampled_opts;
+    sampled_opts.field_filter.minInterval(std::chrono::hours(1));
+    auto sampled_sub = node.createSubscriber<FilterReading>("qos/field_filter",
+        [&](const FilterReading&) { sampled_count.fetch_add(1); },
+        nullptr, sampled_opts);
+
+    auto pub = node.createPublisher<FilterReading>("qos/field_filter");
+
+    comm::SingleThreadedExecutor exec;
+    exec.addNode(&node);
+
+    for (int32_t i = 0; i < 10; ++i)
+        pub->publish(FilterReading{i, static_cast<float>(i * 5), 1.0, 0});
+
+    exec.spinSome();
+    node.stop();
+
+    CHECK((hot_ids == std::vector<int32_t>{5, 6, 8, 9}),
+          "FieldFilter subscriber: temp > 20 and ContentFilter both applied (got "
+          + std::to_string(hot_ids.size()) + " messages)");
+    CHECK(sampled_count.load() == 1,
+          "FieldFilter subscriber: one message per interval (got "
+          + std::to_string(sampled_count.load()) + ")");
+
+    std::cout << "OK\n";
+}
+
+// ─── Test 22: FieldFilter on a large serializable message ──────────────
+
+static void testFieldFilterLargeMessage()
+{
+    std::cout << "[FieldFilter] Testing field filter on a large message ... ";
+
+    comm::Domain domain(621);
+    comm::Node node("qos_field_filter_large", domain, intraOnlyOpts());
+
+    std::vector<int32_t> ids;
+    comm::SubscribeOptions opts;
+    opts.field_filter.where(&FilterFrame::temp, comm::CompareOp::Ge, 10.0f);
+    opts.deserialize_on_executor = true;
+    auto sub = node.createSubscriber<FilterFrame>("qos/field_filter_large",
+        [&](std::shared_ptr<FilterFrame> f) { ids.push_back(f->id); },
+        nullptr, opts);
+
+    auto pub = node.createPublisher<FilterFrame>("qos/field_filter_large");
+
+    comm::SingleThreadedExecutor exec;
+    exec.addNode(&node);
+
+    for (int32_t i = 0; i < 6; ++i)
+    {
+        FilterFrame f{};
+        f.id   = i;
+        f.temp = static_cast<float>(i * 4);
+        pub->publish(f);
+    }
+
+    exec.spinSome();
+    node.stop();
+
+    CHECK(!comm::SmallValueMsg<FilterFrame> && comm::serialization::HasSerializer<FilterFrame>,
+          "FieldFilter large message: takes the serializable shared_ptr path");
+    CHECK((ids == std::vector<int32_t>{3, 4, 5}),
+          "FieldFilter large message: temp >= 10 applied (got "
+          + std::to_string(ids.size()) + " messages)");
+
+    std::cout << "OK\n";
+}
+
+// ─── Test 23: FieldFilter pushdown, mixed subscribers in one process ────
+
+#ifdef __linux__
+/// Forked "remote" process: announces a filtered and an unfiltered
+/// subscriber, reads the SHM ring the publisher opens for it, then
+/// withdraws the unfiltered one.  Exit code 0 = cold readings arrived while
+/// the unfiltered subscriber was there and stopped after it left;
+/// 1 = no cold reading (the other's filter was applied to the peer);
+/// 2 = cold readings kept coming (the filters were not recomputed);
+/// 3 = the ring went quiet (the peer was dropped with one subscriber).
+static int runMixedSubscribers(size_t domain_id, const std::string& topic, pid_t parent)
+{
+    auto& ds = comm::discovery::DiscoveryService::getInstance(domain_id);
+    ds.start();
+
+    comm::FieldFilter hot;
+    hot.where(&FilterReading::temp, comm::CompareOp::Gt, 20.0f);
+    ds.announceSubscriber(topic, typeid(FilterReading).name(), typeid(FilterReading).hash_code(),
+                          "", "", hot.encode());
+    const uint64_t all_handle = ds.announceSubscriber(
+        topic, typeid(FilterReading).name(), typeid(FilterReading).hash_code());
+
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+    std::unique_ptr<comm::transport::ShmRingReader> reader;
+    while (!reader && std::chrono::steady_clock::now() < deadline)
+    {
+        try
+        {
+            reader = std::make_unique<comm::transport::ShmRingReader>(comm::detail::makeRingName(
+                domain_id, comm::fnv1a_64(topic), static_cast<uint32_t>(parent),
+                static_cast<uint32_t>(getpid())));
+        }
+        catch (...)
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+    }
+    if (!reader)
+        return 3;
+
+    // Next reading's temperature; NaN when nothing arrives for a second.
+    auto next = [&]
+    {
+        auto view = reader->acquireReadView(std::chrono::seconds(1));
+        if (!view.data)
+            return std::nanf("");
+        FilterReading r{};
+        const auto* hdr = static_cast<const comm::transport::FrameHeader*>(view.data);
+        comm::serialization::Serializer<FilterReading>::deserialize(
+            r, static_cast<const char*>(view.data) + sizeof(*hdr), hdr->payload_size);
+        reader->releaseReadView();
+        return r.temp;
+    };
+
+    float t;
+    do
+        t = next();
+    while (t > 20.0f && std::chrono::steady_clock::now() < deadline);
+    if (!(t <= 20.0f))
+        return 1; // NaN or still hot
+
+    ds.withdraw(all_handle);
+    for (int hot_run = 0; hot_run < 50;)
+    {
+        if (std::chrono::steady_clock::now() > deadline + std::chrono::seconds(10))
+            return 2;
+        t = next();
+        if (std::isnan(t))
+            return 3;
+        hot_run = t > 20.0f ? hot_run + 1 : 0;
+    }
+    return 0;
+}
+
+static void testFieldFilterPushdownMixed()
+{
+    std::cout << "[FieldFilter] Testing pushdown to mixed subscribers in one process ... ";
+
+    constexpr size_t domain_id = 622;
+    const std::string topic = "qos/field_filter_mixed_" + std::to_string(getpid());
+
+    const pid_t parent = getpid();
+    int go[2]; // parent -> child: the publisher exists
+    if (pipe(go) != 0)
+    {
+        CHECK(false, "FieldFilter pushdown: pipe() failed");
+        return;
+    }
+
+    std::cout.flush();
+    const pid_t child = fork();
+    if (child == 0)
+    {
+        close(go[1]);
+        char c;
+        (void)!read(go[0], &c, 1);
+        _exit(runMixedSubscribers(domain_id, topic, parent));
+    }
+    close(go[0]);
+
+    int status = -1;
+    {
+        comm::Domain domain(domain_id);
+        comm::Node node("qos_pushdown_pub", domain, { .enable_net = false });
+        auto pub = node.createPublisher<FilterReading>(topic);
+        (void)!write(go[1], "g", 1);
+        close(go[1]);
+
+        // Alternate hot and cold readings until the child is done.
+        const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(30);
+        for (int32_t i = 0; std::chrono::steady_clock::now() < deadline; ++i)
+        {
+            if (waitpid(child, &status, WNOHANG) == child)
+                break;
+            pub->publish(FilterReading{i, (i % 2) ? 30.0f : 10.0f, 1.0, 0});
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        node.stop();
+    }
+    if (status == -1)
+    {
+        kill(child, SIGKILL);
+        waitpid(child, &status, 0);
+    }
+
+    const int rc = WIFEXITED(status) ? WEXITSTATUS(status) : -1;
+    CHECK(rc != 1, "FieldFilter pushdown: unfiltered subscriber got no cold readings");
+    CHECK(rc != 2, "FieldFilter pushdown: filter not restored after the unfiltered subscriber left");
+    CHECK(rc != 3, "FieldFilter pushdown: peer dropped while a subscriber remained");
+    CHECK(rc >= 0 && rc <= 3,
+          "FieldFilter pushdown: subscriber process failed (status " + std::to_string(status) + ")");
+
+    std::cout << "OK\n";
+}
+#endif
+
 // ─── Main ─────────────────────────────────────────────────────────────────
 
 int main()
@@ -729,6 +1218,14 @@ int main()
     testTokenBucketBurst();
     testFrameHeaderReliable();
     testCombinedQoS();
+    testKeepLastRingConcurrent();
+    testKeepLastConcurrentPublishers();
+    testFieldFilterCodec();
+    testFieldFilterSubscriber();
+    testFieldFilterLargeMessage();
+#ifdef __linux__
+    testFieldFilterPushdownMixed();
+#endif
 
     std::cout << "\n===============================================\n";
     std::cout << "  Results: " << tests_passed << " passed, "
@@ -177,6 +177,9 @@ int main()
     std::cout << "Ring put OK:       " << stats.ring_put_ok << std::endl;
     std::cout << "Max window:        " << stats.max_window << std::endl;
     std::cout << "Discarded old:     " << stats.discarded_old << std::endl;
+    std::cout << "Consumed seqs:     " << stats.consumed << std::endl;
+    std::cout << "Gaps skipped:      " << stats.gaps_skipped << std::endl;
+    std::cout << "Late entries:      " << stats.late << std::endl;
     std::cout << "Final pending:     " << executor.pending_size() << std::endl;
 
     // Verify ordering
@@ -22,18 +22,20 @@ static comm::NodeOptions intraOpts()
 
 static std::atomic<bool> g_running{true}; // control when publishing threads stop
 
-// Function that runs a single test with a given time_offset for a period and counts out-of-order events
-void run_test_with_offset(std::chrono::nanoseconds offset,
+// Function that runs a single test with a given idle timeout for a period and counts out-of-order events
+void run_test_with_idle_timeout(std::chrono::nanoseconds idle_timeout,
                           uint64_t test_duration_ms,
                           std::atomic<uint64_t> &imu_out_of_order_count,
-                          std::atomic<uint64_t> &cam_out_of_order_count)
+                          std::atomic<uint64_t> &cam_out_of_order_count,
+                          uint64_t &merge_late_count)
 {
     // 1) Create Domain / Node
     comm::Domain domain(0);
     comm::Node node("test_node", domain, intraOpts());
 
-    // 2) Create TimeOrderedExecutor with a delay window
-    auto timeExec = std::make_shared<lux::communication::TimeOrderedExecutor>(offset);
+    // 2) Create TimeOrderedExecutor; a source silent for idle_timeout stops holding the merge
+    auto timeExec = std::make_shared<lux::communication::TimeOrderedExecutor>(
+        lux::communication::TimeOrderedOptions{.idle_timeout = idle_timeout});
     // Add the node's default callback group to the executor
     timeExec->addNode(&node);
 
@@ -139,27 +141,33 @@ void run_test_with_offset(std::chrono::nanoseconds offset,
     t_imu.join();
     t_cam.join();
     t_exec.join();
+
+    // Entries that ran after a newer one from the other topic
+    merge_late_count = timeExec->lateCount();
 }
 
 int main()
 {
-    // Test several offset values (0, 5ms, 20ms, 50ms, ...)
+    // Test several idle timeouts (0, 5ms, 20ms, 50ms, ...); above the camera
+    // period (~33-41ms) the merge should never release IMU ahead of a frame
     // Run each for 10 seconds and log the results
     const uint64_t test_duration_ms = 10'000; // 10 seconds
-    for (auto offset_ms : {0, 5, 20, 50})
+    for (auto idle_ms : {0, 5, 20, 50})
     {
         // Convert to nanoseconds
-        auto offset_ns = std::chrono::milliseconds(offset_ms);
+        auto idle_ns = std::chrono::milliseconds(idle_ms);
 
         std::atomic<uint64_t> imu_out_of_order = 0;
         std::atomic<uint64_t> cam_out_of_order = 0;
+        uint64_t merge_late = 0;
 
         // Run the test
-        run_test_with_offset(offset_ns, test_duration_ms, imu_out_of_order, cam_out_of_order);
+        run_test_with_idle_timeout(idle_ns, test_duration_ms, imu_out_of_order, cam_out_of_order, merge_late);
 
-        std::cout << "[Test Offset = " << offset_ms << " ms]"
+        std::cout << "[Test Idle timeout = " << idle_ms << " ms]"
                   << " IMU out_of_order=" << imu_out_of_order
                   << " Camera out_of_order=" << cam_out_of_order
+                  << " Merge late=" << merge_late
                   << std::endl;
     }
 
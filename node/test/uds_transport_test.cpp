@@ -0,0 +1,542 @@
+/// Unix domain socket transport tests.
+///
+/// Tests:
+///   1.  UnixListener + UnixSocket: connect, message boundaries preserved
+///   2.  MemFdRegion: create → pass descriptor → map read-only
+///   3.  UdsTransport handshake accepted
+///   4.  UdsTransport handshake type mismatch → rejected
+///   5.  UdsTransport roundtrip (small, inline)
+///   6.  UdsTransport roundtrip (1 MB, memfd)
+///   7.  UdsTransport 1 Writer → 3 Readers
+///   8.  UdsTransport writer close → reader sees disconnect
+///   9.  TransportSelector: same host without SHM → Uds for "uds:" endpoints
+///  10.  Benchmark: UDS vs. loopback UDP vs. loopback TCP (64 B, 1 MB)
+
+#include <lux/communication/platform/UnixSocket.hpp>
+#include <lux/communication/platform/NetSocket.hpp>
+#include <lux/communication/platform/PlatformDefs.hpp>
+#include <lux/communication/transport/FrameHeader.hpp>
+#include <lux/communication/transport/NetConstants.hpp>
+#include <lux/communication/transport/UdsTransportWriter.hpp>
+#include <lux/communication/transport/UdsTransportReader.hpp>
+#include <lux/communication/transport/UdpTransportWriter.hpp>
+#include <lux/communication/transport/UdpTransportReader.hpp>
+#include <lux/communication/transport/TcpTransportWriter.hpp>
+#include <lux/communication/transport/TcpTransportReader.hpp>
+#include <lux/communication/TransportSelector.hpp>
+#include <lux/communication/NodeOptions.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <unistd.h>
+
+using namespace lux::communication;
+
+// ─── Helpers ────────────────────────────────────────────────────────────────────
+
+static int tests_passed = 0;
+static int tests_failed = 0;
+
+#define CHECK(expr) \
+    do { \
+        if (!(expr)) { \
+            std::cerr << "  FAIL: " #expr " (line " << __LINE__ << ")\n"; \
+            ++tests_failed; \
+        } else { \
+            ++tests_passed; \
+        } \
+    } while (0)
+
+static void sleep_ms(int ms) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(ms));
+}
+
+static std::string socket_path(const char* tag) {
+    return "/tmp/lux_uds_test_" + std::to_string(platform::currentPid()) + "_" + tag + ".sock";
+}
+
+/// Poll @p reader until a frame arrives or @p timeout_ms elapses.
+template <typename Reader>
+static bool poll_until(Reader& reader, const transport::UdsTransportReader::FrameCallback& cb,
+                       int timeout_ms = 500) {
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(timeout_ms);
+    while (std::chrono::steady_clock::now() < deadline) {
+        if (reader.pollOnce(cb))
+            return true;
+        sleep_ms(1);
+    }
+    return false;
+}
+
+/// Writer listening on @p path with one connected reader.
+struct UdsPair {
+    transport::UdsTransportWriter writer;
+    transport::UdsTransportReader reader;
+    bool connected = false;
+
+    UdsPair(const std::string& path, uint64_t topic_hash, uint64_t type_hash,
+            uint32_t memfd_threshold = transport::kUdsMemFdThreshold)
+        : writer(path, topic_hash, type_hash, memfd_threshold),
+          reader(path, topic_hash, type_hash, 1234, "test-host") {
+        if (!writer.startListening())
+            return;
+        std::thread accept_thread([&] { writer.onAcceptReady(); });
+        connected = reader.connect();
+        accept_thread.join();
+    }
+};
+
+// ─── Test 1: UnixListener + UnixSocket ──────────────────────────────────────────
+
+void test_socket_boundaries() {
+    std::cout << "[1]  UnixListener + UnixSocket message boundaries ... ";
+
+    auto path = socket_path("sock");
+    platform::UnixListener listener;
+    CHECK(listener.listen(path));
+
+    platform::UnixSocket client;
+    CHECK(client.connect(path));
+    auto server = listener.accept();
+    CHECK(server.isValid());
+
+    // Two sends must arrive as two messages (SOCK_SEQPACKET).
+    const char a[] = "first";
+    const char b[] = "second-message";
+    CHECK(client.sendAll(a, sizeof(a)));
+    CHECK(client.sendAll(b, sizeof(b)));
+
+    char buf[64]{};
+    int fd = -1;
+    CHECK(server.recv(buf, sizeof(buf), fd) == static_cast<int>(sizeof(a)));
+    CHECK(std::strcmp(buf, a) == 0);
+    CHECK(fd == -1);
+    CHECK(server.recv(buf, sizeof(buf), fd) == static_cast<int>(sizeof(b)));
+    CHECK(std::strcmp(buf, b) == 0);
+
+    // Non-blocking empty socket reports would-block, not EOF.
+    CHECK(server.setNonBlocking(true));
+    CHECK(server.recv(buf, sizeof(buf), fd) < 0);
+
+    client.close();
+    CHECK(server.recv(buf, sizeof(buf), fd) == 0);
+
+    std::cout << "PASS\n";
+}
+
+// ─── Test 2: MemFdRegion ────────────────────────────────────────────────────────
+
+void test_memfd_pass() {
+    std::cout << "[2]  MemFdRegion create → pass → map read-only ... ";
+
+    auto path = socket_path("memfd");
+    platform::UnixListener listener;
+    CHECK(listener.listen(path));
+    platform::UnixSocket client;
+    CHECK(client.connect(path));
+    auto server = listener.accept();
+
+    constexpr size_t kSize = 256 * 1024;
+    auto region = platform::MemFdRegion::create(kSize);
+    CHECK(region.isValid());
+    CHECK(region.size() == kSize);
+    for (size_t i = 0; i < kSize; ++i)
+        region.data()[i] = static_cast<uint8_t>(i * 7);
+
+    const uint32_t tag = 0xABCD;
+    platform::IoVec iov{&tag, sizeof(tag)};
+    CHECK(client.sendV(&iov, 1, region.fd()) == static_cast<int>(sizeof(tag)));
+    region.reset();
+
+    uint32_t got_tag = 0;
+    int fd = -1;
+    CHECK(server.recv(&got_tag, sizeof(got_tag), fd) == static_cast<int>(sizeof(tag)));
+    CHECK(got_tag == tag);
+    CHECK(fd >= 0);
+
+    // A size larger than the file is refused.
+    int dup_fd = ::dup(fd);
+    CHECK(!platform::MemFdRegion::mapReadOnly(dup_fd, kSize * 2).isValid());
+
+    auto mapped = platform::MemFdRegion::mapReadOnly(fd, kSize);
+    CHECK(mapped.isValid());
+    bool same = true;
+    for (size_t i = 0; i < kSize; ++i)
+        same &= mapped.data()[i] == static_cast<uint8_t>(i * 7);
+    CHECK(same);
+
+    std::cout << "PASS\n";
+}
+
+// ─── Test 3: Handshake accepted ─────────────────────────────────────────────────
+
+void test_handshake_accepted() {
+    std::cout << "[3]  UdsTransport handshake accepted ... ";
+
+    UdsPair pair(socket_path("hs"), 0x1111, 0x2222);
+    CHECK(pair.connected);
+    CHECK(pair.reader.isConnected());
+    CHECK(pair.writer.connectionCount() == 1);
+
+    std::cout << "PASS\n";
+}
+
+// ─── Test 4: Handshake type mismatch ────────────────────────────────────────────
+
+void test_handshake_type_mismatch() {
+    std::cout << "[4]  UdsTransport handshake type mismatch → rejected ... ";
+
+    auto path = socket_path("hs_bad");
+    transport::UdsTransportWriter writer(path, 0x3333, 0x4444);
+    CHECK(writer.startListening());
+
+    std::thread accept_thread([&] { writer.onAcceptReady(); });
+    transport::UdsTransportReader reader(path, 0x3333, 0x9999, 1234, "test-host");
+    CHECK(!reader.connect());
+    accept_thread.join();
+
+    CHECK(!reader.isConnected());
+    CHECK(writer.connectionCount() == 0);
+
+    std::cout << "PASS\n";
+}
+
+// ─── Test 5: Small inline roundtrip ─────────────────────────────────────────────
+
+void test_roundtrip_small() {
+    std::cout << "[5]  UdsTransport roundtrip (small, inline) ... ";
+
+    UdsPair pair(socket_path("small"), 0x5555, 0x6666);
+    CHECK(pair.connected);
+
+    transport::FrameHeader hdr;
+    hdr.topic_hash   = 0x5555;
+    hdr.seq_num      = 7;
+    hdr.payload_size = 64;
+    std::vector<uint8_t> payload(64, 0xDD);
+    CHECK(pair.writer.send(hdr, payload.data(), 64) == 1);
+
+    bool got = poll_until(pair.reader, [&](const transport::FrameHeader& h, const void* p, uint32_t sz) {
+        CHECK(h.seq_num == 7);
+        CHECK(h.topic_hash == 0x5555);
+        CHECK(!transport::isMemFd(h));
+        CHECK(sz == 64);
+        CHECK(std::memcmp(p, payload.data(), 64) == 0);
+    });
+    CHECK(got);
+
+    std::cout << "PASS\n";
+}
+
+// ─── Test 6: Large memfd roundtrip ──────────────────────────────────────────────
+
+void test_roundtrip_memfd() {
+    std::cout << "[6]  UdsTransport roundtrip (1 MB, memfd) ... ";
+
+    UdsPair pair(socket_path("large"), 0x7777, 0x8888);
+    CHECK(pair.connected);
+
+    constexpr uint32_t kSize = 1024 * 1024;
+    std::vector<uint8_t> payload(kSize);
+    for (uint32_t i = 0; i < kSize; ++i)
+        payload[i] = static_cast<uint8_t>(i & 0xFF);
+
+    transport::FrameHeader hdr;
+    hdr.topic_hash   = 0x7777;
+    hdr.seq_num      = 100;
+    hdr.payload_size = kSize;
+    CHECK(pair.writer.send(hdr, payload.data(), kSize) == 1);
+
+    bool got = poll_until(pair.reader, [&](const transport::FrameHeader& h, const void* p, uint32_t sz) {
+        CHECK(h.seq_num == 100);
+        CHECK(transport::isMemFd(h));
+        CHECK(sz == kSize);
+        CHECK(std::memcmp(p, payload.data(), kSize) == 0);
+    });
+    CHECK(got);
+
+    // Just below the threshold stays inline.
+    const uint32_t inline_size = pair.writer.memfdThreshold();
+    hdr.payload_size = inline_size;
+    CHECK(pair.writer.send(hdr, payload.data(), inline_size) == 1);
+    got = poll_until(pair.reader, [&](const transport::FrameHeader& h, const void*, uint32_t sz) {
+        CHECK(!transport::isMemFd(h));
+        CHECK(sz == inline_size);
+    });
+    CHECK(got);
+
+    std::cout << "PASS\n";
+}
+
+// ─── Test 7: One writer, three readers ──────────────────────────────────────────
+
+void test_multi_reader() {
+    std::cout << "[7]  UdsTransport 1 Writer → 3 Readers ... ";
+
+    auto path = socket_path("multi");
+    transport::UdsTransportWriter writer(path, 0xAAAA, 0xBBBB);
+    CHECK(writer.startListening());
+
+    std::vector<std::unique_ptr<transport::UdsTransportReader>> readers;
+    for (int i = 0; i < 3; ++i) {
+        auto r = std::make_unique<transport::UdsTransportReader>(
+            path, 0xAAAA, 0xBBBB, 2000 + i, "test-host");
+        std::thread accept_thread([&] { writer.onAcceptReady(); });
+        CHECK(r->connect());
+        accept_thread.join();
+        readers.push_back(std::move(r));
+    }
+    CHECK(writer.connectionCount() == 3);
+
+    // One memfd frame is shared by all three subscribers.
+    std::vector<uint8_t> payload(200 * 1024, 0x42);
+    transport::FrameHeader hdr;
+    hdr.topic_hash   = 0xAAAA;
+    hdr.seq_num      = 55;
+    hdr.payload_size = static_cast<uint32_t>(payload.size());
+    CHECK(writer.send(hdr, payload.data(), hdr.payload_size) == 3);
+
+    for (auto& r : readers) {
+        bool got = poll_until(*r, [&](const transport::FrameHeader& h, const void* p, uint32_t sz) {
+            CHECK(h.seq_num == 55);
+            CHECK(sz == payload.size());
+            CHECK(std::memcmp(p, payload.data(), sz) == 0);
+        });
+        CHECK(got);
+    }
+
+    std::cout << "PASS\n";
+}
+
+// ─── Test 8: Writer close → reader disconnect ───────────────────────────────────
+
+void test_writer_close() {
+    std::cout << "[8]  UdsTransport writer close → reader disconnect ... ";
+
+    auto path = socket_path("close");
+    auto pair = std::make_unique<UdsPair>(path, 0xCCCC, 0xDDDD);
+    CHECK(pair->connected);
+
+    // A second reader whose side goes away first is dropped on the next send.
+    transport::UdsTransportReader early(path, 0xCCCC, 0xDDDD, 3000, "test-host");
+    std::thread accept_thread([&] { pair->writer.onAcceptReady(); });
+    CHECK(early.connect());
+    accept_thread.join();
+    CHECK(pair->writer.connectionCount() == 2);
+    early.close();
+
+    transport::FrameHeader hdr;
+    hdr.topic_hash = 0xCCCC;
+    uint8_t byte = 1;
+    hdr.payload_size = 1;
+    CHECK(pair->writer.send(hdr, &byte, 1) == 1);
+    CHECK(pair->writer.connectionCount() == 1);
+
+    pair->writer.close();
+    CHECK(pair->writer.connectionCount() == 0);
+
+    // The frame sent before close is still delivered, then EOF.
+    int frames = 0;
+    pair->reader.onDataReady([&](const transport::FrameHeader&, const void*, uint32_t) { ++frames; });
+    CHECK(frames == 1);
+    CHECK(!pair->reader.isConnected());
+
+    std::cout << "PASS\n";
+}
+
+// ─── Test 9: TransportSelector ──────────────────────────────────────────────────
+
+void test_selector() {
+    std::cout << "[9]  TransportSelector: Uds for same-host \"uds:\" endpoints ... ";
+
+    NodeOptions nopts;
+    nopts.enable_shm = false;
+
+    discovery::TopicEndpoint ep;
+    ep.pid          = platform::currentPid() + 9999;
+    ep.hostname     = platform::currentHostname();
+    ep.net_endpoint = makeUdsEndpoint("/tmp/x.sock");
+
+    CHECK(isUdsEndpoint(ep.net_endpoint));
+    CHECK(udsPathOf(ep.net_endpoint) == "/tmp/x.sock");
+    CHECK(selectTransport(ep, nopts) == ChannelKind::Uds);
+
+    // SHM still wins when enabled.
+    NodeOptions with_shm;
+    CHECK(selectTransport(ep, with_shm) == ChannelKind::Shm);
+
+    // A remote host can never reach our socket path.
+    discovery::TopicEndpoint remote = ep;
+    remote.hostname = "remote-machine-xyz";
+    CHECK(selectTransport(remote, nopts) != ChannelKind::Uds);
+    CHECK(selectTransport(remote, nopts) != ChannelKind::Net);
+
+    // UDS disabled → no transport for a "uds:" endpoint.
+    NodeOptions no_uds = nopts;
+    no_uds.enable_uds = false;
+    CHECK(selectTransport(ep, no_uds) != ChannelKind::Uds);
+
+    // Same host without SHM, IP endpoint → Net as before.
+    ep.net_endpoint = "127.0.0.1:9000";
+    CHECK(selectTransport(ep, nopts) == ChannelKind::Net);
+
+    std::cout << "PASS\n";
+}
+
+// ─── Test 10: Benchmark ─────────────────────────────────────────────────────────
+
+/// Lock-step ping: send one frame, spin until the receiving thread has seen it.
+/// Returns mean one-way latency in µs, or a negative value if frames were lost.
+static double bench_lockstep(int iterations,
+                             const std::function<bool()>& send_one,
+                             const std::function<void(std::atomic<int>&)>& poll_one) {
+    std::atomic<int> received{0};
+    std::atomic<bool> stop{false};
+    std::thread rx([&] {
+        while (!stop.load(std::memory_order_relaxed)) {
+            poll_one(received);
+            std::this_thread::yield(); // keeps single-core runners fair
+        }
+    });
+
+    int lost = 0;
+    auto t0 = std::chrono::steady_clock::now();
+    for (int i = 0; i < iterations; ++i) {
+        const int expect = received.load(std::memory_order_acquire) + 1;
+        if (!send_one()) {
+            ++lost;
+            continue;
+        }
+        auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(200);
+        while (received.load(std::memory_order_acquire) < expect) {
+            if (std::chrono::steady_clock::now() > deadline) {
+                ++lost;
+                break;
+            }
+            std::this_thread::yield();
+        }
+    }
+    auto elapsed = std::chrono::steady_clock::now() - t0;
+    stop = true;
+    rx.join();
+
+    if (lost > 0)
+        return -lost;
+    return std::chrono::duration<double, std::micro>(elapsed).count() / iterations;
+}
+
+static void print_result(const char* name, uint32_t size, double us) {
+    if (us < 0) {
+        std::printf("    %-5s %8u B : %d frames lost\n", name, size, static_cast<int>(-us));
+        return;
+    }
+    std::printf("    %-5s %8u B : %8.2f us/msg  %9.1f MB/s\n",
+                name, size, us, size / us);
+}
+
+void test_benchmark() {
+    std::cout << "[10] Benchmark: UDS vs. loopback UDP vs. loopback TCP ...\n";
+    platform::NetInitGuard net_guard;
+
+    const uint32_t sizes[] = {64, 1024 * 1024};
+    for (uint32_t size : sizes) {
+        const int iterations = size <= 1024 ? 5000 : 200;
+        std::vector<uint8_t> payload(size, 0x5A);
+        transport::FrameHeader hdr;
+        hdr.topic_hash   = 0xBE7C;
+        hdr.payload_size = size;
+
+        // ── UDS ──
+        double uds_us = 0;
+        {
+            UdsPair pair(socket_path("bench"), 0xBE7C, 0x1);
+            CHECK(pair.connected);
+            uds_us = bench_lockstep(
+                iterations,
+                [&] { return pair.writer.send(hdr, payload.data(), size) == 1; },
+                [&](std::atomic<int>& n) {
+                    pair.reader.pollOnce([&](const transport::FrameHeader&, const void*, uint32_t sz) {
+                        if (sz == size) n.fetch_add(1, std::memory_order_release);
+                    });
+                });
+            print_result("UDS", size, uds_us);
+        }
+
+        // ── UDP ──
+        double udp_us = 0;
+        {
+            transport::UdpTransportReader reader(0);
+            transport::UdpTransportWriter writer("127.0.0.1", reader.localPort());
+            udp_us = bench_lockstep(
+                iterations,
+                [&] { return writer.send(hdr, payload.data(), size); },
+                [&](std::atomic<int>& n) {
+                    reader.pollOnce([&](const transport::FrameHeader&, const void*, uint32_t sz) {
+                        if (sz == size) n.fetch_add(1, std::memory_order_release);
+                    });
+                });
+            print_result("UDP", size, udp_us);
+        }
+
+        // ── TCP ──
+        double tcp_us = 0;
+        {
+            transport::TcpTransportWriter writer("127.0.0.1", 0, 0xBE7C, 0x1);
+            CHECK(writer.startListening());
+            std::thread accept_thread([&] { writer.onAcceptReady(); });
+            transport::TcpTransportReader reader("127.0.0.1", writer.listeningPort(),
+                                                 0xBE7C, 0x1, 1234, "test-host");
+            CHECK(reader.connect());
+            accept_thread.join();
+            tcp_us = bench_lockstep(
+                iterations,
+                [&] { return writer.send(hdr, payload.data(), size) == 1; },
+                [&](std::atomic<int>& n) {
+                    reader.pollOnce([&](const transport::FrameHeader&, const void*, uint32_t sz) {
+                        if (sz == size) n.fetch_add(1, std::memory_order_release);
+                    });
+                });
+            print_result("TCP", size, tcp_us);
+        }
+
+        // UDS must deliver every frame; timings are informative only.
+        CHECK(uds_us > 0);
+    }
+
+    std::cout << "     PASS\n";
+}
+
+// ═════════════════════════════════════════════════════════════════════════════════
+
+int main() {
+    std::cout << "═══ Unix Domain Socket Transport Tests ═══\n\n";
+
+    if (!platform::unixSocketsSupported()) {
+        std::cout << "Unix domain sockets not supported on this platform — skipped\n";
+        return 0;
+    }
+
+    test_socket_boundaries();
+    test_memfd_pass();
+    test_handshake_accepted();
+    test_handshake_type_mismatch();
+    test_roundtrip_small();
+    test_roundtrip_memfd();
+    test_multi_reader();
+    test_writer_close();
+    test_selector();
+    test_benchmark();
+
+    std::cout << "\n═══ Results: " << tests_passed << " passed, "
+              << tests_failed << " failed ═══\n";
+    return tests_failed > 0 ? 1 : 0;
+}
@@ -9,16 +9,23 @@
  *  4. Multiple topics, multiple subscribers
  *  5. Executor integration (SingleThreadedExecutor + spinSome)
  *  6. Node stop() orderly shutdown
+ *  7. Emplace publish
+ *  8. Batch publish (span and iterator forms)
+ *  9. Per-publisher HybridClock, publisher ids and OrderKey
+ * 10. Loan API without SHM peers
  */
 #include <iostream>
+#include <algorithm>
 #include <cassert>
 #include <atomic>
 #include <thread>
 #include <chrono>
 #include <vector>
+#include <list>
 #include <string>
 
 #include <lux/communication/ChannelKind.hpp>
+#include <lux/communication/HybridClock.hpp>
 #include <lux/communication/TransportSelector.hpp>
 #include <lux/communication/NodeOptions.hpp>
 #include <lux/communication/IoThread.hpp>
@@ -415,6 +422,166 @@ static void testEmplace()
     std::cout << "OK (" << (tests_passed - prior) << " checks)\n";
 }
 
+// ─── Test 8: Batch publish ──────────────────────────────────────────────────
+
+static void testPublishBatch()
+{
+    std::cout << "[UnifiedNode] Testing publishBatch ... ";
+    int prior = tests_passed;
+
+    comm::Domain domain(505);
+    comm::NodeOptions nopts;
+    nopts.enable_discovery = false;
+    nopts.enable_shm       = false;
+    nopts.enable_net       = false;
+
+    comm::Node node("batch_test", domain, nopts);
+
+    std::vector<int> small_got;
+    std::vector<int> heap_got;
+    std::vector<std::string> heap_data;
+
+    auto small_pub = node.createPublisher<SimpleMsg>("batch/small");
+    auto heap_pub  = node.createPublisher<HeapMsg>("batch/heap");
+    auto small_sub = node.createSubscriber<SimpleMsg>(
+        "batch/small",
+        [&](const SimpleMsg& msg) { small_got.push_back(msg.value); });
+    auto heap_sub = node.createSubscriber<HeapMsg>(
+        "batch/heap",
+        [&](std::shared_ptr<HeapMsg> msg) {
+            heap_got.push_back(msg->value);
+            heap_data.push_back(msg->data);
+        });
+
+    comm::SingleThreadedExecutor executor;
+    executor.addNode(&node);
+
+    // span form, SmallValueMsg: delivered in order
+    std::vector<SimpleMsg> burst;
+    for (int i = 0; i < 64; ++i)
+        burst.push_back(SimpleMsg{i});
+    small_pub->publishBatch(std::span<const SimpleMsg>(burst));
+    small_pub->publishBatch(std::span<const SimpleMsg>());   // empty: no-op
+    small_pub->publishBatch(burst.begin(), burst.begin() + 4); // contiguous iterators
+
+    // iterator form over a non-contiguous range, shared_ptr path
+    std::list<HeapMsg> frames{{"a", 1}, {"b", 2}, {"c", 3}};
+    heap_pub->publishBatch(frames.begin(), frames.end());
+
+    executor.spinSome();
+    executor.spinSome();
+
+    bool in_order = small_got.size() == 68;
+    for (size_t i = 0; in_order && i < 64; ++i)
+        in_order = small_got[i] == static_cast<int>(i);
+    for (size_t i = 0; in_order && i < 4; ++i)
+        in_order = small_got[64 + i] == static_cast<int>(i);
+    CHECK(in_order, "span batch delivered complete and in order");
+    CHECK(heap_got == (std::vector<int>{1, 2, 3}), "iterator batch delivered in order");
+    CHECK(heap_data == (std::vector<std::string>{"a", "b", "c"}), "iterator batch payloads intact");
+
+    executor.removeNode(&node);
+    node.stop();
+    std::cout << "OK (" << (tests_passed - prior) << " checks)\n";
+}
+
+// ─── Test 9: HybridClock ────────────────────────────────────────────────────
+
+static void testHybridClock()
+{
+    std::cout << "[UnifiedNode] Testing HybridClock ... ";
+    int prior = tests_passed;
+
+    comm::HybridClock clock;
+    CHECK(clock.tick(1000) == 1000, "first stamp follows the clock");
+    CHECK(clock.tick(1000) == 1001, "stalled clock counts on logically");
+    CHECK(clock.tick(500, 4) == 1002, "clock going back never repeats a stamp");
+    CHECK(clock.last() == 1005, "range reserves consecutive stamps");
+    CHECK(clock.tick(2000) == 2000, "clock catching up resets the logical part");
+
+    // Concurrent ticks never hand out the same stamp twice.
+    comm::HybridClock shared;
+    constexpr int kThreads = 4, kTicks = 10000;
+    std::vector<std::vector<uint64_t>> stamps(kThreads);
+    std::vector<std::thread> threads;
+    for (int t = 0; t < kThreads; ++t)
+        threads.emplace_back([&, t] {
+            for (int i = 0; i < kTicks; ++i)
+                stamps[t].push_back(shared.tick(0, 2));
+        });
+    for (auto &th : threads)
+        th.join();
+    std::vector<uint64_t> all;
+    bool each_increasing = true;
+    for (auto &v : stamps)
+    {
+        for (size_t i = 1; i < v.size(); ++i)
+            each_increasing = each_increasing && v[i] > v[i - 1];
+        all.insert(all.end(), v.begin(), v.end());
+    }
+    std::sort(all.begin(), all.end());
+    bool disjoint = true;
+    for (size_t i = 1; i < all.size(); ++i)
+        disjoint = disjoint && all[i] >= all[i - 1] + 2;
+    CHECK(each_increasing, "stamps increase within a thread");
+    CHECK(disjoint, "concurrent ranges do not overlap");
+
+    // Order key: stamp, then publisher id, then sending process.
+    using Key = comm::OrderKey;
+    CHECK((Key{5, Key::makeOrigin(2, 1)} < Key{6, Key::makeOrigin(1, 1)}), "stamp orders first");
+    CHECK((Key{5, Key::makeOrigin(1, 9)} < Key{5, Key::makeOrigin(2, 1)}), "publisher id breaks stamp ties");
+    CHECK((Key{5, Key::makeOrigin(1, 1)} < Key{5, Key::makeOrigin(1, 2)}),
+          "process tag breaks ties between equal publisher ids");
+    CHECK(comm::processTag("host", 1) != comm::processTag("host", 2) &&
+              comm::processTag("host", 1) != comm::processTag("other", 1) &&
+              comm::processTag("", 0) != 0,
+          "process tags differ by host and pid and are never 0");
+
+    comm::Domain domain(506);
+    comm::NodeOptions nopts;
+    nopts.enable_discovery = false;
+    nopts.enable_shm       = false;
+    nopts.enable_net       = false;
+    comm::Node node("clock_test", domain, nopts);
+    auto pub_a = node.createPublisher<SimpleMsg>("clock/a");
+    auto pub_b = node.createPublisher<SimpleMsg>("clock/b");
+    CHECK(pub_a->publisherId() != 0 && pub_a->publisherId() != pub_b->publisherId(),
+          "publisher ids are unique within the process");
+
+    node.stop();
+    std::cout << "OK (" << (tests_passed - prior) << " checks)\n";
+}
+
+// ─── Test 10: Loan API without SHM peers ────────────────────────────────────
+
+static void testLoanWithoutPeers()
+{
+    std::cout << "[UnifiedNode] Testing loan() without SHM peers ... ";
+
+    comm::Domain domain(507);
+    comm::NodeOptions nopts;
+    nopts.enable_discovery = false;
+    nopts.enable_net       = false;
+    comm::Node node("loan_test", domain, nopts);
+
+    std::atomic<int> received{0};
+    auto sub = node.createSubscriber<SimpleMsg>("loan/topic",
+        [&](const SimpleMsg &) { received.fetch_add(1); });
+    auto pub = node.createPublisher<SimpleMsg>("loan/topic");
+
+    auto loan = pub->loan();
+    CHECK(!loan.valid(), "no SHM subscriber, no slot to loan");
+    pub->publish(std::move(loan)); // no-op
+
+    comm::SingleThreadedExecutor exec;
+    exec.addNode(&node);
+    exec.spinSome();
+    CHECK(received.load() == 0, "an invalid loan publishes nothing");
+
+    node.stop();
+    std::cout << "OK\n";
+}
+
 // ─── main ───────────────────────────────────────────────────────────────────
 
 int main()
@@ -428,6 +595,9 @@ int main()
     testZeroCopyPublish();
     testNodeStop();
     testEmplace();
+    testPublishBatch();
+    testHybridClock();
+    testLoanWithoutPeers();
 
     std::cout << "\n=== Results: "
               << tests_passed << " passed, "